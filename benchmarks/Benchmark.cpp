@@ -0,0 +1,843 @@
+// SFGUI benchmark suite.
+//
+// Builds reproducible synthetic scenes and measures the time spent in
+// SFGUI's processing phases. Results are written as JSON so they can be
+// compared across commits and machines.
+//
+// The suite renders to an sf::RenderTexture and never opens a window. It
+// only needs an OpenGL context, e.g. Mesa's software rasterizer:
+//
+//   LIBGL_ALWAYS_SOFTWARE=1 xvfb-run ./sfgui-bench --output results.json
+//
+// The recording renderer only measures the CPU side of rendering and
+// doesn't draw anything, its results don't depend on the GL driver.
+//
+// Passing --check records a small widget tree with the recording renderer
+// instead and checks its batch and draw call counts, the exit code is
+// non-zero if they don't match what the batching is expected to produce.
+//
+// Usage: sfgui-bench [--check] [--iterations N] [--warmup N] [--scene NAME]
+//                    [--renderer auto|non-legacy|non-legacy-streaming|non-legacy-vertices|non-legacy-distance-field|non-legacy-pages|non-legacy-scissor|non-legacy-depth|non-legacy-sync-images|vertex-buffer|vertex-array|recording|software]
+//                    [--output FILE]
+#include <SFGUI/SFGUI.hpp>
+#include <SFGUI/Renderers.hpp>
+#include <SFGUI/Engines/BREW.hpp>
+#include <SFGUI/Widgets.hpp>
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/OpenGL.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+
+const unsigned int target_width = 1024;
+const unsigned int target_height = 768;
+
+struct Options {
+	int iterations = 20;
+	int warmup = 3;
+	std::string scene;
+	std::string renderer = "auto";
+	std::string output;
+	bool check = false;
+};
+
+struct Phase {
+	std::string name;
+	std::function<void()> run;
+	std::vector<double> samples;
+	std::function<void()> prepare = nullptr; // Called before every run, not measured.
+};
+
+struct Scene {
+	std::string name;
+	std::vector<std::pair<std::string, int>> parameters;
+	std::vector<Phase> phases;
+	std::size_t widget_count = 0;
+	sfg::Profiler::Frame profile;
+};
+
+std::string Escape( const std::string& str ) {
+	std::string escaped;
+
+	for( auto character : str ) {
+		switch( character ) {
+			case '"':
+				escaped += "\\\"";
+				break;
+			case '\\':
+				escaped += "\\\\";
+				break;
+			case '\n':
+				escaped += "\\n";
+				break;
+			default:
+				if( static_cast<unsigned char>( character ) >= 0x20 ) {
+					escaped += character;
+				}
+				break;
+		}
+	}
+
+	return escaped;
+}
+
+std::size_t CountWidgets( const sfg::Widget::Ptr& widget ) {
+	std::size_t count = 1;
+
+	auto container = std::dynamic_pointer_cast<sfg::Container>( widget );
+
+	if( container ) {
+		for( const auto& child : container->GetChildren() ) {
+			count += CountWidgets( child );
+		}
+	}
+
+	return count;
+}
+
+// Moves the mouse over the whole widget in a fixed grid
+// and clicks at every eighth position.
+void DispatchEvents( const sfg::Widget::Ptr& widget ) {
+	const static auto steps = 32;
+
+	const auto& allocation = widget->GetAllocation();
+
+	for( int row = 0; row < steps; ++row ) {
+		for( int column = 0; column < steps; ++column ) {
+			sf::Vector2i position(
+				static_cast<int>( allocation.position.x + allocation.size.x * static_cast<float>( column ) / static_cast<float>( steps ) ),
+				static_cast<int>( allocation.position.y + allocation.size.y * static_cast<float>( row ) / static_cast<float>( steps ) )
+			);
+
+			widget->HandleEvent( sf::Event::MouseMoved{ position } );
+
+			if( ( row * steps + column ) % 8 == 0 ) {
+				widget->HandleEvent( sf::Event::MouseButtonPressed{ sf::Mouse::Button::Left, position } );
+				widget->HandleEvent( sf::Event::MouseButtonReleased{ sf::Mouse::Button::Left, position } );
+			}
+		}
+	}
+}
+
+// Adds the phases every widget scene is measured in.
+void AddWidgetPhases( Scene& scene, sfg::Widget::Ptr root, sfg::SFGUI& sfgui, sf::RenderTexture& target ) {
+	root->Update( 0.f );
+
+	scene.widget_count = CountWidgets( root );
+
+	scene.phases.push_back( { "event_dispatch", [root] {
+		DispatchEvents( root );
+	}, {} } );
+
+	// Refreshing invalidates and resizes the whole hierarchy.
+	scene.phases.push_back( { "layout", [root] {
+		root->Refresh();
+	}, {} } );
+
+	// Builds the drawables of all widgets invalidated by the refresh.
+	scene.phases.push_back( { "drawables", [root] {
+		root->Update( 0.f );
+	}, {} } );
+
+	// Rebuilds and uploads all vertex data and draws it.
+	scene.phases.push_back( { "vbo_build", [&sfgui, &target] {
+		sfgui.GetRenderer().Invalidate();
+
+		target.clear();
+		sfgui.Display( target );
+		target.display();
+
+		glFinish();
+	}, {} } );
+}
+
+// Alternates an image between two frames like a live video feed.
+void AddImageFeedPhases( Scene& scene, sfg::Widget::Ptr root, sfg::Image::Ptr image, sfg::SFGUI& sfgui, sf::RenderTexture& target ) {
+	root->Update( 0.f );
+
+	scene.widget_count = CountWidgets( root );
+
+	const auto size = image->GetImage().getSize();
+
+	auto frames = std::make_shared<std::vector<sf::Image>>();
+	frames->emplace_back( size, sf::Color::Red );
+	frames->emplace_back( size, sf::Color::Blue );
+
+	auto frame = std::make_shared<std::size_t>( 0 );
+
+	// We don't wait for the GPU here, the time the
+	// caller is held up by the upload is what we are after.
+	scene.phases.push_back( { "image_update", [image, frames, frame, &sfgui, &target] {
+		image->SetImage( ( *frames )[( *frame )++ % frames->size()] );
+
+		target.clear();
+		sfgui.Display( target );
+		target.display();
+	}, {} } );
+}
+
+sfg::Widget::Ptr CreateTableButtons( int count ) {
+	const static auto columns = 40;
+
+	auto table = sfg::Table::Create();
+
+	for( int index = 0; index < count; ++index ) {
+		auto column = static_cast<std::uint32_t>( index % columns );
+		auto row = static_cast<std::uint32_t>( index / columns );
+
+		table->Attach( sfg::Button::Create( "Button " + std::to_string( index ) ), { { column, row }, { 1u, 1u } } );
+	}
+
+	auto window = sfg::Window::Create();
+	window->SetTitle( "Table" );
+	window->Add( table );
+
+	return window;
+}
+
+sfg::Widget::Ptr CreateNestedBoxes( int depth ) {
+	auto innermost = sfg::Box::Create( sfg::Box::Orientation::VERTICAL );
+	innermost->Pack( sfg::Label::Create( "Innermost" ) );
+
+	sfg::Box::Ptr box = innermost;
+
+	for( int level = depth - 1; level > 0; --level ) {
+		auto parent = sfg::Box::Create( ( level % 2 ) ? sfg::Box::Orientation::HORIZONTAL : sfg::Box::Orientation::VERTICAL, 1.f );
+		parent->Pack( sfg::Button::Create( std::to_string( level ) ), false );
+		parent->Pack( box );
+
+		box = parent;
+	}
+
+	auto window = sfg::Window::Create();
+	window->SetTitle( "Nested Boxes" );
+	window->Add( box );
+
+	return window;
+}
+
+sfg::Widget::Ptr CreateWrappedLabels( int count, int length ) {
+	const static std::string words[] = { "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing", "elit" };
+
+	auto box = sfg::Box::Create( sfg::Box::Orientation::VERTICAL, 5.f );
+
+	for( int index = 0; index < count; ++index ) {
+		std::string text;
+
+		for( std::size_t word = static_cast<std::size_t>( index ); static_cast<int>( text.size() ) < length; ++word ) {
+			text += words[word % 8];
+			text += ' ';
+		}
+
+		auto label = sfg::Label::Create( text );
+		label->SetLineWrap( true );
+		label->SetRequisition( sf::Vector2f( 400.f, 0.f ) );
+
+		box->Pack( label );
+	}
+
+	auto window = sfg::Window::Create();
+	window->SetTitle( "Wrapped Labels" );
+	window->Add( box );
+
+	return window;
+}
+
+sfg::Widget::Ptr CreateScrolledRows( int count ) {
+	auto rows = sfg::Box::Create( sfg::Box::Orientation::VERTICAL );
+
+	for( int index = 0; index < count; ++index ) {
+		auto row = sfg::Box::Create( sfg::Box::Orientation::HORIZONTAL, 5.f );
+		row->Pack( sfg::Label::Create( "Row " + std::to_string( index ) ) );
+		row->Pack( sfg::Button::Create( "Edit" ), false );
+
+		rows->Pack( row, false );
+	}
+
+	auto scrolled_window = sfg::ScrolledWindow::Create();
+	scrolled_window->SetScrollbarPolicy( sfg::ScrolledWindow::HORIZONTAL_AUTOMATIC | sfg::ScrolledWindow::VERTICAL_ALWAYS );
+	scrolled_window->AddWithViewport( rows );
+	scrolled_window->SetRequisition( sf::Vector2f( 600.f, 500.f ) );
+
+	auto window = sfg::Window::Create();
+	window->SetTitle( "Scrolled Rows" );
+	window->Add( scrolled_window );
+
+	return window;
+}
+
+sfg::Widget::Ptr CreateLabelDashboard( int panel_count, int label_count ) {
+	auto panels = sfg::Box::Create( sfg::Box::Orientation::VERTICAL, 5.f );
+
+	for( int panel_index = 0; panel_index < panel_count; ++panel_index ) {
+		auto box = sfg::Box::Create( sfg::Box::Orientation::VERTICAL );
+
+		for( int label_index = 0; label_index < label_count; ++label_index ) {
+			box->Pack( sfg::Label::Create( "Sensor " + std::to_string( panel_index ) + "." + std::to_string( label_index ) + ": " + std::to_string( panel_index * label_index ) + " units" ) );
+		}
+
+		auto frame = sfg::Frame::Create( "Panel " + std::to_string( panel_index ) );
+		frame->Add( box );
+
+		panels->Pack( frame );
+	}
+
+	auto scrolled_window = sfg::ScrolledWindow::Create();
+	scrolled_window->SetScrollbarPolicy( sfg::ScrolledWindow::HORIZONTAL_AUTOMATIC | sfg::ScrolledWindow::VERTICAL_ALWAYS );
+	scrolled_window->AddWithViewport( panels );
+	scrolled_window->SetRequisition( sf::Vector2f( 500.f, 400.f ) );
+
+	auto window = sfg::Window::Create();
+	window->SetTitle( "Label Dashboard" );
+	window->Add( scrolled_window );
+
+	return window;
+}
+
+// Refreshes the hierarchy child by child, which is the default, in a single
+// pass and in a single pass with worker threads. The "layout" phase keeps
+// the default settings so it can be compared with earlier builds.
+void AddConcurrentLayoutPhases( Scene& scene, sfg::Widget::Ptr root ) {
+	root->Update( 0.f );
+
+	scene.widget_count = CountWidgets( root );
+
+	auto worker_count = std::max( 1u, std::thread::hardware_concurrency() ) - 1;
+
+	scene.parameters.emplace_back( "worker_threads", static_cast<int>( worker_count ) );
+
+	scene.phases.push_back( { "layout", [root] {
+		root->Refresh();
+	}, {}, [] {
+		sfg::Context::Get().SetConcurrentLayout( false );
+		sfg::Context::Get().SetWorkerThreadCount( 0 );
+	} } );
+
+	scene.phases.push_back( { "layout_single_pass", [root] {
+		root->Refresh();
+	}, {}, [] {
+		sfg::Context::Get().SetConcurrentLayout( true );
+		sfg::Context::Get().SetWorkerThreadCount( 0 );
+	} } );
+
+	scene.phases.push_back( { "layout_threaded", [root] {
+		root->Refresh();
+	}, {}, [worker_count] {
+		sfg::Context::Get().SetConcurrentLayout( true );
+		sfg::Context::Get().SetWorkerThreadCount( worker_count );
+	} } );
+}
+
+std::string CreateTheme( int rule_count, int variant ) {
+	const static std::string selectors[] = { "Window", "Button", "Label", "Box", "Table", "Entry", "ScrolledWindow", "Scrollbar" };
+	const static std::string states[] = { "", ":PRELIGHT", ":ACTIVE", ":SELECTED" };
+
+	std::ostringstream theme;
+
+	for( int index = 0; index < rule_count; ++index ) {
+		auto level = ( index + variant * 16 ) % 200;
+
+		theme << "* " << selectors[index % 8] << states[( index / 8 ) % 4] << " {\n"
+		      << "\tBackgroundColor: #" << std::hex << ( 0x202020 + level * 0x010101 ) << std::dec << "ff;\n"
+		      << "\tBorderColor: #404040ff;\n"
+		      << "\tBorderWidth: " << ( index % 3 ) << ";\n"
+		      << "\tPadding: " << ( ( index + variant ) % 5 ) << ";\n"
+		      << "\tFontSize: " << ( 10 + ( index + variant ) % 6 ) << ";\n"
+		      << "}\n\n";
+	}
+
+	return theme.str();
+}
+
+void AddThemePhases( Scene& scene, sfg::Desktop& desktop, int rule_count ) {
+	auto theme = CreateTheme( rule_count, 0 );
+	auto themes = std::make_shared<std::vector<std::string>>( std::vector<std::string>{ theme, CreateTheme( rule_count, 1 ) } );
+	auto compiled = std::make_shared<std::vector<char>>();
+
+	{
+		sfg::eng::BREW engine;
+		engine.LoadThemeFromString( theme );
+		*compiled = engine.CompileTheme();
+	}
+
+	// Parsing and applying to an engine without widgets.
+	scene.phases.push_back( { "parse", [theme] {
+		sfg::eng::BREW engine;
+		engine.LoadThemeFromString( theme );
+	}, {} } );
+
+	scene.phases.push_back( { "load_compiled", [compiled] {
+		sfg::eng::BREW engine;
+		engine.LoadCompiledTheme( compiled->data(), compiled->size() );
+	}, {} } );
+
+	// Applying to the desktop's engine refreshes all widgets whose style
+	// changed, alternate between two variants so every run changes them.
+	auto applied = std::make_shared<std::size_t>( 0 );
+
+	scene.phases.push_back( { "apply", [&desktop, themes, applied] {
+		desktop.SetProperties( ( *themes )[( *applied )++ % 2] );
+	}, {} } );
+}
+
+void Measure( Scene& scene, const Options& options ) {
+	sfg::Profiler::Clear();
+
+	for( int iteration = 0; iteration < options.warmup + options.iterations; ++iteration ) {
+		// Only measured iterations are profiled.
+		if( iteration == options.warmup ) {
+			sfg::Profiler::Clear();
+		}
+
+		for( auto& phase : scene.phases ) {
+			if( phase.prepare ) {
+				phase.prepare();
+			}
+
+			auto begin = std::chrono::steady_clock::now();
+
+			phase.run();
+
+			auto end = std::chrono::steady_clock::now();
+
+			if( iteration >= options.warmup ) {
+				phase.samples.push_back( std::chrono::duration<double, std::micro>( end - begin ).count() );
+			}
+		}
+	}
+
+	scene.profile = sfg::Profiler::GetAverage();
+}
+
+void WriteStatistics( std::ostream& stream, std::vector<double> samples ) {
+	std::sort( samples.begin(), samples.end() );
+
+	auto mean = 0.;
+
+	for( auto sample : samples ) {
+		mean += sample;
+	}
+
+	mean /= static_cast<double>( samples.size() );
+
+	auto variance = 0.;
+
+	for( auto sample : samples ) {
+		variance += ( sample - mean ) * ( sample - mean );
+	}
+
+	variance /= static_cast<double>( samples.size() );
+
+	auto median = ( samples.size() % 2 ) ? samples[samples.size() / 2] : ( samples[samples.size() / 2 - 1] + samples[samples.size() / 2] ) / 2.;
+
+	stream << "{ \"samples\": " << samples.size()
+	       << ", \"min_us\": " << samples.front()
+	       << ", \"median_us\": " << median
+	       << ", \"mean_us\": " << mean
+	       << ", \"max_us\": " << samples.back()
+	       << ", \"stddev_us\": " << std::sqrt( variance ) << " }";
+}
+
+void WriteResults( std::ostream& stream, const std::vector<Scene>& scenes, const Options& options, const std::string& renderer, const std::string& gl_renderer ) {
+	stream.setf( std::ios::fixed );
+	stream.precision( 3 );
+
+	stream << "{\n"
+	       << "\t\"renderer\": \"" << Escape( renderer ) << "\",\n"
+	       << "\t\"gl_renderer\": \"" << Escape( gl_renderer ) << "\",\n"
+	       << "\t\"profiler\": " << ( sfg::Profiler::IsAvailable() ? "true" : "false" ) << ",\n"
+	       << "\t\"iterations\": " << options.iterations << ",\n"
+	       << "\t\"warmup\": " << options.warmup << ",\n"
+	       << "\t\"scenes\": [\n";
+
+	for( std::size_t scene_index = 0; scene_index < scenes.size(); ++scene_index ) {
+		const auto& scene = scenes[scene_index];
+
+		stream << "\t\t{\n"
+		       << "\t\t\t\"name\": \"" << Escape( scene.name ) << "\",\n"
+		       << "\t\t\t\"parameters\": {";
+
+		for( std::size_t index = 0; index < scene.parameters.size(); ++index ) {
+			stream << ( index ? ", " : " " ) << "\"" << Escape( scene.parameters[index].first ) << "\": " << scene.parameters[index].second;
+		}
+
+		stream << " },\n"
+		       << "\t\t\t\"widgets\": " << scene.widget_count << ",\n"
+		       << "\t\t\t\"phases\": {\n";
+
+		for( std::size_t index = 0; index < scene.phases.size(); ++index ) {
+			stream << "\t\t\t\t\"" << Escape( scene.phases[index].name ) << "\": ";
+			WriteStatistics( stream, scene.phases[index].samples );
+			stream << ( ( index + 1 < scene.phases.size() ) ? ",\n" : "\n" );
+		}
+
+		stream << "\t\t\t}";
+
+		// Per phase breakdown of the average measured iteration.
+		if( sfg::Profiler::IsAvailable() ) {
+			stream << ",\n\t\t\t\"profile\": {\n"
+			       << "\t\t\t\t\"timings_us\": {";
+
+			for( std::size_t index = 0; index < static_cast<std::size_t>( sfg::Profiler::Phase::COUNT ); ++index ) {
+				auto phase = static_cast<sfg::Profiler::Phase>( index );
+				stream << ( index ? ", " : " " ) << "\"" << Escape( sfg::Profiler::GetPhaseName( phase ) ) << "\": " << scene.profile.GetTiming( phase );
+			}
+
+			stream << " },\n"
+			       << "\t\t\t\t\"counters\": {";
+
+			for( std::size_t index = 0; index < static_cast<std::size_t>( sfg::Profiler::Counter::COUNT ); ++index ) {
+				auto counter = static_cast<sfg::Profiler::Counter>( index );
+				stream << ( index ? ", " : " " ) << "\"" << Escape( sfg::Profiler::GetCounterName( counter ) ) << "\": " << scene.profile.GetCount( counter );
+			}
+
+			stream << " }\n"
+			       << "\t\t\t}";
+		}
+
+		stream << "\n\t\t}" << ( ( scene_index + 1 < scenes.size() ) ? ",\n" : "\n" );
+	}
+
+	stream << "\t]\n"
+	       << "}\n";
+}
+
+bool Expect( bool condition, const std::string& what ) {
+	if( !condition ) {
+		std::cerr << "Check failed: " << what << "\n";
+	}
+
+	return condition;
+}
+
+// Records a small widget tree and checks the batches the GL renderers
+// would draw it with. Everything outside of a ScrolledWindow shares the
+// window's viewport and the first atlas page and has to end up in a
+// single batch. Content in a ScrolledWindow is clipped to its own viewport
+// and needs batches of its own.
+bool CheckRecording( sf::RenderTexture& target ) {
+	auto renderer = sfg::RecordingRenderer::Create();
+	sfg::Renderer::Set( renderer );
+
+	auto box = sfg::Box::Create( sfg::Box::Orientation::VERTICAL, 5.f );
+	auto label = sfg::Label::Create( "Label" );
+	box->Pack( label );
+	box->Pack( sfg::Button::Create( "Button" ) );
+	box->Pack( sfg::CheckButton::Create( "Check" ) );
+
+	auto window = sfg::Window::Create();
+	window->SetTitle( "Check" );
+	window->Add( box );
+	window->Update( 0.f );
+
+	renderer->Display( target );
+
+	auto passed = true;
+
+	passed &= Expect( renderer->GetBatches().size() == 1, "flat tree is recorded in 1 batch, got " + std::to_string( renderer->GetBatches().size() ) );
+	passed &= Expect( renderer->GetDrawCallCount() == 1, "flat tree is drawn with 1 draw call, got " + std::to_string( renderer->GetDrawCallCount() ) );
+	passed &= Expect( !renderer->GetIndexData().empty() && ( renderer->GetIndexData().size() % 3 == 0 ), "flat tree is recorded as whole triangles" );
+
+	if( !renderer->GetBatches().empty() ) {
+		passed &= Expect( static_cast<std::size_t>( renderer->GetBatches().front().index_count ) == renderer->GetIndexData().size(), "the batch draws all recorded indices" );
+	}
+
+	// Nothing changed, the recorded frame is reused.
+	const auto rebuild_count = renderer->GetRebuildCount();
+
+	renderer->Display( target );
+
+	passed &= Expect( renderer->GetRebuildCount() == rebuild_count, "unchanged frame is not assembled again" );
+
+	label->SetText( "Changed label" );
+	window->Update( 0.f );
+
+	renderer->Display( target );
+
+	passed &= Expect( renderer->GetRebuildCount() == rebuild_count + 1, "changed frame is assembled once" );
+	passed &= Expect( renderer->GetDrawCallCount() == 1, "changed flat tree is still drawn with 1 draw call" );
+
+	// Scrolled content is clipped to the scrolled window's viewport.
+	auto scrolled_box = sfg::Box::Create( sfg::Box::Orientation::VERTICAL );
+	scrolled_box->Pack( sfg::Label::Create( "Scrolled label" ) );
+
+	auto scrolled_window = sfg::ScrolledWindow::Create();
+	scrolled_window->SetScrollbarPolicy( sfg::ScrolledWindow::HORIZONTAL_NEVER | sfg::ScrolledWindow::VERTICAL_ALWAYS );
+	scrolled_window->AddWithViewport( scrolled_box );
+	scrolled_window->SetRequisition( sf::Vector2f( 200.f, 100.f ) );
+
+	box->Pack( scrolled_window );
+	window->Update( 0.f );
+
+	renderer->Display( target );
+
+	std::size_t clipped_batches = 0;
+
+	for( const auto& batch : renderer->GetBatches() ) {
+		if( batch.scissor != sf::IntRect( { 0, 0 }, sf::Vector2i( target.getSize() ) ) ) {
+			++clipped_batches;
+		}
+	}
+
+	passed &= Expect( clipped_batches == 1, "scrolled content is recorded in 1 clipped batch, got " + std::to_string( clipped_batches ) );
+	passed &= Expect( renderer->GetDrawCallCount() == renderer->GetBatches().size(), "every batch of the scrolled tree is drawn" );
+	passed &= Expect( renderer->GetDrawCallCount() >= 2, "scrolled tree needs a draw call per viewport" );
+
+	std::cerr << ( passed ? "Recording check passed.\n" : "Recording check failed.\n" );
+
+	return passed;
+}
+
+bool ParseOptions( int argc, char** argv, Options& options ) {
+	for( int index = 1; index < argc; ++index ) {
+		std::string argument( argv[index] );
+
+		if( argument == "--help" ) {
+			return false;
+		}
+
+		if( argument == "--check" ) {
+			options.check = true;
+			continue;
+		}
+
+		if( index + 1 >= argc ) {
+			std::cerr << "Missing value for " << argument << "\n";
+			return false;
+		}
+
+		std::string value( argv[++index] );
+
+		if( argument == "--iterations" ) {
+			options.iterations = std::max( 1, std::atoi( value.c_str() ) );
+		}
+		else if( argument == "--warmup" ) {
+			options.warmup = std::max( 0, std::atoi( value.c_str() ) );
+		}
+		else if( argument == "--scene" ) {
+			options.scene = value;
+		}
+		else if( argument == "--renderer" ) {
+			options.renderer = value;
+		}
+		else if( argument == "--output" ) {
+			options.output = value;
+		}
+		else {
+			std::cerr << "Unknown option " << argument << "\n";
+			return false;
+		}
+	}
+
+	return true;
+}
+
+}
+
+int main( int argc, char** argv ) {
+	Options options;
+
+	if( !ParseOptions( argc, argv, options ) ) {
+		std::cerr << "Usage: sfgui-bench [--check] [--iterations N] [--warmup N] [--scene NAME] [--renderer auto|non-legacy|non-legacy-streaming|non-legacy-vertices|non-legacy-distance-field|non-legacy-pages|non-legacy-scissor|non-legacy-depth|non-legacy-sync-images|vertex-buffer|vertex-array|recording|software] [--output FILE]\n";
+		return 1;
+	}
+
+	sf::RenderTexture target;
+
+	// The depth pre-pass needs a depth buffer.
+	sf::ContextSettings settings;
+
+	if( options.renderer == "non-legacy-depth" ) {
+		settings.depthBits = 24;
+	}
+
+	if( !target.resize( { target_width, target_height }, settings ) ) {
+		std::cerr << "Failed to create render texture, no OpenGL context available.\n";
+		return 1;
+	}
+
+	(void)target.setActive( true );
+
+	sfg::SFGUI sfgui;
+
+	if( options.check ) {
+		return CheckRecording( target ) ? 0 : 1;
+	}
+
+	if( options.renderer == "non-legacy" ) {
+		sfg::Renderer::Set( sfg::NonLegacyRenderer::Create() );
+	}
+	else if( options.renderer == "non-legacy-streaming" ) {
+		auto renderer = sfg::NonLegacyRenderer::Create();
+		renderer->TuneStreaming( true );
+		sfg::Renderer::Set( renderer );
+	}
+	else if( options.renderer == "non-legacy-vertices" ) {
+		auto renderer = sfg::NonLegacyRenderer::Create();
+		renderer->TuneInstancing( false );
+		sfg::Renderer::Set( renderer );
+	}
+	else if( options.renderer == "non-legacy-distance-field" ) {
+		auto renderer = sfg::NonLegacyRenderer::Create();
+		renderer->TuneDistanceFieldText( true );
+		sfg::Renderer::Set( renderer );
+	}
+	else if( options.renderer == "non-legacy-pages" ) {
+		auto renderer = sfg::NonLegacyRenderer::Create();
+		renderer->TuneTextureArray( false );
+		sfg::Renderer::Set( renderer );
+	}
+	else if( options.renderer == "non-legacy-scissor" ) {
+		auto renderer = sfg::NonLegacyRenderer::Create();
+		renderer->TuneShaderClipping( false );
+		sfg::Renderer::Set( renderer );
+	}
+	else if( options.renderer == "non-legacy-depth" ) {
+		auto renderer = sfg::NonLegacyRenderer::Create();
+		renderer->TuneDepthPrePass( true );
+		sfg::Renderer::Set( renderer );
+	}
+	else if( options.renderer == "non-legacy-sync-images" ) {
+		auto renderer = sfg::NonLegacyRenderer::Create();
+		renderer->TuneImageStreaming( false );
+		sfg::Renderer::Set( renderer );
+	}
+	else if( options.renderer == "vertex-buffer" ) {
+		sfg::Renderer::Set( sfg::VertexBufferRenderer::Create() );
+	}
+	else if( options.renderer == "vertex-array" ) {
+		sfg::Renderer::Set( sfg::VertexArrayRenderer::Create() );
+	}
+	else if( options.renderer == "recording" ) {
+		sfg::Renderer::Set( sfg::RecordingRenderer::Create() );
+	}
+	else if( options.renderer == "software" ) {
+		sfg::Renderer::Set( sfg::SoftwareRenderer::Create() );
+	}
+	else if( options.renderer != "auto" ) {
+		std::cerr << "Unknown renderer " << options.renderer << "\n";
+		return 1;
+	}
+
+	auto gl_renderer = reinterpret_cast<const char*>( glGetString( GL_RENDERER ) );
+
+	sfg::Profiler::SetEnabled( true );
+
+	// Scenes are built one at a time, the builders
+	// are only called for the selected scenes.
+	std::vector<std::pair<std::string, std::function<void( Scene& )>>> builders;
+
+	sfg::Widget::Ptr root;
+	sfg::Desktop desktop;
+
+	builders.emplace_back( "table_buttons", [&]( Scene& scene ) {
+		scene.parameters = { { "buttons", 1000 } };
+		root = CreateTableButtons( 1000 );
+		AddWidgetPhases( scene, root, sfgui, target );
+	} );
+
+	builders.emplace_back( "nested_boxes", [&]( Scene& scene ) {
+		scene.parameters = { { "depth", 200 } };
+		root = CreateNestedBoxes( 200 );
+		AddWidgetPhases( scene, root, sfgui, target );
+	} );
+
+	builders.emplace_back( "wrapped_labels", [&]( Scene& scene ) {
+		scene.parameters = { { "labels", 100 }, { "characters", 2000 } };
+		root = CreateWrappedLabels( 100, 2000 );
+		AddWidgetPhases( scene, root, sfgui, target );
+	} );
+
+	builders.emplace_back( "scrolled_rows", [&]( Scene& scene ) {
+		scene.parameters = { { "rows", 5000 } };
+		root = CreateScrolledRows( 5000 );
+		AddWidgetPhases( scene, root, sfgui, target );
+	} );
+
+	builders.emplace_back( "label_dashboard", [&]( Scene& scene ) {
+		scene.parameters = { { "panels", 100 }, { "labels", 100 } };
+		root = CreateLabelDashboard( 100, 100 );
+		AddConcurrentLayoutPhases( scene, root );
+	} );
+
+	builders.emplace_back( "image_feed", [&]( Scene& scene ) {
+		scene.parameters = { { "width", 1280 }, { "height", 720 } };
+		auto image = sfg::Image::Create( sf::Image( { 1280u, 720u }, sf::Color::Black ) );
+		auto window = sfg::Window::Create();
+		window->SetTitle( "Image Feed" );
+		window->Add( image );
+		root = window;
+		AddImageFeedPhases( scene, root, image, sfgui, target );
+	} );
+
+	builders.emplace_back( "theme_loading", [&]( Scene& scene ) {
+		scene.parameters = { { "rules", 400 }, { "buttons", 1000 } };
+		root = CreateTableButtons( 1000 );
+		desktop.Add( root );
+		desktop.Update( 0.f );
+		scene.widget_count = CountWidgets( root );
+		AddThemePhases( scene, desktop, 400 );
+	} );
+
+	std::vector<Scene> scenes;
+
+	for( const auto& builder : builders ) {
+		if( !options.scene.empty() && ( options.scene != builder.first ) ) {
+			continue;
+		}
+
+		std::cerr << "Running " << builder.first << "...\n";
+
+		scenes.emplace_back();
+		scenes.back().name = builder.first;
+
+		builder.second( scenes.back() );
+
+		Measure( scenes.back(), options );
+
+		// Release the scene before building the next one.
+		for( auto& phase : scenes.back().phases ) {
+			phase.run = nullptr;
+		}
+
+		desktop.RemoveAll();
+		root.reset();
+
+		sfg::Context::Get().SetConcurrentLayout( false );
+		sfg::Context::Get().SetWorkerThreadCount( 0 );
+	}
+
+	if( scenes.empty() ) {
+		std::cerr << "Unknown scene " << options.scene << "\n";
+		return 1;
+	}
+
+	if( options.output.empty() ) {
+		WriteResults( std::cout, scenes, options, sfgui.GetRenderer().GetName(), gl_renderer ? gl_renderer : "" );
+		return 0;
+	}
+
+	std::ofstream file( options.output );
+
+	if( !file.good() ) {
+		std::cerr << "Failed to open " << options.output << "\n";
+		return 1;
+	}
+
+	WriteResults( file, scenes, options, sfgui.GetRenderer().GetName(), gl_renderer ? gl_renderer : "" );
+
+	return 0;
+}
@@ -0,0 +1,120 @@
+// Always include the necessary header files.
+// Including SFGUI/Widgets.hpp includes everything
+// you can possibly need automatically.
+#include <SFGUI/SFGUI.hpp>
+#include <SFGUI/Widgets.hpp>
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <iostream>
+
+int main() {
+	// Create the main SFML window
+	sf::RenderWindow app_window( sf::VideoMode( { 800, 600 } ), "SFGUI Concurrent Layout Example", sf::Style::Titlebar | sf::Style::Close );
+
+	// We have to do this because we don't use SFML to draw.
+	app_window.resetGLStates();
+
+	// Create an SFGUI. This is required before doing anything with SFGUI.
+	sfg::SFGUI sfgui;
+
+	// Create our main SFGUI window
+	auto window = sfg::Window::Create();
+	window->SetTitle( "Concurrent Layout" );
+
+	// Create a dashboard of 100 panels with 100 labels each.
+	auto panels = sfg::Box::Create( sfg::Box::Orientation::VERTICAL, 5.f );
+
+	for( int panel_index = 0; panel_index < 100; ++panel_index ) {
+		auto box = sfg::Box::Create( sfg::Box::Orientation::VERTICAL );
+
+		for( int label_index = 0; label_index < 100; ++label_index ) {
+			box->Pack( sfg::Label::Create( "Sensor " + std::to_string( panel_index ) + "." + std::to_string( label_index ) + ": " + std::to_string( panel_index * label_index ) + " units" ) );
+		}
+
+		auto frame = sfg::Frame::Create( "Panel " + std::to_string( panel_index ) );
+		frame->Add( box );
+
+		panels->Pack( frame );
+	}
+
+	auto scrolled_window = sfg::ScrolledWindow::Create();
+	scrolled_window->SetScrollbarPolicy( sfg::ScrolledWindow::HORIZONTAL_AUTOMATIC | sfg::ScrolledWindow::VERTICAL_ALWAYS );
+	scrolled_window->AddWithViewport( panels );
+
+	// Always remember to set the minimum size of a ScrolledWindow.
+	scrolled_window->SetRequisition( sf::Vector2f( 500.f, 400.f ) );
+
+	window->Add( scrolled_window );
+
+	window->Update( 0.f );
+
+	// Measure refreshing the whole hierarchy, e.g. after a theme change.
+	// The label_dashboard scene of sfgui-bench measures the same hierarchy
+	// over many runs and can be compared with the results of earlier builds.
+	auto measure = [&window] {
+		// Warm up the text metrics caches.
+		window->Refresh();
+
+		sf::Clock clock;
+
+		for( int run = 0; run < 5; ++run ) {
+			window->Refresh();
+		}
+
+		return clock.getElapsedTime().asMicroseconds() / 5;
+	};
+
+	auto worker_count = std::max( 1u, std::thread::hardware_concurrency() ) - 1;
+
+	auto serial_time = measure();
+
+	sfg::Context::Get().SetConcurrentLayout( true );
+
+	auto single_pass_time = measure();
+
+	sfg::Context::Get().SetWorkerThreadCount( worker_count );
+
+	auto concurrent_time = measure();
+
+	std::cout << "Refreshing 10000 labels\n";
+	std::cout << "Child by child: " << serial_time << " us\n";
+	std::cout << "Single pass: " << single_pass_time << " us\n";
+	std::cout << "Single pass, " << worker_count << " worker threads: " << concurrent_time << " us\n";
+	std::cout << "Speedup over single pass: " << static_cast<float>( single_pass_time ) / static_cast<float>( std::max<std::int64_t>( concurrent_time, 1 ) ) << "x\n";
+	std::cout << "Speedup over child by child: " << static_cast<float>( serial_time ) / static_cast<float>( std::max<std::int64_t>( concurrent_time, 1 ) ) << "x\n";
+
+	sf::Clock clock;
+
+	// Start the game loop
+	while ( app_window.isOpen() ) {
+		// Process events
+		while ( const std::optional event = app_window.pollEvent() ) {
+			// Handle events
+			window->HandleEvent( *event );
+
+			// Close window : exit
+			if ( event->is<sf::Event::Closed>() ) {
+				return 0;
+			}
+		}
+
+		// Update the GUI, note that you shouldn't normally
+		// pass 0 seconds to the update method.
+		window->Update( clock.restart().asSeconds() );
+
+		// Clear screen
+		app_window.clear();
+
+		// Draw the GUI
+		sfgui.Display( app_window );
+
+		// Update the window
+		app_window.display();
+	}
+
+	return 0;
+}
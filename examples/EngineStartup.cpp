@@ -0,0 +1,99 @@
+// Always include the necessary header files.
+#include <SFGUI/SFGUI.hpp>
+#include <SFGUI/Engines/BREW.hpp>
+#include <SFGUI/Widgets.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Clock.hpp>
+#include <string>
+#include <iostream>
+
+int main() {
+	// Create an SFGUI. This is required before doing anything with SFGUI.
+	sfg::SFGUI sfgui;
+
+	// Constructing BREW sets all of its default properties.
+	const int runs = 100;
+
+	sf::Clock clock;
+
+	for( int run = 0; run < runs; ++run ) {
+		sfg::eng::BREW engine;
+	}
+
+	auto construction_time = clock.restart().asMicroseconds() / runs;
+
+	// Setting properties through a theme snippet parses the whole snippet.
+	sfg::eng::BREW engine;
+
+	for( int run = 0; run < runs; ++run ) {
+		engine.SetProperties( "Button { Padding: 5; }" );
+	}
+
+	auto snippet_time = clock.restart().asMicroseconds();
+
+	// Setting typed properties only parses the selector once.
+	for( int run = 0; run < runs; ++run ) {
+		engine.SetProperty( "Button", "Padding", 5.f );
+	}
+
+	auto typed_time = clock.restart().asMicroseconds();
+
+	// Every property set on a desktop refreshes all of its widgets,
+	// unless the properties are set during a theme update.
+	sfg::Desktop desktop;
+
+	auto box = sfg::Box::Create( sfg::Box::Orientation::VERTICAL );
+
+	for( int index = 0; index < 1000; ++index ) {
+		box->Pack( sfg::Label::Create( "Label " + std::to_string( index ) ) );
+	}
+
+	auto window = sfg::Window::Create();
+	window->Add( box );
+
+	desktop.Add( window );
+
+	clock.restart();
+
+	for( int run = 0; run < runs; ++run ) {
+		desktop.SetProperty( "Label", "FontSize", 12u + static_cast<unsigned int>( run % 2 ) );
+	}
+
+	auto desktop_time = clock.restart().asMicroseconds();
+
+	{
+		sfg::Desktop::ThemeUpdate theme_update( desktop );
+
+		for( int run = 0; run < runs; ++run ) {
+			desktop.SetProperty( "Label", "FontSize", 12u + static_cast<unsigned int>( run % 2 ) );
+		}
+	}
+
+	auto theme_update_time = clock.restart().asMicroseconds();
+
+	// Colors can't change the size of widgets, only
+	// labels are invalidated and nothing is resized.
+	for( int run = 0; run < runs; ++run ) {
+		desktop.SetProperty( "Label", "Color", ( run % 2 ) ? sf::Color::White : sf::Color::Yellow );
+	}
+
+	auto color_time = clock.restart().asMicroseconds();
+
+	// Buttons aren't affected at all.
+	for( int run = 0; run < runs; ++run ) {
+		desktop.SetProperty( "Button", "FontSize", 12u + static_cast<unsigned int>( run % 2 ) );
+	}
+
+	auto unaffected_time = clock.restart().asMicroseconds();
+
+	std::cout << "BREW construction: " << construction_time << " us\n";
+	std::cout << runs << " properties set through theme snippets: " << snippet_time << " us\n";
+	std::cout << runs << " typed properties set: " << typed_time << " us\n";
+	std::cout << runs << " properties set on a desktop with 1000 labels: " << desktop_time << " us\n";
+	std::cout << runs << " properties set on a desktop with 1000 labels in a theme update: " << theme_update_time << " us\n";
+	std::cout << runs << " label colors set on a desktop with 1000 labels: " << color_time << " us\n";
+	std::cout << runs << " button properties set on a desktop with 1000 labels: " << unaffected_time << " us\n";
+
+	return 0;
+}
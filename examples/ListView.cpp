@@ -0,0 +1,100 @@
+// Always include the necessary header files.
+// Including SFGUI/Widgets.hpp includes everything
+// you can possibly need automatically.
+#include <SFGUI/SFGUI.hpp>
+#include <SFGUI/Widgets.hpp>
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <iostream>
+
+int main() {
+	// Create the main SFML window
+	sf::RenderWindow app_window( sf::VideoMode( { 800, 600 } ), "SFGUI ListView Example", sf::Style::Titlebar | sf::Style::Close );
+
+	// We have to do this because we don't use SFML to draw.
+	app_window.resetGLStates();
+
+	// Create an SFGUI. This is required before doing anything with SFGUI.
+	sfg::SFGUI sfgui;
+
+	// Create our main SFGUI window
+	auto window = sfg::Window::Create();
+	window->SetTitle( "ListView" );
+
+	// Create a list view. Items are not stored in the list, their
+	// text is generated on demand for the rows that are visible.
+	auto list_view = sfg::ListView::Create( [] ( sfg::ListView::IndexType index ) {
+		return sf::String( "Item " + std::to_string( index ) );
+	} );
+
+	// Create the ScrolledWindow the list scrolls in.
+	auto scrolled_window = sfg::ScrolledWindow::Create();
+	scrolled_window->SetScrollbarPolicy( sfg::ScrolledWindow::HORIZONTAL_NEVER | sfg::ScrolledWindow::VERTICAL_ALWAYS );
+	scrolled_window->AddWithViewport( list_view );
+
+	// Always remember to set the minimum size of a ScrolledWindow.
+	scrolled_window->SetRequisition( sf::Vector2f( 300.f, 400.f ) );
+
+	window->Add( scrolled_window );
+
+	// Scroll through lists of growing size and measure how long a frame takes.
+	// Since only the visible rows exist, the frame time does not depend on the
+	// number of items in the list.
+	const int frames = 500;
+	auto adjustment = scrolled_window->GetVerticalAdjustment();
+
+	for( sfg::ListView::IndexType count = 1000; count <= 10000000; count *= 10 ) {
+		list_view->SetItemCount( count );
+		adjustment->SetValue( 0.f );
+
+		window->Update( 0.f );
+
+		sf::Clock clock;
+
+		for( int frame = 0; frame < frames; ++frame ) {
+			adjustment->SetValue( adjustment->GetValue() + ( adjustment->GetUpper() - adjustment->GetPageSize() ) / static_cast<float>( frames ) );
+
+			window->Update( 0.f );
+
+			app_window.clear();
+			sfgui.Display( app_window );
+			app_window.display();
+		}
+
+		auto microseconds = clock.getElapsedTime().asMicroseconds() / frames;
+
+		std::cout << count << " items: " << microseconds << " us per frame, " << list_view->GetRowCount() << " rows\n";
+	}
+
+	sf::Clock clock;
+
+	// Start the game loop
+	while ( app_window.isOpen() ) {
+		// Process events
+		while ( const std::optional event = app_window.pollEvent() ) {
+			// Handle events
+			window->HandleEvent( *event );
+
+			// Close window : exit
+			if ( event->is<sf::Event::Closed>() ) {
+				return 0;
+			}
+		}
+
+		// Update the GUI, note that you shouldn't normally
+		// pass 0 seconds to the update method.
+		window->Update( clock.restart().asSeconds() );
+
+		// Clear screen
+		app_window.clear();
+
+		// Draw the GUI
+		sfgui.Display( app_window );
+
+		// Update the window
+		app_window.display();
+	}
+
+	return 0;
+}
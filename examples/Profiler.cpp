@@ -0,0 +1,73 @@
+#include <SFGUI/SFGUI.hpp>
+#include <SFGUI/Widgets.hpp>
+
+#include <SFML/Graphics.hpp>
+#include <string>
+
+int main() {
+	// Create SFML's window.
+	sf::RenderWindow render_window( sf::VideoMode( { 800, 600 } ), "Profiler" );
+
+	// Create an SFGUI. This is required before doing anything with SFGUI.
+	sfg::SFGUI sfgui;
+
+	// The profiler is only available if SFGUI was built with
+	// SFGUI_ENABLE_PROFILER and has to be enabled at runtime.
+	sfg::Profiler::SetEnabled( true );
+
+	// Something to profile: Labels that change every frame.
+	auto labels = sfg::Box::Create( sfg::Box::Orientation::VERTICAL, 5.f );
+
+	for( int index = 0; index < 20; ++index ) {
+		labels->Pack( sfg::Label::Create() );
+	}
+
+	auto window = sfg::Window::Create();
+	window->SetTitle( "Busy window" );
+	window->Add( labels );
+
+	// The overlay shows the average of the frames in the profiler's history.
+	auto overlay_window = sfg::Window::Create( sfg::Window::BACKGROUND );
+	overlay_window->Add( sfg::ProfilerOverlay::Create() );
+	overlay_window->SetPosition( sf::Vector2f( 500.f, 0.f ) );
+
+	sfg::Desktop desktop;
+	desktop.Add( window );
+	desktop.Add( overlay_window );
+
+	// We're not using SFML to render anything in this program, so reset OpenGL
+	// states. Otherwise we wouldn't see anything.
+	render_window.resetGLStates();
+
+	// Main loop!
+	sf::Clock clock;
+	auto frame = 0u;
+
+	while( render_window.isOpen() ) {
+		// Event processing.
+		while( const std::optional event = render_window.pollEvent() ) {
+			desktop.HandleEvent( *event );
+
+			// If window is about to be closed, leave program.
+			if( event->is<sf::Event::Closed>() ) {
+				return 0;
+			}
+		}
+
+		++frame;
+
+		for( const auto& label : labels->GetChildren() ) {
+			std::static_pointer_cast<sfg::Label>( label )->SetText( "Frame " + std::to_string( frame ) );
+		}
+
+		// Update SFGUI with elapsed seconds since last call.
+		desktop.Update( clock.restart().asSeconds() );
+
+		// Rendering, this also ends the profiled frame.
+		render_window.clear();
+		sfgui.Display( render_window );
+		render_window.display();
+	}
+
+	return 0;
+}
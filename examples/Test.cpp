@@ -28,6 +28,7 @@ class SampleApp {
 		void OnToggleSpaceClick();
 		void OnLimitCharsToggle();
 		void OnLoadThemeClick();
+		void OnWatchThemeClick();
 		void OnAdjustmentChange();
 		void OnToggleSpinner();
 		void OnMirrorImageClick();
@@ -236,6 +237,7 @@ void SampleApp::Run() {
 	auto btntoggleori = sfg::Button::Create( L"Box Orientation" );
 	auto btntogglespace = sfg::Button::Create( L"Box Spacing" );
 	auto btnloadstyle = sfg::Button::Create( L"Load theme" );
+	auto btnwatchstyle = sfg::Button::Create( L"Watch theme" );
 
 	m_entry = sfg::Entry::Create( L"Type" );
 	m_entry->SetRequisition( sf::Vector2f( 100.f, .0f ) );
@@ -265,6 +267,7 @@ void SampleApp::Run() {
 	boxtoolbar2->Pack( btntoggleori, false );
 	boxtoolbar2->Pack( btntogglespace, false );
 	boxtoolbar2->Pack( btnloadstyle, false );
+	boxtoolbar2->Pack( btnwatchstyle, false );
 
 	m_boxbuttonsh = sfg::Box::Create( sfg::Box::Orientation::HORIZONTAL );
 	m_boxbuttonsh->SetSpacing( 5.f );
@@ -463,6 +466,7 @@ void SampleApp::Run() {
 	btntogglespace->GetSignal( sfg::Widget::OnLeftClick ).Connect( [this] { OnToggleSpaceClick(); } );
 	m_limit_check->GetSignal( sfg::ToggleButton::OnToggle ).Connect( [this] { OnLimitCharsToggle(); } );
 	btnloadstyle->GetSignal( sfg::Widget::OnLeftClick ).Connect( [this] { OnLoadThemeClick(); } );
+	btnwatchstyle->GetSignal( sfg::Widget::OnLeftClick ).Connect( [this] { OnWatchThemeClick(); } );
 	m_scale->GetAdjustment()->GetSignal( sfg::Adjustment::OnChange ).Connect( [this] { OnAdjustmentChange(); } );
 	spinner_toggle->GetSignal( sfg::Widget::OnLeftClick ).Connect( [this] { OnToggleSpinner(); } );
 	mirror_image->GetSignal( sfg::Widget::OnLeftClick ).Connect( [this] { OnMirrorImageClick(); } );
@@ -687,6 +691,11 @@ void SampleApp::OnLoadThemeClick() {
 	m_desktop.LoadThemeFromFile( "data/example.theme" );
 }
 
+void SampleApp::OnWatchThemeClick() {
+	// Reload the theme whenever it is edited.
+	m_desktop.WatchThemeFile( "data/example.theme" );
+}
+
 void SampleApp::OnAdjustmentChange() {
 	m_progress->SetFraction( m_scale->GetValue() / 100.f );
 	m_progress_vert->SetFraction( m_scale->GetValue() / 100.f );
@@ -0,0 +1,111 @@
+// Always include the necessary header files.
+// Including SFGUI/Widgets.hpp includes everything
+// you can possibly need automatically.
+#include <SFGUI/SFGUI.hpp>
+#include <SFGUI/Widgets.hpp>
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <iostream>
+
+int main() {
+	// Create the main SFML window
+	sf::RenderWindow app_window( sf::VideoMode( { 800, 600 } ), "SFGUI TreeView Example", sf::Style::Titlebar | sf::Style::Close );
+
+	// We have to do this because we don't use SFML to draw.
+	app_window.resetGLStates();
+
+	// Create an SFGUI. This is required before doing anything with SFGUI.
+	sfg::SFGUI sfgui;
+
+	// Create our main SFGUI window
+	auto window = sfg::Window::Create();
+	window->SetTitle( "TreeView" );
+
+	auto tree_view = sfg::TreeView::Create();
+
+	// Children are only created when a node is expanded for the first time.
+	tree_view->SetPopulateCallback( [&tree_view] ( sfg::TreeView::NodeID node ) {
+		for( int index = 0; index < 10; ++index ) {
+			tree_view->AppendNode( node, tree_view->GetNodeText( node ) + "." + std::to_string( index ), true );
+		}
+	} );
+
+	// Create a tree with 1M nodes. Expanding and collapsing a node
+	// only costs as much as its visible descendants and the rows
+	// on screen, no matter how big the rest of the tree is.
+	for( int index = 0; index < 1000; ++index ) {
+		auto node = tree_view->AppendNode( sfg::TreeView::ROOT, "Group " + std::to_string( index ) );
+
+		for( int child = 0; child < 999; ++child ) {
+			tree_view->AppendNode( node, "Item " + std::to_string( index ) + "." + std::to_string( child ) );
+		}
+	}
+
+	auto first_group = tree_view->GetChildren( sfg::TreeView::ROOT ).front();
+
+	// Nodes below are populated lazily.
+	for( int index = 0; index < 10; ++index ) {
+		tree_view->AppendNode( sfg::TreeView::ROOT, "Node " + std::to_string( index ), true );
+	}
+
+	// Create the ScrolledWindow the tree scrolls in.
+	auto scrolled_window = sfg::ScrolledWindow::Create();
+	scrolled_window->SetScrollbarPolicy( sfg::ScrolledWindow::HORIZONTAL_AUTOMATIC | sfg::ScrolledWindow::VERTICAL_ALWAYS );
+	scrolled_window->AddWithViewport( tree_view );
+
+	// Always remember to set the minimum size of a ScrolledWindow.
+	scrolled_window->SetRequisition( sf::Vector2f( 300.f, 400.f ) );
+
+	window->Add( scrolled_window );
+
+	window->Update( 0.f );
+
+	// Measure expanding and collapsing the first group including the following update.
+	for( int run = 0; run < 5; ++run ) {
+		sf::Clock clock;
+
+		tree_view->Expand( first_group );
+		window->Update( 0.f );
+
+		auto expand_time = clock.restart().asMicroseconds();
+
+		tree_view->Collapse( first_group );
+		window->Update( 0.f );
+
+		auto collapse_time = clock.restart().asMicroseconds();
+
+		std::cout << "Expand: " << expand_time << " us, collapse: " << collapse_time << " us\n";
+	}
+
+	sf::Clock clock;
+
+	// Start the game loop
+	while ( app_window.isOpen() ) {
+		// Process events
+		while ( const std::optional event = app_window.pollEvent() ) {
+			// Handle events
+			window->HandleEvent( *event );
+
+			// Close window : exit
+			if ( event->is<sf::Event::Closed>() ) {
+				return 0;
+			}
+		}
+
+		// Update the GUI, note that you shouldn't normally
+		// pass 0 seconds to the update method.
+		window->Update( clock.restart().asSeconds() );
+
+		// Clear screen
+		app_window.clear();
+
+		// Draw the GUI
+		sfgui.Display( app_window );
+
+		// Update the window
+		app_window.display();
+	}
+
+	return 0;
+}
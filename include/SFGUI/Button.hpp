@@ -54,7 +54,9 @@ class SFGUI_API Button : public Bin {
 		Button() = default;
 
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
 
 		bool HandleAdd( Widget::Ptr child ) override;
 
@@ -98,6 +98,8 @@ class SFGUI_API Canvas : public Widget {
 
 		void HandleSizeChange() override;
 
+		void HandleTransformUpdate() override;
+
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
 
 	private:
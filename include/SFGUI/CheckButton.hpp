@@ -27,6 +27,7 @@ class SFGUI_API CheckButton : public ToggleButton {
 
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
 		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
 		void HandleSizeChange() override;
 };
 
@@ -51,6 +51,12 @@ class SFGUI_API ComboBox : public Bin {
 		 */
 		void AppendItem( const sf::String& text );
 
+		/** Append items.
+		 * Appending many items at once only resizes the combo box once.
+		 * @param texts Item texts.
+		 */
+		void AppendItems( const std::vector<sf::String>& texts );
+
 		/** Insert item.
 		 * Indices lie in the range [0, GetItemCount() - 1].
 		 * @param index Item index.
@@ -130,6 +136,7 @@ class SFGUI_API ComboBox : public Bin {
 		ComboBox();
 
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
 
 	private:
@@ -140,13 +147,19 @@ class SFGUI_API ComboBox : public Bin {
 		void HandleStateChange( State old_state ) override;
 		void HandleUpdate( float seconds ) override;
 		void ChangeStartEntry();
+		void MeasureItems( std::size_t begin, std::size_t end );
+		void UpdateRequisition( float old_max_entry_width );
 
 		std::shared_ptr<Scrollbar> m_scrollbar;
 
 		IndexType m_active_item;
 		IndexType m_highlighted_item;
 		std::vector<sf::String> m_entries;
+		std::vector<float> m_entry_widths;
 		IndexType m_start_entry;
+		float m_max_entry_width;
+		std::string m_measured_font_name;
+		unsigned int m_measured_font_size;
 };
 
 /** Get a const iterator pointing to the first item of the ComboBox.
@@ -57,6 +57,8 @@ class SFGUI_API Container : public Widget {
 		 */
 		void HandleAbsolutePositionChange() override;
 
+		void CollectConcurrentInvalidations( std::vector<Widget*>& widgets ) override;
+
 	protected:
 		/** Handle adding children.
 		 * @param child Child widget.
@@ -85,8 +87,14 @@ class SFGUI_API Container : public Widget {
 		 */
 		void HandleViewportUpdate() override;
 
+		/** Handle transform change.
+		 */
+		void HandleTransformUpdate() override;
+
 	private:
 		WidgetsList m_children;
+
+		mutable bool m_children_invalidated = true;
 };
 
 }
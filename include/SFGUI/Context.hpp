@@ -13,6 +13,10 @@ namespace eng {
 class BREW;
 }
 
+namespace priv {
+class ThreadPool;
+}
+
 /** GUI context.
  * A context saves several semi-global information for widgets, such as the
  * used rendering engine.
@@ -77,9 +81,45 @@ class SFGUI_API Context {
 		 */
 		std::shared_ptr<Widget> GetActiveWidget() const;
 
+		/** Set the number of worker threads used to build the drawables of invalidated widgets.
+		 * When many widgets are invalidated at once, e.g. after a theme change, their
+		 * drawables are built concurrently on the worker threads during Widget::Update().
+		 * @param count Number of worker threads, 0 to build all drawables on the calling thread (default).
+		 */
+		void SetWorkerThreadCount( unsigned int count );
+
+		/** Get the number of worker threads used to build the drawables of invalidated widgets.
+		 * @return Number of worker threads, 0 if all drawables are built on the calling thread.
+		 */
+		unsigned int GetWorkerThreadCount() const;
+
+		/** Enable or disable concurrent layout.
+		 * When enabled, refreshing a large hierarchy, e.g. after a theme change,
+		 * measures all its widgets in a single pass, the childless ones concurrently
+		 * on the worker threads if there are any, and allocates the hierarchy once.
+		 * @param enable true to enable concurrent layout (default: false).
+		 */
+		void SetConcurrentLayout( bool enable );
+
+		/** Check if concurrent layout is enabled.
+		 * @return true if concurrent layout is enabled.
+		 */
+		bool IsConcurrentLayoutEnabled() const;
+
+		/// @cond
+
+		/** Get the thread pool of this context.
+		 * @return Thread pool or nullptr if no worker threads are used.
+		 */
+		priv::ThreadPool* GetThreadPool() const;
+
+		/// @endcond
+
 	private:
 		Engine* m_engine;
 		std::weak_ptr<Widget> m_active_widget;
+		std::shared_ptr<priv::ThreadPool> m_thread_pool;
+		bool m_concurrent_layout;
 };
 
 }
@@ -23,6 +23,14 @@ class Widget;
  */
 class SFGUI_API Desktop {
 	public:
+		/** Ctor.
+		 */
+		Desktop();
+
+		/** Dtor.
+		 */
+		~Desktop();
+
 		/** Use a custom engine.
 		 */
 		template <class T>
@@ -78,8 +86,8 @@ class SFGUI_API Desktop {
 		void RemoveAll();
 
 		/** Refresh all widgets.
-		 * All widgets will invalidate and re-request size. This is done
-		 * automagically in SetProperty().
+		 * All widgets will invalidate and re-request size. Changing properties
+		 * automagically refreshes all widgets whose style changed.
 		 */
 		void Refresh();
 
@@ -89,6 +97,53 @@ class SFGUI_API Desktop {
 		 */
 		bool LoadThemeFromFile( const std::string& filename );
 
+		/** Load a style from file and reload it whenever the file changes.
+		 * The modification time of the file is polled in Update(). Properties
+		 * that are removed from the file keep their last value. Only one file
+		 * can be watched at a time.
+		 * @param filename Filename.
+		 * @param interval Time between checks for modifications in seconds.
+		 * @return true if the style could be loaded, false otherwise. The file is watched in either case.
+		 */
+		bool WatchThemeFile( const std::string& filename, float interval = .5f );
+
+		/** Stop watching the style file.
+		 */
+		void StopWatchingThemeFile();
+
+		/** Begin a theme update.
+		 * Properties set until the matching call to EndThemeUpdate() are
+		 * applied at once and widgets are only refreshed when the update ends.
+		 * Theme updates can be nested.
+		 */
+		void BeginThemeUpdate();
+
+		/** End a theme update.
+		 * When the outermost theme update ends, all collected properties are
+		 * applied and all widgets are refreshed once.
+		 */
+		void EndThemeUpdate();
+
+		/** Begins a theme update on construction and ends it on destruction.
+		 */
+		class ThemeUpdate {
+			public:
+				/** Ctor.
+				 * @param desktop Desktop to update the theme of.
+				 */
+				explicit ThemeUpdate( Desktop& desktop );
+
+				/** Dtor.
+				 */
+				~ThemeUpdate();
+
+				ThemeUpdate( const ThemeUpdate& ) = delete;
+				ThemeUpdate& operator=( const ThemeUpdate& ) = delete;
+
+			private:
+				Desktop& m_desktop;
+		};
+
 		/** Get engine.
 		 * @return Engine.
 		 */
@@ -102,8 +157,12 @@ class SFGUI_API Desktop {
 	private:
 		typedef std::deque<std::shared_ptr<Widget>> WidgetsList;
 
+		struct ThemeWatch;
+
 		void SendFakeMouseMoveEvent( std::shared_ptr<Widget> widget, int x = -1337, int y = -1337 ) const;
 		void RecalculateWidgetLevels();
+		void RefreshAfterThemeChange();
+		void CheckWatchedThemeFile( float seconds );
 
 		mutable Context m_context;
 		std::unique_ptr<Engine> m_engine;
@@ -112,6 +171,11 @@ class SFGUI_API Desktop {
 		std::weak_ptr<Widget> m_last_receiver;
 
 		sf::Vector2i m_last_mouse_pos;
+
+		unsigned int m_theme_update_depth = 0;
+		bool m_refresh_pending = false;
+
+		std::unique_ptr<ThemeWatch> m_theme_watch;
 };
 
 }
@@ -9,12 +9,17 @@ void Desktop::UseEngine() {
 
 template <typename T>
 bool Desktop::SetProperty( const std::string& selector, const std::string& property, const T& value ) {
-	if( !m_context.GetEngine().SetProperty( selector, property, value ) ) {
-		return false;
+	Context::Activate( m_context );
+
+	auto result = m_context.GetEngine().SetProperty( selector, property, value );
+
+	if( result ) {
+		RefreshAfterThemeChange();
 	}
 
-	Refresh();
-	return true;
+	Context::Deactivate();
+
+	return result;
 }
 
 template <typename T>
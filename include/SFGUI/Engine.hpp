@@ -10,6 +10,8 @@
 #include <vector>
 #include <stdexcept>
 #include <memory>
+#include <mutex>
+#include <any>
 #include <cstdint>
 
 namespace sf {
@@ -41,6 +43,7 @@ class Notebook;
 class Spinner;
 class ComboBox;
 class SpinButton;
+class TreeViewRow;
 
 class Selector;
 class RenderQueue;
@@ -59,6 +62,14 @@ class SFGUI_API Engine {
 	public:
 		typedef std::runtime_error BadValueException; //<! Thrown when value can't be converted to or from string.
 
+		/** How the style of a widget changed.
+		 */
+		enum class StyleChange : char {
+			NONE = 0, //!< Style didn't change.
+			APPEARANCE, //!< Only properties changed that can't affect the size of the widget, e.g. colors.
+			SIZE //!< Properties changed that might affect the size of the widget.
+		};
+
 		/** Dtor.
 		 */
 		virtual ~Engine() = default;
@@ -165,6 +176,12 @@ class SFGUI_API Engine {
 		 */
 		virtual std::unique_ptr<RenderQueue> CreateSpinButtonDrawable( std::shared_ptr<const SpinButton> spinbutton ) const = 0;
 
+		/** Create drawable for tree view row widgets.
+		 * @param row Widget.
+		 * @return New drawable object (unmanaged memory!).
+		 */
+		virtual std::unique_ptr<RenderQueue> CreateTreeViewRowDrawable( std::shared_ptr<const TreeViewRow> row ) const = 0;
+
 		/** Get maximum line height.
 		 * @param font Font.
 		 * @param font_size Font size.
@@ -188,6 +205,7 @@ class SFGUI_API Engine {
 		float GetFontLineSpacing( const sf::Font& font, unsigned int font_size ) const;
 
 		/** Get metrics of a text string.
+		 * Uses the distance field glyph metrics if the renderer draws distance field text.
 		 * @param string String.
 		 * @param font Font.
 		 * @param font_size Font size.
@@ -196,6 +214,7 @@ class SFGUI_API Engine {
 		sf::Vector2f GetTextStringMetrics( const std::u32string& string, const sf::Font& font, unsigned int font_size ) const;
 
 		/** Get metrics of a text string.
+		 * Uses the distance field glyph metrics if the renderer draws distance field text.
 		 * @param string String.
 		 * @param font Font.
 		 * @param font_size Font size.
@@ -261,6 +280,79 @@ class SFGUI_API Engine {
 		 */
 		bool LoadThemeFromString( const std::string& data );
 
+		/** Compile the current properties to a binary theme.
+		 * Compiled themes contain the resolved selectors including their scores
+		 * and hashes and can be loaded without parsing. They are only meant to be
+		 * loaded by the same build of SFGUI on the same platform.
+		 * @return Compiled theme.
+		 */
+		std::vector<char> CompileTheme() const;
+
+		/** Load a compiled theme, replacing all current properties.
+		 * The data is only read during the call, it can e.g. be memory-mapped
+		 * from a file that is unmapped afterwards.
+		 * @param data Compiled theme data.
+		 * @param size Size of data in bytes.
+		 * @return true on success, false if the data is no valid compiled theme.
+		 */
+		bool LoadCompiledTheme( const void* data, std::size_t size );
+
+		/** Load a compiled theme from file, replacing all current properties.
+		 * @param filename Filename.
+		 * @return true on success, false otherwise.
+		 */
+		bool LoadCompiledThemeFromFile( const std::string& filename );
+
+		/** Begin a theme update.
+		 * Properties set until the matching call to EndThemeUpdate() are
+		 * collected and only applied to the theme when the update ends, widgets
+		 * are refreshed once instead of after every property. Until then,
+		 * GetProperty() still returns the previous values. Theme updates can be
+		 * nested, only the outermost update applies the properties.
+		 */
+		void BeginThemeUpdate();
+
+		/** End a theme update.
+		 * When the outermost theme update ends, all collected properties are
+		 * applied and widgets are refreshed if automatic refreshing is enabled.
+		 */
+		void EndThemeUpdate();
+
+		/** Begins a theme update on construction and ends it on destruction.
+		 */
+		class ThemeUpdate {
+			public:
+				/** Ctor.
+				 * @param engine Engine to update the theme of.
+				 */
+				explicit ThemeUpdate( Engine& engine );
+
+				/** Dtor.
+				 */
+				~ThemeUpdate();
+
+				ThemeUpdate( const ThemeUpdate& ) = delete;
+				ThemeUpdate& operator=( const ThemeUpdate& ) = delete;
+
+			private:
+				Engine& m_engine;
+		};
+
+		/** Get how the style of a widget changed since the last ClearStyleChanges().
+		 * Only properties whose value for the widget differs count as changed.
+		 * Colors, alphas and other properties known to only be used when drawing
+		 * or animating widgets don't affect their size. Changes of all other
+		 * properties, including those of custom engines, count as size changes.
+		 * @param widget Widget.
+		 * @return Style change.
+		 */
+		StyleChange GetStyleChange( std::shared_ptr<const Widget> widget ) const;
+
+		/** Forget all property changes.
+		 * Call this after refreshing all widgets whose style changed.
+		 */
+		void ClearStyleChanges();
+
 		/** Shift the given border colors to make them lighter and darker.
 		 * @param light_color Color of the lighter border.
 		 * @param dark_color Color of the darker border.
@@ -282,6 +374,26 @@ class SFGUI_API Engine {
 		 */
 		void AddCharacterSet( std::uint32_t low_bound, std::uint32_t high_bound );
 
+		/// @cond
+
+		/** Get the mutex that serializes access to fonts.
+		 * sf::Font loads glyphs on demand and is not safe to use from multiple
+		 * threads at once. Lock it before using a font while drawables are
+		 * built concurrently.
+		 * @return Mutex that serializes access to fonts.
+		 */
+		static std::recursive_mutex& GetFontMutex();
+
+		/** Drop the cached text metrics of a font.
+		 * Metrics are cached per font object. Call this before a font that
+		 * was used to measure text is destroyed or replaced, another font
+		 * could be created at the same address.
+		 * @param font Font.
+		 */
+		static void ForgetFontMetrics( const sf::Font& font );
+
+		/// @endcond
+
 	protected:
 		/** Ctor.
 		 */
@@ -293,12 +405,36 @@ class SFGUI_API Engine {
 		void SetAutoRefresh( bool enable );
 
 	private:
-		typedef std::pair<std::shared_ptr<const Selector>, std::string> SelectorValuePair;
+		struct PropertyValue {
+			mutable std::string string; // Built from typed on first use if format is set.
+			std::any typed; // Value as it was set, empty if only known as string.
+			std::string ( *format )( const std::any& ) = nullptr; // Formats typed as string.
+			mutable bool formatted = false;
+		};
+
+		typedef std::pair<std::shared_ptr<const Selector>, PropertyValue> SelectorValuePair;
 		typedef std::vector<SelectorValuePair> SelectorValueList;
 		typedef std::map<const std::string, SelectorValueList> WidgetNameMap;
 		typedef std::map<const std::string, WidgetNameMap> PropertyMap;
 
-		const std::string* GetValue( const std::string& property, std::shared_ptr<const Widget> widget ) const;
+		const PropertyValue* GetValue( const std::string& property, std::shared_ptr<const Widget> widget ) const;
+		static const PropertyValue* FindValue( const WidgetNameMap& widget_names, std::shared_ptr<const Widget> widget );
+
+		template <typename T>
+		static bool MakePropertyValue( const T& value, PropertyValue& property_value );
+
+		template <typename T>
+		static std::string FormatPropertyValue( const std::any& value );
+
+		static const std::string& GetValueString( const PropertyValue& value );
+
+		const std::vector<std::shared_ptr<Selector>>* GetSelectors( const std::string& selector );
+		bool SetPropertyValue( const std::string& selector, const std::string& property, PropertyValue value );
+		bool SetPropertyValue( std::shared_ptr<Selector> selector, const std::string& property, PropertyValue value );
+		void InsertPropertyValue( std::shared_ptr<Selector> selector, const std::string& property, PropertyValue value );
+		void CommitPendingProperties();
+		void RecordStyleChange( const std::string& property );
+		void RefreshWidgets();
 
 		/** Get maximum line height and baseline offset of a font.
 		 * @param font Font.
@@ -311,11 +447,23 @@ class SFGUI_API Engine {
 
 		PropertyMap m_properties;
 
+		// Parsed selector strings, a group of selectors yields multiple selectors.
+		std::map<std::string, std::vector<std::shared_ptr<Selector>>> m_selector_cache;
+
+		// Values of all properties changed since the last refresh, before they changed.
+		PropertyMap m_previous_properties;
+
+		// Properties set during a theme update, in the order they were set.
+		std::vector<std::pair<std::string, SelectorValuePair>> m_pending_properties;
+
 		mutable ResourceManager m_resource_manager;
 
 		std::vector<std::pair<std::uint32_t, std::uint32_t>> m_character_sets;
 
+		unsigned int m_theme_update_depth;
+
 		bool m_auto_refresh;
+		bool m_refresh_pending;
 };
 
 }
@@ -1,6 +1,7 @@
 #include <sstream>
 #include <iomanip>
 #include <typeinfo>
+#include <type_traits>
 
 namespace sfg {
 
@@ -8,7 +9,7 @@ template <typename T>
 T Engine::GetProperty( const std::string& property, std::shared_ptr<const Widget> widget ) const {
 	static const T default_ = T();
 
-	const std::string* value( GetValue( property, widget ) );
+	const PropertyValue* value( GetValue( property, widget ) );
 	if( !value ) {
 		return default_;
 	}
@@ -19,12 +20,19 @@ T Engine::GetProperty( const std::string& property, std::shared_ptr<const Widget
 		// to compile "return *value" for all Ts, which may fail for
 		// GetProperty<int> here, because it would be tried to return a std::string
 		// in this case which fails.
-		return *reinterpret_cast<const T*>( value );
+		return *reinterpret_cast<const T*>( &GetValueString( *value ) );
+	}
+
+	// Values set with the requested type don't need to be converted.
+	auto typed_value = std::any_cast<T>( &value->typed );
+
+	if( typed_value ) {
+		return *typed_value;
 	}
 
 	// Convert value.
 	T out_value;
-	std::istringstream sstr( *value );
+	std::istringstream sstr( GetValueString( *value ) );
 	sstr >> out_value;
 
 	if( sstr.fail() ) {
@@ -32,7 +40,7 @@ T Engine::GetProperty( const std::string& property, std::shared_ptr<const Widget
 		error_message += " Property: " + property;
 		error_message += " Requested type: ";
 		error_message += typeid( T ).name();
-		error_message += " Value: " + *value;
+		error_message += " Value: " + GetValueString( *value );
 		throw BadValueException( error_message );
 	}
 
@@ -41,23 +49,48 @@ T Engine::GetProperty( const std::string& property, std::shared_ptr<const Widget
 
 template <typename T>
 bool Engine::SetProperty( const std::string& selector, const std::string& property, const T& value ) {
-	std::ostringstream properties;
+	PropertyValue property_value;
 
-	properties << selector << " {\n\t" << property << ": " << value << ";\n}";
+	if( !MakePropertyValue( value, property_value ) ) {
+		return false;
+	}
 
-	return SetProperties( properties.str() );
+	return SetPropertyValue( selector, property, std::move( property_value ) );
 }
 
 template <typename T>
 bool Engine::SetProperty( std::shared_ptr<Selector> selector, const std::string& property, const T& value ) {
-	std::ostringstream sstr;
-	sstr << value;
+	PropertyValue property_value;
 
-	if( sstr.fail() ) {
+	if( !MakePropertyValue( value, property_value ) ) {
 		return false;
 	}
 
-	return SetProperty( selector, property, sstr.str() );
+	return SetPropertyValue( selector, property, std::move( property_value ) );
+}
+
+template <typename T>
+bool Engine::MakePropertyValue( const T& value, PropertyValue& property_value ) {
+	// Strings are stored as they are.
+	if constexpr( std::is_convertible<T, std::string>::value ) {
+		property_value.string = value;
+	}
+	else {
+		// The string is only needed if the value is requested as
+		// another type or as string, format it when it first is.
+		property_value.typed = value;
+		property_value.format = &FormatPropertyValue<T>;
+	}
+
+	return true;
+}
+
+template <typename T>
+std::string Engine::FormatPropertyValue( const std::any& value ) {
+	std::ostringstream sstr;
+	sstr << std::any_cast<const T&>( value );
+
+	return sstr.str();
 }
 
 }
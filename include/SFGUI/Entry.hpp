@@ -102,7 +102,9 @@ class SFGUI_API Entry : public Widget {
 		void SetTextMargin( float margin );
 
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
 
 		void HandleMouseButtonEvent( sf::Mouse::Button button, bool press, int x, int y ) override;
 		void HandleUpdate( float seconds ) override;
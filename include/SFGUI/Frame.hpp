@@ -39,6 +39,7 @@ class SFGUI_API Frame : public Bin, public Misc {
 		Frame() = default;
 
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
 
 	private:
@@ -56,7 +56,9 @@ class SFGUI_API Label : public Widget, public Misc {
 		Label( const sf::String& text = "" );
 
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
 		void HandleRequisitionChange() override;
 		void HandleSizeChange() override;
 
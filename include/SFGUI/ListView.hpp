@@ -0,0 +1,131 @@
+#pragma once
+
+#include <SFGUI/Container.hpp>
+
+#include <SFML/System/String.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+namespace sfg {
+
+/** List view.
+ * A list that can hold a very large number of items. Items are not stored
+ * in the list itself, instead a data source callback binds item data to row
+ * widgets on demand. Only rows that intersect the visible area of the list's
+ * viewport are instantiated, and rows that are scrolled out of view are
+ * recycled for the items that are scrolled into view.
+ *
+ * Put the list into a ScrolledWindow (ScrolledWindow::AddWithViewport) to
+ * scroll it. The list polls the visible area of its viewport every update, so
+ * any change of the scrolled window's Adjustment values rebinds the rows.
+ */
+class SFGUI_API ListView : public Container {
+	public:
+		typedef std::shared_ptr<ListView> Ptr; //!< Shared pointer.
+		typedef std::shared_ptr<const ListView> PtrConst; //!< Shared pointer.
+		typedef std::size_t IndexType; //!< Type for item indices.
+		typedef std::function<Widget::Ptr()> RowFactory; //!< Creates a new row widget.
+		typedef std::function<void( Widget::Ptr, IndexType )> RowBinder; //!< Binds the item at the given index to a row widget.
+		typedef std::function<sf::String( IndexType )> TextSource; //!< Returns the text of the item at the given index.
+
+		static const IndexType NONE; //!< Value for specifying an invalid index.
+
+		/** Create list view.
+		 * @param factory Callback creating a new row widget.
+		 * @param binder Callback binding an item to a row widget.
+		 * @return List view.
+		 */
+		static Ptr Create( RowFactory factory, RowBinder binder );
+
+		/** Create list view that displays its items in labels.
+		 * @param text_source Callback returning the text of an item.
+		 * @return List view.
+		 */
+		static Ptr Create( TextSource text_source );
+
+		const std::string& GetName() const override;
+
+		/** Set the number of items in the list.
+		 * @param count Number of items.
+		 */
+		void SetItemCount( IndexType count );
+
+		/** Get the number of items in the list.
+		 * @return Number of items.
+		 */
+		IndexType GetItemCount() const;
+
+		/** Set uniform row height.
+		 * @param height Height of every row. 0 to estimate the height from the requisition of the instantiated rows.
+		 */
+		void SetRowHeight( float height );
+
+		/** Get row height.
+		 * @return Height of every row, either set or estimated.
+		 */
+		float GetRowHeight() const;
+
+		/** Get the range of items that currently have a row bound to them.
+		 * @return Index of the first and one past the last bound item.
+		 */
+		std::pair<IndexType, IndexType> GetVisibleRange() const;
+
+		/** Get the number of instantiated row widgets.
+		 * @return Number of instantiated row widgets.
+		 */
+		std::size_t GetRowCount() const;
+
+		/** Rebind all visible rows, e.g. after the data source changed.
+		 */
+		void RefreshItems();
+
+		/** Rebind the row of a single item if it is visible.
+		 * @param index Item index.
+		 */
+		void RefreshItem( IndexType index );
+
+	protected:
+		/** Ctor.
+		 * @param factory Callback creating a new row widget.
+		 * @param binder Callback binding an item to a row widget.
+		 */
+		ListView( RowFactory factory, RowBinder binder );
+
+		sf::Vector2f CalculateRequisition() override;
+
+		void HandleUpdate( float seconds ) override;
+
+	private:
+		bool HandleAdd( Widget::Ptr child ) override;
+		void HandleRemove( Widget::Ptr child ) override;
+		void HandleSizeChange() override;
+
+		sf::FloatRect GetVisibleRect() const;
+
+		void UpdateRows( bool rebind );
+		void AllocateRow( std::size_t row );
+
+		RowFactory m_factory;
+		RowBinder m_binder;
+
+		std::vector<Widget::Ptr> m_rows;
+		std::vector<IndexType> m_row_items;
+
+		sf::FloatRect m_last_visible_rect;
+
+		IndexType m_item_count;
+		IndexType m_first_visible;
+		IndexType m_last_visible;
+
+		float m_row_height;
+		float m_estimated_row_height;
+		float m_row_width;
+
+		double m_visible_top;
+
+		bool m_adding_row;
+};
+
+}
@@ -178,6 +178,7 @@ class SFGUI_API Notebook : public Container {
 		Notebook();
 
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
 
 	private:
@@ -2,6 +2,7 @@
 
 #include <SFGUI/Config.hpp>
 #include <SFGUI/PrimitiveVertex.hpp>
+#include <SFGUI/PrimitiveInstance.hpp>
 
 #include <SFML/System/Vector2.hpp>
 #include <vector>
@@ -11,6 +12,7 @@ namespace sfg {
 
 class Signal;
 class RendererViewport;
+class RendererTransform;
 class PrimitiveTexture;
 
 /** Renderer primitive.
@@ -34,6 +36,17 @@ class SFGUI_API Primitive {
 		 */
 		void AddVertex( const PrimitiveVertex& vertex );
 
+		/** Add instance to this primitive.
+		 * Instances are drawn after the vertices of the primitive.
+		 * @param instance Instance to add.
+		 */
+		void AddInstance( const PrimitiveInstance& instance );
+
+		/** Expand the instances of this primitive into vertices.
+		 * Used for renderers that can't draw instances.
+		 */
+		void ExpandInstances();
+
 		/** Add texture to this primitive.
 		 * @param texture Texture to add.
 		 */
@@ -59,6 +72,16 @@ class SFGUI_API Primitive {
 		 */
 		std::shared_ptr<RendererViewport> GetViewport() const;
 
+		/** Set transform whose offset is added to this primitive's position.
+		 * @param transform Transform whose offset is added to this primitive's position.
+		 */
+		void SetTransform( std::shared_ptr<RendererTransform> transform );
+
+		/** Get transform whose offset is added to this primitive's position.
+		 * @return Transform whose offset is added to this primitive's position.
+		 */
+		std::shared_ptr<RendererTransform> GetTransform() const;
+
 		/** Set draw layer of this primitive.
 		 * @param layer Draw layer of this primitive.
 		 */
@@ -91,6 +114,11 @@ class SFGUI_API Primitive {
 		 */
 		std::vector<std::shared_ptr<PrimitiveTexture>>& GetTextures();
 
+		/** Get instances in this primitive.
+		 * @return Instances in this primitive.
+		 */
+		const std::vector<PrimitiveInstance>& GetInstances() const;
+
 		/** Get indices in this primitive.
 		 * @return Indices in this primitive.
 		 */
@@ -116,6 +144,18 @@ class SFGUI_API Primitive {
 		 */
 		bool IsVisible() const;
 
+		/** Flag the primitive as opaque.
+		 * Opaque primitives completely hide whatever is drawn behind them.
+		 * Set by the renderer when the primitive is added.
+		 * @param opaque true if the primitive is opaque.
+		 */
+		void SetOpaque( bool opaque );
+
+		/** Is the primitive opaque?.
+		 * @return true when the primitive is opaque.
+		 */
+		bool IsOpaque() const;
+
 		/** Set the function that should be called to render custom GL content.
 		 * @param callback Signal containing the functions to call.
 		 */
@@ -127,23 +167,26 @@ class SFGUI_API Primitive {
 		std::shared_ptr<Signal> GetCustomDrawCallback() const;
 
 		/** Reset the primitive back to its default state.
-		 * This clears all vertices, textures, indices and any other saved values.
+		 * This clears all vertices, instances, textures, indices and any other saved values.
 		 */
 		void Clear();
 
 	private:
 		sf::Vector2f m_position;
 		std::shared_ptr<RendererViewport> m_viewport;
+		std::shared_ptr<RendererTransform> m_transform;
 		std::shared_ptr<Signal> m_custom_draw_callback;
 		int m_layer;
 		int m_level;
 
 		std::vector<PrimitiveVertex> m_vertices;
+		std::vector<PrimitiveInstance> m_instances;
 		std::vector<std::shared_ptr<PrimitiveTexture>> m_textures;
 		std::vector<unsigned int> m_indices;
 
 		bool m_synced;
 		bool m_visible;
+		bool m_opaque;
 };
 
 }
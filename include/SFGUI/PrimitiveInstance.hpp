@@ -0,0 +1,28 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+
+namespace sfg {
+
+/** Primitive instance
+ * Axis aligned rectangle with an optional bevelled border. Renderers
+ * that support instancing expand it on the GPU, all other renderers
+ * get it expanded into vertices.
+ */
+class SFGUI_API PrimitiveInstance {
+public:
+	PrimitiveInstance();
+
+	sf::FloatRect rect; //!< Rectangle covered by the instance.
+	sf::FloatRect texture_rect; //!< Area of the texture atlas mapped onto the rectangle.
+	sf::Color color; //!< Fill color.
+	sf::Color light_border_color; //!< Color of the top and left border.
+	sf::Color dark_border_color; //!< Color of the bottom and right border.
+	float border_width; //!< Width of the border, no border is drawn if 0.
+	bool distance_field; //!< true if the texture holds a signed distance field in its alpha channel.
+};
+
+}
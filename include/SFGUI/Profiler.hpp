@@ -0,0 +1,170 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <array>
+#include <deque>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+namespace sfg {
+
+/** Frame profiler.
+ * Records the time SFGUI spends in its processing phases and counts
+ * renderer related events per frame. Frames end with every call to
+ * SFGUI::Display(). The profiler is only available if SFGUI was built
+ * with SFGUI_ENABLE_PROFILER, otherwise all instrumentation is compiled
+ * out and no frames are recorded. It also has to be enabled at runtime.
+ *
+ * Phase timings are exclusive: Time spent in a phase that was entered
+ * from within another phase, e.g. layout triggered while handling an
+ * event, is only accounted to the inner phase.
+ */
+class SFGUI_API Profiler {
+	public:
+		/** Processing phases.
+		 */
+		enum class Phase : char {
+			HANDLE_EVENT = 0, //!< Dispatching events to widgets.
+			LAYOUT, //!< Calculating requisitions and allocations of widgets.
+			DRAWABLES, //!< Creating the drawables of invalidated widgets.
+			HANDLE_UPDATE, //!< Updating widgets.
+			SORT_PRIMITIVES, //!< Sorting primitives by layer and level.
+			REFRESH_VBO, //!< Building and uploading vertex data.
+			DISPLAY, //!< Drawing.
+			COUNT //!< Number of phases.
+		};
+
+		/** Counters.
+		 */
+		enum class Counter : char {
+			INVALIDATED_WIDGETS = 0, //!< Widgets whose drawable was created.
+			CREATED_PRIMITIVES, //!< Primitives added to the renderer.
+			DESTROYED_PRIMITIVES, //!< Primitives removed from the renderer.
+			UPLOADED_VERTICES, //!< Vertices uploaded to buffer objects.
+			UPLOADED_BYTES, //!< Bytes uploaded to buffer objects.
+			BATCHES, //!< Batches drawn.
+			DRAW_CALLS, //!< Draw calls issued.
+			DRAWN_FRAGMENTS, //!< Fragments drawn by the NonLegacyRenderer in the previous frame, overdraw if more than the covered pixels.
+			COUNT //!< Number of counters.
+		};
+
+		/** Timings and counters of a frame.
+		 */
+		struct SFGUI_API Frame {
+			std::array<float, static_cast<std::size_t>( Phase::COUNT )> timings; //!< Time spent in each phase in microseconds.
+			std::array<std::uint64_t, static_cast<std::size_t>( Counter::COUNT )> counters; //!< Value of each counter.
+
+			/** Ctor.
+			 */
+			Frame();
+
+			/** Get time spent in a phase.
+			 * @param phase Phase.
+			 * @return Time spent in phase in microseconds.
+			 */
+			float GetTiming( Phase phase ) const;
+
+			/** Get the total time spent in all phases.
+			 * @return Total time in microseconds.
+			 */
+			float GetTotalTiming() const;
+
+			/** Get value of a counter.
+			 * @param counter Counter.
+			 * @return Value of counter.
+			 */
+			std::uint64_t GetCount( Counter counter ) const;
+		};
+
+		/** Check if SFGUI was built with the profiler.
+		 * @return true if SFGUI was built with the profiler.
+		 */
+		static bool IsAvailable();
+
+		/** Enable or disable profiling.
+		 * Has no effect if the profiler isn't available.
+		 * @param enable true to enable profiling.
+		 */
+		static void SetEnabled( bool enable );
+
+		/** Check if profiling is enabled.
+		 * @return true if profiling is enabled.
+		 */
+		static bool IsEnabled();
+
+		/** Set the number of frames kept in the history.
+		 * @param size Number of frames, default 120.
+		 */
+		static void SetHistorySize( std::size_t size );
+
+		/** Get the number of frames kept in the history.
+		 * @return Number of frames.
+		 */
+		static std::size_t GetHistorySize();
+
+		/** Get the recorded frames, oldest first.
+		 * @return Recorded frames.
+		 */
+		static const std::deque<Frame>& GetHistory();
+
+		/** Get the average of all recorded frames.
+		 * @return Average frame, all zero if no frames were recorded.
+		 */
+		static Frame GetAverage();
+
+		/** Clear the history and the current frame.
+		 */
+		static void Clear();
+
+		/** End the current frame and add it to the history.
+		 * This is called by SFGUI::Display(), only call this yourself if you
+		 * display through the Renderer directly.
+		 */
+		static void EndFrame();
+
+		/** Get the name of a phase.
+		 * @param phase Phase.
+		 * @return Name of phase.
+		 */
+		static const std::string& GetPhaseName( Phase phase );
+
+		/** Get the name of a counter.
+		 * @param counter Counter.
+		 * @return Name of counter.
+		 */
+		static const std::string& GetCounterName( Counter counter );
+
+		/// @cond
+
+		/** Accounts the time until destruction to a phase.
+		 */
+		class SFGUI_API Scope {
+			public:
+				/** Ctor.
+				 * @param phase Phase.
+				 */
+				explicit Scope( Phase phase );
+
+				/** Dtor.
+				 */
+				~Scope();
+
+				Scope( const Scope& ) = delete;
+				Scope& operator=( const Scope& ) = delete;
+
+			private:
+				bool m_active;
+		};
+
+		/** Add to a counter of the current frame.
+		 * @param counter Counter.
+		 * @param amount Amount to add.
+		 */
+		static void Count( Counter counter, std::uint64_t amount = 1 );
+
+		/// @endcond
+};
+
+}
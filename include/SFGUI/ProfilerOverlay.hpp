@@ -0,0 +1,50 @@
+#pragma once
+
+#include <SFGUI/Label.hpp>
+
+#include <memory>
+
+namespace sfg {
+
+/** Label showing the averaged frame timings and counters of the Profiler.
+ * Profiling has to be enabled separately, see Profiler::SetEnabled().
+ */
+class SFGUI_API ProfilerOverlay : public Label {
+	public:
+		typedef std::shared_ptr<ProfilerOverlay> Ptr; //!< Shared pointer.
+		typedef std::shared_ptr<const ProfilerOverlay> PtrConst; //!< Shared pointer.
+
+		/** Create profiler overlay.
+		 * @param interval Time between updates of the shown values in seconds.
+		 * @return Profiler overlay.
+		 */
+		static Ptr Create( float interval = .5f );
+
+		const std::string& GetName() const override;
+
+		/** Set time between updates of the shown values.
+		 * Updating the text causes a relayout which shows up in the profile.
+		 * @param interval Time between updates in seconds.
+		 */
+		void SetInterval( float interval );
+
+		/** Get time between updates of the shown values.
+		 * @return Time between updates in seconds.
+		 */
+		float GetInterval() const;
+
+	protected:
+		/** Ctor.
+		 * @param interval Time between updates of the shown values in seconds.
+		 */
+		ProfilerOverlay( float interval );
+
+	private:
+		void HandleUpdate( float seconds ) override;
+		void UpdateText();
+
+		float m_interval;
+		float m_elapsed_time;
+};
+
+}
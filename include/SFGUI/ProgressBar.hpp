@@ -51,7 +51,9 @@ class SFGUI_API ProgressBar : public Widget {
 		ProgressBar( Orientation orientation = Orientation::HORIZONTAL );
 
 		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 
 		float m_fraction;
 		Orientation m_orientation;
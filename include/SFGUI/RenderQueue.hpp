@@ -16,6 +16,7 @@ class VertexArray;
 namespace sfg {
 
 class RendererViewport;
+class RendererTransform;
 class Primitive;
 
 /** Simple container for sf::Drawables.
@@ -88,11 +89,23 @@ class SFGUI_API RenderQueue {
 		 */
 		std::shared_ptr<RendererViewport> GetViewport() const;
 
+		/** Set transform of this std::unique_ptr<RenderQueue>.
+		 * The offset of the transform is added to the position of all primitives in this queue.
+		 * @param transform New transform of this std::unique_ptr<RenderQueue>.
+		 */
+		void SetTransform( std::shared_ptr<RendererTransform> transform );
+
+		/** Get transform of this std::unique_ptr<RenderQueue>.
+		 * @return Transform of this std::unique_ptr<RenderQueue>.
+		 */
+		std::shared_ptr<RendererTransform> GetTransform() const;
+
 	private:
 		std::vector<std::shared_ptr<Primitive>> m_primitives;
 
 		sf::Vector2f m_position;
 		std::shared_ptr<RendererViewport> m_viewport;
+		std::shared_ptr<RendererTransform> m_transform;
 
 		int m_z_order;
 		int m_level;
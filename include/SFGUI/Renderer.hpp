@@ -4,10 +4,13 @@
 #include <SFGUI/RendererTextureNode.hpp>
 
 #include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Rect.hpp>
+#include <atomic>
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <cstdint>
@@ -26,10 +29,16 @@ class Image;
 namespace sfg {
 
 class RendererViewport;
+class RendererTransform;
 class Primitive;
 class PrimitiveTexture;
+class PrimitiveInstance;
 class Signal;
 
+namespace priv {
+class DistanceFieldFont;
+}
+
 /** SFGUI Renderer interface.
  */
 class SFGUI_API Renderer {
@@ -39,7 +48,8 @@ class SFGUI_API Renderer {
 			INVALIDATE_COLOR = 1 << 1, //!< Color data needs a sync.
 			INVALIDATE_TEXTURE = 1 << 2, //!< Texture data needs a sync.
 			INVALIDATE_INDEX = 1 << 3, //!< Index data needs a sync.
-			INVALIDATE_ALL = INVALIDATE_VERTEX | INVALIDATE_COLOR | INVALIDATE_TEXTURE | INVALIDATE_INDEX //!< All data needs a sync.
+			INVALIDATE_TRANSFORM = 1 << 4, //!< Transform offsets need a sync.
+			INVALIDATE_ALL = INVALIDATE_VERTEX | INVALIDATE_COLOR | INVALIDATE_TEXTURE | INVALIDATE_INDEX | INVALIDATE_TRANSFORM //!< All data needs a sync.
 		};
 
 		Renderer( const Renderer& ) = delete;
@@ -84,6 +94,16 @@ class SFGUI_API Renderer {
 		 */
 		std::shared_ptr<RendererViewport> CreateViewport();
 
+		/** Get default transform that does not offset primitives at all.
+		 * @return Default transform that does not offset primitives at all.
+		 */
+		std::shared_ptr<RendererTransform> GetDefaultTransform();
+
+		/** Create a new transform that can be shared by a hierarchy of primitives.
+		 * @return New transform.
+		 */
+		std::shared_ptr<RendererTransform> CreateTransform();
+
 		/** Create and register a new text primitive with the renderer.
 		 * @param text sf::Text describing the text to be drawn.
 		 * @return New text primitive.
@@ -179,6 +199,20 @@ class SFGUI_API Renderer {
 
 		/// @cond
 
+		/** Defer registration of newly created primitives.
+		 * While deferred, primitives can be created from multiple threads at once.
+		 * They are only handed to the renderer when CommitPrimitives() is called.
+		 */
+		void DeferPrimitives();
+
+		/** Register all primitives created since DeferPrimitives() was called.
+		 */
+		void CommitPrimitives();
+
+		/// @endcond
+
+		/// @cond
+
 		/** Load a Font at the given size and retrieve the texture atlas offset.
 		 * @param font sf::Font containing the font.
 		 * @param size Size of the font.
@@ -186,8 +220,17 @@ class SFGUI_API Renderer {
 		 */
 		sf::Vector2f LoadFont( const sf::Font& font, unsigned int size );
 
+		/** Load the glyphs text of the given font and size is created from into the atlas.
+		 * Loads the distance field glyphs of the font if distance field text is used.
+		 * Called before primitives are created on other threads, which mustn't touch the atlas.
+		 * @param font sf::Font containing the font.
+		 * @param size Size of the font.
+		 */
+		void PreloadFont( const sf::Font& font, unsigned int size );
+
 		/** Load an sf::Texture into the atlas and return a handle to the allocated texture.
 		 * This merely copies the data from the origin sf::Texture into the atlas.
+		 * The copy is done on the GPU, the texture isn't downloaded into an image.
 		 * @param texture sf::Texture containing the texture data.
 		 * @return Shared handle to the allocated texture.
 		 */
@@ -215,7 +258,7 @@ class SFGUI_API Renderer {
 
 		/** Invalidate renderer datasets so they are resynchronized with fresh data.
 		 * @param datasets The datasets to invalidate. Default: INVALIDATE_ALL
-		 * Bitwise OR of INVALIDATE_VERTEX, INVALIDATE_COLOR, INVALIDATE_TEXTURE or INVALIDATE_INDEX.
+		 * Bitwise OR of INVALIDATE_VERTEX, INVALIDATE_COLOR, INVALIDATE_TEXTURE, INVALIDATE_INDEX or INVALIDATE_TRANSFORM.
 		 */
 		void Invalidate( unsigned char datasets = INVALIDATE_ALL );
 
@@ -259,6 +302,22 @@ class SFGUI_API Renderer {
 		 */
 		virtual const std::string& GetName() const = 0;
 
+		/** Check if the Renderer draws panes, rects and sprites as instances.
+		 * Instances of primitives created while this returns false are
+		 * expanded into vertices.
+		 * @return true if the Renderer draws instances.
+		 */
+		virtual bool UsesInstancing() const;
+
+		/** Check if the Renderer draws text from signed distance field glyphs.
+		 * Distance field glyphs are generated once per font face and
+		 * scaled to any character size, bitmap glyphs are loaded per
+		 * character size. Only text created while this returns true is
+		 * drawn from distance field glyphs.
+		 * @return true if the Renderer draws distance field text.
+		 */
+		virtual bool UsesDistanceFieldText() const;
+
 	protected:
 		typedef std::pair<void*, unsigned int> FontID;
 
@@ -270,14 +329,51 @@ class SFGUI_API Renderer {
 
 		void SortPrimitives();
 
+		/** Classify a primitive as opaque or translucent.
+		 * Called when a primitive is added. Renderers that rely on the
+		 * classification call it again when they rebuild the vertex data
+		 * of an invalidated primitive.
+		 * @param primitive Primitive.
+		 */
+		void ClassifyOpacity( Primitive& primitive ) const;
+
 		int GetMaxTextureSize() const;
 
+		/** Keep CPU-side copies of all atlas pages in m_atlas_images.
+		 * Renderers that sample the atlas on the CPU call this once, the
+		 * copies are kept in sync with the atlas from then on.
+		 */
+		void KeepAtlasImages();
+
 		void WipeStateCache( sf::RenderTarget& target ) const;
 
+		/** Write image data into an atlas page.
+		 * Called by UpdateImage() after the image has been located. The
+		 * default implementation updates the page right away, renderers
+		 * can defer the upload as long as it is done before the page is
+		 * next drawn from or copied.
+		 * @param page Index of the atlas page.
+		 * @param position Position of the image within the page.
+		 * @param data Image data.
+		 */
+		virtual void UpdateAtlasPage( std::size_t page, const sf::Vector2u& position, const sf::Image& data );
+
+		/** Drop deferred writes to an image that is being unloaded.
+		 * Its space in the atlas can be reused right after this returns.
+		 * @param page Index of the atlas page.
+		 * @param position Position of the image within the page.
+		 */
+		virtual void DiscardAtlasPageUpdates( std::size_t page, const sf::Vector2u& position );
+
 		std::vector<std::shared_ptr<Primitive>> m_primitives;
 		std::vector<std::unique_ptr<sf::Texture>> m_texture_atlas;
+		std::vector<sf::Image> m_atlas_images;
+
+		// Incremented whenever the corresponding atlas page is written to.
+		std::vector<unsigned int> m_atlas_page_revisions;
 
 		std::shared_ptr<RendererViewport> m_default_viewport;
+		std::shared_ptr<RendererTransform> m_default_transform;
 
 		int m_vertex_count;
 		int m_index_count;
@@ -289,12 +385,40 @@ class SFGUI_API Renderer {
 	private:
 		virtual void DisplayImpl() const = 0;
 
+		std::shared_ptr<Primitive> CreateInstance( const PrimitiveInstance& instance, std::shared_ptr<PrimitiveTexture> texture );
+
+		std::shared_ptr<Primitive> CreateDistanceFieldText( const sf::Text& text );
+
+		const priv::DistanceFieldFont& LoadDistanceFieldFont( const sf::Font& font );
+
+		/** Allocate space for an image of the given size in the texture atlas.
+		 * Adds atlas pages or grows the last one as needed. The caller
+		 * writes the image to the returned offset.
+		 * @param size Size of the image.
+		 * @return Handle to the allocated space or nullptr if the image doesn't fit.
+		 */
+		std::shared_ptr<PrimitiveTexture> AllocateTexture( const sf::Vector2u& size );
+
+		/** Resize an atlas page keeping its contents.
+		 * @param page Index of the atlas page.
+		 * @param size New size of the page, at least as large as the current one.
+		 * @return true on success.
+		 */
+		bool ResizeAtlasPage( std::size_t page, const sf::Vector2u& size );
+
 		std::deque<priv::RendererTextureNode> m_textures;
 		std::map<FontID, std::shared_ptr<PrimitiveTexture>> m_fonts;
+		std::map<void*, std::shared_ptr<priv::DistanceFieldFont>> m_distance_field_fonts;
 		std::vector<std::pair<std::uint32_t, std::uint32_t>> m_character_sets;
 
 		std::shared_ptr<PrimitiveTexture> m_pseudo_texture;
 
+		std::vector<std::shared_ptr<Primitive>> m_deferred_primitives;
+		std::mutex m_deferred_primitives_mutex;
+		std::atomic<unsigned char> m_deferred_datasets;
+		bool m_defer_primitives;
+
+		bool m_keep_atlas_images;
 		bool m_primitives_sorted;
 };
 
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <SFML/System/Vector2.hpp>
+#include <memory>
+
+namespace sfg {
+
+/** Renderer transform.
+ * A transform is an offset that is shared by all primitives of a widget
+ * hierarchy. Moving the hierarchy only changes the offset instead of
+ * touching every vertex of every primitive.
+ */
+class RendererTransform {
+	public:
+		typedef std::shared_ptr<RendererTransform> Ptr; //!< Shared pointer.
+
+		/** Ctor.
+		 */
+		RendererTransform();
+
+		/** Set offset that is added to all primitives using this transform.
+		 * @param offset Offset that is added to all primitives using this transform.
+		 */
+		void SetOffset( const sf::Vector2f& offset );
+
+		/** Get offset that is added to all primitives using this transform.
+		 * @return Offset that is added to all primitives using this transform.
+		 */
+		const sf::Vector2f& GetOffset() const;
+
+	private:
+		sf::Vector2f m_offset;
+};
+
+}
@@ -7,6 +7,8 @@
 
 namespace sfg {
 
+class RendererTransform;
+
 /** Renderer viewport.
  */
 class RendererViewport {
@@ -37,6 +39,22 @@ class RendererViewport {
 		 */
 		const sf::Vector2f& GetDestinationOrigin() const;
 
+		/** Set transform the destination origin is relative to.
+		 * @param transform Transform the destination origin is relative to. nullptr if the destination origin is absolute.
+		 */
+		void SetTransform( std::shared_ptr<RendererTransform> transform );
+
+		/** Get transform the destination origin is relative to.
+		 * @return Transform the destination origin is relative to. nullptr if the destination origin is absolute.
+		 */
+		std::shared_ptr<RendererTransform> GetTransform() const;
+
+		/** Get origin of the destination rectangle in window coordinates.
+		 * This is the destination origin offset by the viewport's transform.
+		 * @return Origin of the destination rectangle in window coordinates.
+		 */
+		sf::Vector2f GetAbsoluteDestinationOrigin() const;
+
 		/** Set size of the viewport rectangle.
 		 * @param size Size of the viewport rectangle.
 		 */
@@ -64,6 +82,8 @@ class RendererViewport {
 		sf::Vector2f m_destination_origin;
 		sf::Vector2f m_size;
 
+		std::shared_ptr<RendererTransform> m_transform;
+
 		std::size_t m_id;
 };
 
@@ -6,3 +6,5 @@
 #include <SFGUI/Renderers/NonLegacyRenderer.hpp>
 #include <SFGUI/Renderers/VertexBufferRenderer.hpp>
 #include <SFGUI/Renderers/VertexArrayRenderer.hpp>
+#include <SFGUI/Renderers/RecordingRenderer.hpp>
+#include <SFGUI/Renderers/SoftwareRenderer.hpp>
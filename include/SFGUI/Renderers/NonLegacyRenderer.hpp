@@ -4,6 +4,7 @@
 
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/System/Vector2.hpp>
+#include <cstdint>
 
 namespace sf {
 class Color;
@@ -11,8 +12,14 @@ class Color;
 
 namespace sfg {
 
+class RendererTransform;
+class RendererViewport;
+
 namespace priv {
 struct RendererBatch;
+struct CompactVertex;
+struct RendererInstance;
+struct RendererImageUpload;
 }
 
 /** SFGUI Vertex Buffer renderer.
@@ -61,6 +68,115 @@ class SFGUI_API NonLegacyRenderer : public Renderer {
 		 */
 		void TuneUseFBO( bool enable );
 
+		/** Enable or disable streaming vertex buffers.
+		 * Vertex data is written straight into a ring of mapped buffer
+		 * regions that are fenced until the GPU is done with them instead
+		 * of respecifying the buffers on every update. Persistent mapping
+		 * is used where ARB_buffer_storage is available. Has no effect if
+		 * ARB_map_buffer_range or ARB_sync is unavailable.
+		 * @param enable true to enable, false to disable.
+		 */
+		void TuneStreaming( bool enable );
+
+		/** Check if vertices are uploaded in the compact interleaved format.
+		 * The 12 byte format is selected on creation if the largest possible
+		 * window and atlas page fit into its 16-bit coordinates. Positions
+		 * are stored in fractions of a pixel, an eighth of a pixel or finer
+		 * on windows of up to 2048 pixels, which geometry that isn't pixel
+		 * aligned is snapped to.
+		 * @return true if vertices are uploaded in the compact format.
+		 */
+		bool UsesCompactVertices() const;
+
+		/** Enable or disable instanced drawing of panes, rects and sprites.
+		 * Each of them is uploaded as a single instance record that is
+		 * expanded into a quad by the vertex shader, with pane borders
+		 * colored by the fragment shader. Only primitives created while
+		 * instancing is enabled are instanced, disabling it expands all
+		 * instances into vertices and refreshes all widgets so distance field
+		 * text is re-created with bitmap glyphs. Enabled by default if
+		 * ARB_instanced_arrays and ARB_draw_instanced are available.
+		 * @param enable true to enable, false to disable.
+		 */
+		void TuneInstancing( bool enable );
+
+		bool UsesInstancing() const override;
+
+		/** Enable or disable drawing from a texture array atlas.
+		 * Atlas pages are copied into the layers of a GL_TEXTURE_2D_ARRAY
+		 * and the layer is selected per vertex, so atlas page changes no
+		 * longer split batches. The array duplicates the atlas in video
+		 * memory. Pages are bound separately if EXT_texture_array is
+		 * unavailable or the atlas has more pages than the array can
+		 * have layers. Enabled by default if available.
+		 * @param enable true to enable, false to disable.
+		 */
+		void TuneTextureArray( bool enable );
+
+		/** Check if the atlas is drawn from a texture array.
+		 * @return true if the atlas pages are layers of a texture array.
+		 */
+		bool UsesTextureArray() const;
+
+		/** Enable or disable clipping viewports in the shader.
+		 * Each vertex and instance carries the slot of its viewport's
+		 * clip rect and source offset, which the vertex shader applies
+		 * with gl_ClipDistance instead of setting a scissor rect per
+		 * batch. Primitives in different viewports can then be drawn
+		 * together and batches only break for custom draw callbacks.
+		 * Viewports beyond the 32 slots fall back to the scissor test.
+		 * Enabled by default.
+		 * @param enable true to enable, false to disable.
+		 */
+		void TuneShaderClipping( bool enable );
+
+		/** Check if viewports are clipped in the shader.
+		 * @return true if viewports are clipped in the shader.
+		 */
+		bool UsesShaderClipping() const;
+
+		/** Enable or disable the opaque depth pre-pass.
+		 * Opaque primitives, untextured ones with fully opaque colors, are
+		 * drawn first and front to back with depth writes and blending
+		 * disabled, then translucent primitives back to front tested
+		 * against their depth. Pixels hidden by opaque primitives are
+		 * only shaded once. Requires a target with a depth buffer, which
+		 * is cleared when drawing, and has no effect while FBO caching is
+		 * enabled. Disabled by default.
+		 * @param enable true to enable, false to disable.
+		 */
+		void TuneDepthPrePass( bool enable );
+
+		/** Check if the last frame was drawn with the opaque depth pre-pass.
+		 * @return true if the last frame was drawn with the opaque depth pre-pass.
+		 */
+		bool UsesDepthPrePass() const;
+
+		/** Enable or disable drawing text from signed distance field glyphs.
+		 * The glyphs of a font face are converted into a distance field once
+		 * at a reference size and the fragment shader renders any character
+		 * size from it with antialiased edges, instead of loading the font
+		 * into the atlas again for every character size. Changing the mode
+		 * refreshes all widgets so their text is re-created and laid out
+		 * again. Requires instancing, text created while instancing is
+		 * disabled uses bitmap glyphs. Disabled by default.
+		 * @param enable true to enable, false to disable.
+		 */
+		void TuneDistanceFieldText( bool enable );
+
+		bool UsesDistanceFieldText() const override;
+
+		/** Enable or disable streaming image updates through pixel buffers.
+		 * Images updated with Image::SetImage() or PrimitiveTexture::Update()
+		 * are queued and uploaded when the GUI is next displayed. Only the
+		 * latest data of an image is uploaded, through a ring of orphaned
+		 * pixel unpack buffers, so the transfer to the atlas overlaps with
+		 * drawing instead of stalling the caller. Enabled by default if
+		 * ARB_pixel_buffer_object is available.
+		 * @param enable true to enable, false to disable.
+		 */
+		void TuneImageStreaming( bool enable );
+
 		const std::string& GetName() const override;
 
 	protected:
@@ -70,6 +186,10 @@ class SFGUI_API NonLegacyRenderer : public Renderer {
 
 		void InvalidateImpl( unsigned char datasets ) override;
 
+		void UpdateAtlasPage( std::size_t page, const sf::Vector2u& position, const sf::Image& data ) override;
+
+		void DiscardAtlasPageUpdates( std::size_t page, const sf::Vector2u& position ) override;
+
 	private:
 		void DisplayImpl() const override;
 
@@ -77,6 +197,10 @@ class SFGUI_API NonLegacyRenderer : public Renderer {
 
 		void RefreshVBO();
 
+		void RefreshTransforms();
+
+		void RefreshClipRects();
+
 		void SetupFBO( int width, int height );
 
 		void DestroyFBO();
@@ -84,13 +208,47 @@ class SFGUI_API NonLegacyRenderer : public Renderer {
 		void SetupVAO();
 		void SetupFBOVAO();
 
+		void SetupAttributes( std::size_t base_vertex );
+
+		void SetupInstanceVAO();
+
+		void SetupInstanceAttributes( std::size_t first_instance );
+
+		void CreateBuffers();
+
+		void DestroyBuffers();
+
+		void SetupStreaming( std::size_t vertex_capacity, std::size_t index_capacity, std::size_t instance_capacity );
+
+		void RefreshTextureArray();
+
+		void CopyTextureArrayPages();
+
+		void DestroyTextureArray();
+
+		void FlushImageUploads();
+
+		void DestroyStreaming();
+
+		void UnmapStreamSegment();
+
 		std::vector<sf::Vector2f> m_vertex_data;
 		std::vector<sf::Color> m_color_data;
 		std::vector<sf::Vector2f> m_texture_data;
+		std::vector<float> m_slot_data;
 		std::vector<unsigned int> m_index_data;
+		std::vector<std::uint16_t> m_short_index_data;
+
+		std::vector<priv::CompactVertex> m_compact_data;
+
+		std::vector<priv::RendererInstance> m_instance_data;
 
 		std::vector<priv::RendererBatch> m_batches;
 
+		std::vector<std::shared_ptr<RendererTransform>> m_transforms;
+
+		std::vector<std::shared_ptr<RendererViewport>> m_clip_viewports;
+
 		unsigned int m_frame_buffer = 0;
 		unsigned int m_frame_buffer_texture = 0;
 
@@ -105,28 +263,90 @@ class SFGUI_API NonLegacyRenderer : public Renderer {
 		unsigned int m_vertex_vbo = 0;
 		unsigned int m_color_vbo = 0;
 		unsigned int m_texture_vbo = 0;
+		unsigned int m_slot_vbo = 0;
 		unsigned int m_index_vbo = 0;
 
 		unsigned int m_vao = 0;
 
+		unsigned int m_instance_vbo = 0;
+		unsigned int m_instance_vao = 0;
+
+		mutable unsigned int m_fragment_query = 0;
+		mutable bool m_fragment_query_pending = false;
+
+		unsigned int m_texture_array = 0;
+		unsigned int m_texture_array_frame_buffer = 0;
+		sf::Vector2u m_texture_array_size;
+		std::vector<unsigned int> m_texture_array_revisions;
+		int m_max_texture_array_layers = 0;
+
+		std::vector<priv::RendererImageUpload> m_image_uploads;
+		std::vector<unsigned int> m_pixel_buffers;
+		std::size_t m_pixel_buffer_index = 0;
+
+		// Streaming state, each buffer is split into a ring of segments.
+		std::vector<void*> m_stream_fences;
+		std::vector<void*> m_stream_maps;
+		std::size_t m_stream_vertex_capacity = 0;
+		std::size_t m_stream_index_capacity = 0;
+		std::size_t m_stream_instance_capacity = 0;
+		std::size_t m_stream_segment = 0;
+		std::size_t m_stream_vertex_base = 0;
+		std::size_t m_stream_index_base = 0;
+		std::size_t m_stream_instance_base = 0;
+		bool m_streaming = false;
+		bool m_persistent = false;
+
 		unsigned int m_shader = 0;
 		int m_viewport_parameters_location = 0;
+		int m_position_scale_location = 0;
 		int m_texture_location = 0;
+		int m_transforms_location = 0;
+		int m_clip_rects_location = 0;
+		int m_clip_offsets_location = 0;
 		unsigned int m_vertex_location = 0;
 		unsigned int m_color_location = 0;
 		unsigned int m_texture_coordinate_location = 0;
+		unsigned int m_slot_location = 0;
+		int m_instanced_location = 0;
+		int m_layered_location = 0;
+		int m_texture_array_location = 0;
+		unsigned int m_instance_rect_location = 0;
+		unsigned int m_instance_texture_rect_location = 0;
+		unsigned int m_instance_light_border_color_location = 0;
+		unsigned int m_instance_dark_border_color_location = 0;
+		unsigned int m_instance_border_width_location = 0;
+		unsigned int m_instance_distance_field_location = 0;
 
 		sf::Vector2i m_previous_window_size;
 
 		int m_last_vertex_count;
 		int m_last_index_count;
+		int m_last_instance_count;
 
 		unsigned char m_vbo_sync_type;
 
 		mutable bool m_vbo_synced;
 
+		bool m_transforms_synced;
+		bool m_transform_overflow;
+
 		bool m_cull;
 		bool m_use_fbo;
+		bool m_use_streaming = false;
+		bool m_compact = false;
+		float m_position_scale = 1.f;
+		bool m_short_indices = false;
+		bool m_use_instancing = false;
+		bool m_use_distance_field_text = false;
+		bool m_use_texture_array = false;
+		bool m_use_shader_clipping = true;
+		bool m_use_depth_pre_pass = false;
+		bool m_use_image_streaming = false;
+		mutable bool m_depth_pre_pass = false;
+		mutable std::uint64_t m_depth_bits_context_id = 0;
+		mutable int m_depth_bits = 0;
+		bool m_layered = false;
 };
 
 }
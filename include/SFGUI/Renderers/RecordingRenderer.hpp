@@ -0,0 +1,136 @@
+#pragma once
+
+#include <SFGUI/Renderer.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace sfg {
+
+/** SFGUI Recording renderer.
+ * Sorts, batches and assembles vertex and index data just like the GL
+ * renderers, but keeps the result in CPU-side buffers instead of uploading
+ * and drawing it. The recorded frame can be inspected, which makes this
+ * renderer useful for profiling and testing on machines without a GPU.
+ * It doesn't issue any GL calls itself and custom GL canvases are recorded
+ * as batches but not drawn.
+ *
+ * Use it by setting it as the Renderer before creating the SFGUI object.
+ */
+class SFGUI_API RecordingRenderer : public Renderer {
+	public:
+		typedef std::shared_ptr<RecordingRenderer> Ptr;
+		typedef std::shared_ptr<const RecordingRenderer> PtrConst;
+
+		/** A recorded batch, drawn with a single draw call by the GL renderers.
+		 */
+		struct Batch {
+			std::shared_ptr<RendererViewport> viewport; //!< Viewport of the batch.
+			sf::IntRect scissor; //!< Scissor rect in target coordinates, origin at the top left.
+			int atlas_page; //!< Atlas page bound for the batch.
+			int start_index; //!< First index of the batch.
+			int index_count; //!< Number of indices in the batch.
+			int min_index; //!< Smallest vertex index referenced by the batch.
+			int max_index; //!< Largest vertex index referenced by the batch.
+			bool custom_draw; //!< true if the batch is a custom GL canvas.
+		};
+
+		/** Create RecordingRenderer.
+		 * @return RecordingRenderer.
+		 */
+		static Ptr Create();
+
+		/** Record the GUI for an sf::Window.
+		 * @param target sf::Window whose size is recorded for.
+		 */
+		void Display( sf::Window& target ) const override;
+
+		/** Record the GUI for an sf::RenderWindow.
+		 * @param target sf::RenderWindow whose size is recorded for.
+		 */
+		void Display( sf::RenderWindow& target ) const override;
+
+		/** Record the GUI for an sf::RenderTexture.
+		 * @param target sf::RenderTexture whose size is recorded for.
+		 */
+		void Display( sf::RenderTexture& target ) const override;
+
+		/** Record the GUI for a target of the given size.
+		 * Doesn't need a target at all.
+		 * @param size Size of the target.
+		 */
+		void Record( const sf::Vector2u& size ) const;
+
+		/** Enable or disable CPU driven face culling.
+		 * @param enable true to enable, false to disable.
+		 */
+		void TuneCull( bool enable );
+
+		/** Get recorded vertex positions, transforms are already applied.
+		 * @return Recorded vertex positions.
+		 */
+		const std::vector<sf::Vector2f>& GetVertexData() const;
+
+		/** Get recorded vertex colors.
+		 * @return Recorded vertex colors.
+		 */
+		const std::vector<sf::Color>& GetColorData() const;
+
+		/** Get recorded normalized texture coordinates.
+		 * @return Recorded texture coordinates.
+		 */
+		const std::vector<sf::Vector2f>& GetTextureData() const;
+
+		/** Get recorded indices.
+		 * @return Recorded indices.
+		 */
+		const std::vector<unsigned int>& GetIndexData() const;
+
+		/** Get recorded batches in draw order.
+		 * @return Recorded batches.
+		 */
+		const std::vector<Batch>& GetBatches() const;
+
+		/** Get the number of draw calls a GL renderer would issue for the recorded frame.
+		 * Custom GL canvases aren't counted.
+		 * @return Number of draw calls.
+		 */
+		std::size_t GetDrawCallCount() const;
+
+		/** Get the number of times the vertex data was assembled.
+		 * Data is only assembled again if it was invalidated since it was last recorded.
+		 * @return Number of times the vertex data was assembled.
+		 */
+		std::size_t GetRebuildCount() const;
+
+		const std::string& GetName() const override;
+
+	protected:
+		/** Ctor.
+		 */
+		RecordingRenderer();
+
+		void InvalidateImpl( unsigned char datasets ) override;
+
+		void DisplayImpl() const override;
+
+	private:
+		void RefreshData();
+
+		std::vector<sf::Vector2f> m_vertex_data;
+		std::vector<sf::Color> m_color_data;
+		std::vector<sf::Vector2f> m_texture_data;
+		std::vector<unsigned int> m_index_data;
+
+		std::vector<Batch> m_batches;
+
+		std::size_t m_draw_call_count = 0;
+		std::size_t m_rebuild_count = 0;
+
+		mutable bool m_synced = false;
+
+		bool m_cull = false;
+};
+
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <SFGUI/Renderers/RecordingRenderer.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+
+namespace sf {
+class RenderTarget;
+class Texture;
+}
+
+namespace sfg {
+
+/** SFGUI Software renderer.
+ * Rasterizes the batches assembled by the RecordingRenderer on the CPU
+ * into an RGBA pixel buffer. They are batched by the same code as the
+ * batches of the GL renderers, so draw order and clipping match. Triangles are drawn with alpha blending,
+ * atlas textures and per-viewport clipping. The target is split into
+ * tiles that are rasterized on the worker threads of the Context, if
+ * there are any. Custom GL canvases aren't drawn.
+ *
+ * Displaying to an sf::RenderWindow or sf::RenderTexture rasterizes the
+ * GUI and draws the result to the target. Record() and displaying to an
+ * sf::Window only rasterize, the result can be retrieved with GetPixels()
+ * or CopyToImage().
+ */
+class SFGUI_API SoftwareRenderer : public RecordingRenderer {
+	public:
+		typedef std::shared_ptr<SoftwareRenderer> Ptr;
+		typedef std::shared_ptr<const SoftwareRenderer> PtrConst;
+
+		/** Create SoftwareRenderer.
+		 * @return SoftwareRenderer.
+		 */
+		static Ptr Create();
+
+		/** Dtor.
+		 */
+		~SoftwareRenderer();
+
+		/** Rasterize the GUI for an sf::Window.
+		 * The result isn't drawn to the window.
+		 * @param target sf::Window whose size is rasterized for.
+		 */
+		void Display( sf::Window& target ) const override;
+
+		/** Rasterize the GUI and draw it to an sf::RenderWindow.
+		 * @param target sf::RenderWindow to draw to.
+		 */
+		void Display( sf::RenderWindow& target ) const override;
+
+		/** Rasterize the GUI and draw it to an sf::RenderTexture.
+		 * @param target sf::RenderTexture to draw to.
+		 */
+		void Display( sf::RenderTexture& target ) const override;
+
+		/** Set the color the pixel buffer is cleared with before rasterizing.
+		 * @param color Clear color, default transparent black.
+		 */
+		void SetClearColor( const sf::Color& color );
+
+		/** Get the color the pixel buffer is cleared with before rasterizing.
+		 * @return Clear color.
+		 */
+		const sf::Color& GetClearColor() const;
+
+		/** Get the size of the pixel buffer.
+		 * @return Size of the last rasterized frame.
+		 */
+		const sf::Vector2u& GetSize() const;
+
+		/** Get the rasterized pixels.
+		 * @return RGBA pixels of the last rasterized frame, row by row from the top.
+		 */
+		const std::uint8_t* GetPixels() const;
+
+		/** Copy the rasterized pixels to an image.
+		 * @return Image of the last rasterized frame.
+		 */
+		sf::Image CopyToImage() const;
+
+		const std::string& GetName() const override;
+
+	protected:
+		/** Ctor.
+		 */
+		SoftwareRenderer();
+
+		void DisplayImpl() const override;
+
+	private:
+		struct TileTriangle {
+			std::uint32_t first_index;
+			std::uint32_t batch;
+		};
+
+		void Rasterize();
+
+		void RasterizeTile( std::size_t tile );
+
+		void DrawToTarget( sf::RenderTarget& target ) const;
+
+		std::vector<std::uint32_t> m_pixels;
+		std::vector<std::vector<TileTriangle>> m_tiles;
+
+		mutable std::unique_ptr<sf::Texture> m_texture;
+
+		sf::Vector2u m_size;
+		sf::Vector2u m_tile_count;
+
+		sf::Color m_clear_color;
+};
+
+}
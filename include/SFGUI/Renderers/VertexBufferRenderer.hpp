@@ -3,6 +3,7 @@
 #include <SFGUI/Renderer.hpp>
 
 #include <SFML/System/Vector2.hpp>
+#include <cstdint>
 
 namespace sf {
 class Color;
@@ -12,6 +13,7 @@ namespace sfg {
 
 namespace priv {
 struct RendererBatch;
+struct CompactVertex;
 }
 
 /** SFGUI Vertex Buffer renderer.
@@ -65,6 +67,16 @@ class SFGUI_API VertexBufferRenderer : public Renderer {
 		 */
 		void TuneUseFBO( bool enable );
 
+		/** Check if vertices are uploaded in the compact interleaved format.
+		 * The 12 byte format is selected on creation if the largest possible
+		 * window and atlas page fit into its 16-bit coordinates. Positions
+		 * are stored in fractions of a pixel, an eighth of a pixel or finer
+		 * on windows of up to 2048 pixels, which geometry that isn't pixel
+		 * aligned is snapped to.
+		 * @return true if vertices are uploaded in the compact format.
+		 */
+		bool UsesCompactVertices() const;
+
 		const std::string& GetName() const override;
 
 	protected:
@@ -81,6 +93,8 @@ class SFGUI_API VertexBufferRenderer : public Renderer {
 
 		void RefreshVBO();
 
+		void SetupPointers( int base_vertex ) const;
+
 		void SetupFBO( int width, int height );
 
 		void DestroyFBO();
@@ -89,6 +103,9 @@ class SFGUI_API VertexBufferRenderer : public Renderer {
 		std::vector<sf::Color> m_color_data;
 		std::vector<sf::Vector2f> m_texture_data;
 		std::vector<unsigned int> m_index_data;
+		std::vector<std::uint16_t> m_short_index_data;
+
+		std::vector<priv::CompactVertex> m_compact_data;
 
 		std::vector<priv::RendererBatch> m_batches;
 
@@ -106,6 +123,7 @@ class SFGUI_API VertexBufferRenderer : public Renderer {
 		int m_last_index_count;
 
 		float m_alpha_threshold;
+		float m_position_scale;
 
 		unsigned char m_vbo_sync_type;
 
@@ -116,6 +134,10 @@ class SFGUI_API VertexBufferRenderer : public Renderer {
 
 		bool m_vbo_supported;
 		bool m_fbo_supported;
+
+		bool m_compact;
+		bool m_short_indices;
+		bool m_base_vertex_supported;
 };
 
 }
@@ -5,6 +5,7 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <mutex>
 
 namespace sf {
 class Font;
@@ -30,6 +31,10 @@ class SFGUI_API ResourceManager {
 		 */
 		ResourceManager( bool use_default_font = true );
 
+		/** Dtor.
+		 */
+		~ResourceManager();
+
 		/** Clear manager, i.e. destroy all resources and loaders.
 		 */
 		void Clear();
@@ -47,14 +52,14 @@ class SFGUI_API ResourceManager {
 		std::shared_ptr<const ResourceLoader> GetLoader( const std::string& id );
 
 		/** Get font.
-		 * Will be loaded if not done so before.
+		 * Will be loaded if not done so before. Safe to call from multiple threads.
 		 * @param path Path.
 		 * @return Font or std::shared_ptr<const sf::Font>() if failed to load.
 		 */
 		std::shared_ptr<const sf::Font> GetFont( const std::string& path );
 
 		/** Get image.
-		 * Will be loaded if not done so before.
+		 * Will be loaded if not done so before. Safe to call from multiple threads.
 		 * @param path Path.
 		 * @return Image or std::shared_ptr<const sf::Image>() if failed to load.
 		 */
@@ -87,11 +92,14 @@ class SFGUI_API ResourceManager {
 
 		std::shared_ptr<const ResourceLoader> GetMatchingLoader( const std::string& path );
 		std::string GetFilename( const std::string& path, const ResourceLoader& loader );
+		void ReleaseFonts();
 
 		LoaderMap m_loaders;
 		FontMap m_fonts;
 		ImageMap m_images;
 
+		std::recursive_mutex m_mutex;
+
 		bool m_use_default_font;
 };
 
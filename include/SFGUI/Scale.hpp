@@ -37,7 +37,9 @@ class SFGUI_API Scale : public Range {
 
 	protected:
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
 
 	private:
 		/** Ctor.
@@ -47,7 +47,9 @@ class SFGUI_API Scrollbar : public Range {
 
 	protected:
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
 
 	private:
 		/** Ctor.
@@ -120,6 +120,7 @@ class SFGUI_API ScrolledWindow : public Container {
 
 	protected:
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
 
 	private:
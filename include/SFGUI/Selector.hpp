@@ -36,6 +36,33 @@ class SFGUI_API Selector {
 		 */
 		static Ptr Create( const std::string& widget, const std::string& id, const std::string& class_, const std::string& state, HierarchyType hierarchy, Ptr parent );
 
+		/// @cond
+
+		/** Create selector from precompiled data, e.g. loaded from a compiled theme.
+		 * @param widget Widget string.
+		 * @param id ID string.
+		 * @param class_ Class string.
+		 * @param state State or nullptr if all.
+		 * @param hierarchy Hierarchy type.
+		 * @param parent Selector parent.
+		 * @param hash Hash of the selector string.
+		 * @param score Score of the selector.
+		 * @return Selector.
+		 */
+		static Ptr Create( const std::string& widget, const std::string& id, const std::string& class_, const Widget::State* state, HierarchyType hierarchy, Ptr parent, std::size_t hash, int score );
+
+		/** Get hash of the selector string.
+		 * @return Hash of the selector string.
+		 */
+		std::size_t GetHash() const;
+
+		/** Get hierarchy type.
+		 * @return Hierarchy type.
+		 */
+		HierarchyType GetHierarchyType() const;
+
+		/// @endcond
+
 		/** Get widget name.
 		 * @return Widget name or empty if all.
 		 */
@@ -84,7 +111,8 @@ class SFGUI_API Selector {
 
 		/** Get score of this selector.
 		 * Score calculation is based on W3 specification.
-		 * The selector with the highest score gets used by the engine.
+		 * The selector with the highest score gets used by the engine. The score
+		 * is calculated once when the selector is created.
 		 * @return Score of this selector.
 		 */
 		int GetScore() const;
@@ -96,6 +124,8 @@ class SFGUI_API Selector {
 		Selector( const Selector& other );
 		Selector& operator=( const Selector& other );
 
+		int CalculateScore() const;
+
 		Ptr m_parent;
 
 		HierarchyType m_hierarchy_type;
@@ -106,6 +136,7 @@ class SFGUI_API Selector {
 		std::unique_ptr<Widget::State> m_state;
 
 		std::size_t m_hash;
+		int m_score;
 };
 
 }
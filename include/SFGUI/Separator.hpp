@@ -36,7 +36,9 @@ class SFGUI_API Separator : public Widget {
 
 	protected:
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
 
 	private:
 		/** Ctor.
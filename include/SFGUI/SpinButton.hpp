@@ -101,7 +101,9 @@ class SFGUI_API SpinButton : public Entry {
 
 	protected:
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
 
 	private:
 		/** Ctor.
@@ -44,7 +44,9 @@ class SFGUI_API Spinner : public Widget {
 		Spinner();
 
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
 		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
 
 	private:
 		void HandleUpdate( float seconds ) override;
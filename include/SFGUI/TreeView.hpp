@@ -0,0 +1,162 @@
+#pragma once
+
+#include <SFGUI/ListView.hpp>
+
+#include <SFML/System/String.hpp>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <cstddef>
+
+namespace sfg {
+
+/** Tree view.
+ * Hierarchical list of nodes that can be expanded and collapsed. Every node
+ * keeps count of the visible rows in its subtree, so expanding, collapsing and
+ * looking up the node of a row take logarithmic time per level of the tree no
+ * matter how many nodes are visible. Rows are recycled just like in a ListView,
+ * so only the visible rows are instantiated.
+ *
+ * The rows are managed by an internal ListView. Its item count, row height and
+ * item refreshing follow the tree and aren't exposed.
+ *
+ * Children of expandable nodes can be populated lazily: the populate callback
+ * is invoked the first time a node without children is expanded.
+ */
+class SFGUI_API TreeView : public Container {
+	public:
+		typedef std::shared_ptr<TreeView> Ptr; //!< Shared pointer.
+		typedef std::shared_ptr<const TreeView> PtrConst; //!< Shared pointer.
+		typedef std::size_t NodeID; //!< Type for node IDs.
+		typedef std::function<void( NodeID )> PopulateCallback; //!< Appends the children of the given node.
+
+		static const NodeID ROOT; //!< ID of the invisible root node, parent of all top level nodes.
+
+		/** Create tree view.
+		 * @return Tree view.
+		 */
+		static Ptr Create();
+
+		const std::string& GetName() const override;
+
+		/** Set the callback that populates the children of a node when it is first expanded.
+		 * @param callback Callback appending the children of the given node.
+		 */
+		void SetPopulateCallback( PopulateCallback callback );
+
+		/** Append a node.
+		 * @param parent ID of the parent node, ROOT for top level nodes.
+		 * @param text Text of the node.
+		 * @param expandable true if the node can have children, they are populated when the node is expanded.
+		 * @return ID of the new node.
+		 */
+		NodeID AppendNode( NodeID parent, const sf::String& text, bool expandable = false );
+
+		/** Remove all nodes.
+		 */
+		void Clear();
+
+		/** Get the number of nodes in the tree, excluding the root.
+		 * @return Number of nodes in the tree.
+		 */
+		std::size_t GetNodeCount() const;
+
+		/** Set text of a node.
+		 * @param node ID of the node.
+		 * @param text Text of the node.
+		 */
+		void SetNodeText( NodeID node, const sf::String& text );
+
+		/** Get text of a node.
+		 * @param node ID of the node.
+		 * @return Text of the node.
+		 */
+		const sf::String& GetNodeText( NodeID node ) const;
+
+		/** Get parent of a node.
+		 * @param node ID of the node.
+		 * @return ID of the parent node.
+		 */
+		NodeID GetParent( NodeID node ) const;
+
+		/** Get children of a node.
+		 * @param node ID of the node.
+		 * @return IDs of the children of the node.
+		 */
+		const std::vector<NodeID>& GetChildren( NodeID node ) const;
+
+		/** Expand a node, showing its children.
+		 * @param node ID of the node.
+		 */
+		void Expand( NodeID node );
+
+		/** Collapse a node, hiding its children.
+		 * @param node ID of the node.
+		 */
+		void Collapse( NodeID node );
+
+		/** Expand a collapsed or collapse an expanded node.
+		 * @param node ID of the node.
+		 */
+		void Toggle( NodeID node );
+
+		/** Check if a node is expanded.
+		 * @param node ID of the node.
+		 * @return true if the node is expanded.
+		 */
+		bool IsExpanded( NodeID node ) const;
+
+		/** Get the range of visible rows that currently have a row widget bound to them.
+		 * @return Index of the first and one past the last bound row.
+		 */
+		std::pair<std::size_t, std::size_t> GetVisibleRange() const;
+
+		/** Get the number of instantiated row widgets.
+		 * @return Number of instantiated row widgets.
+		 */
+		std::size_t GetRowCount() const;
+
+	protected:
+		/** Ctor.
+		 */
+		TreeView();
+
+		sf::Vector2f CalculateRequisition() override;
+
+		void HandleUpdate( float seconds ) override;
+
+	private:
+		struct Node {
+			NodeID parent;
+			sf::String text;
+			std::vector<NodeID> children;
+			std::vector<std::size_t> child_rows; // Fenwick tree over the visible rows of the children.
+			unsigned int depth;
+			std::size_t index; // Index in the children of the parent.
+			std::size_t visible_rows; // Visible rows of the subtree, including the node itself.
+			bool expandable;
+			bool expanded;
+		};
+
+		bool IsNodeShown( NodeID node ) const;
+		std::size_t CountChildRows( NodeID node, std::size_t end ) const;
+		void AddChildRows( NodeID node, std::size_t child, std::size_t rows );
+		void UpdateVisibleRows( NodeID node, std::size_t rows );
+		NodeID FindVisibleNode( std::size_t index ) const;
+
+		void BindRow( Widget::Ptr row, std::size_t index ) const;
+
+		bool HandleAdd( Widget::Ptr child ) override;
+		void HandleSizeChange() override;
+
+		ListView::Ptr m_list_view;
+
+		std::vector<Node> m_nodes;
+
+		PopulateCallback m_populate_callback;
+
+		bool m_visible_nodes_changed;
+};
+
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <SFGUI/Widget.hpp>
+
+#include <SFML/System/String.hpp>
+#include <memory>
+#include <cstddef>
+
+namespace sfg {
+
+/** Tree view row.
+ * Row widget used by TreeView to display a single node. Rows are
+ * recycled by the tree view and rebound to other nodes when scrolling.
+ */
+class SFGUI_API TreeViewRow : public Widget {
+	public:
+		typedef std::shared_ptr<TreeViewRow> Ptr; //!< Shared pointer.
+		typedef std::shared_ptr<const TreeViewRow> PtrConst; //!< Shared pointer.
+
+		/** Create tree view row.
+		 * @return Tree view row.
+		 */
+		static Ptr Create();
+
+		const std::string& GetName() const override;
+
+		/** Bind a node to this row.
+		 * @param node ID of the node.
+		 * @param text Text of the node.
+		 * @param depth Depth of the node in the tree, top level nodes have depth 0.
+		 * @param expandable true if the node has or can have children.
+		 * @param expanded true if the children of the node are shown.
+		 */
+		void SetNode( std::size_t node, const sf::String& text, unsigned int depth, bool expandable, bool expanded );
+
+		/** Get ID of the bound node.
+		 * @return ID of the bound node.
+		 */
+		std::size_t GetNode() const;
+
+		/** Get text of the bound node.
+		 * @return Text of the bound node.
+		 */
+		const sf::String& GetText() const;
+
+		/** Get depth of the bound node.
+		 * @return Depth of the bound node.
+		 */
+		unsigned int GetDepth() const;
+
+		/** Check if the bound node has or can have children.
+		 * @return true if the bound node has or can have children.
+		 */
+		bool IsExpandable() const;
+
+		/** Check if the children of the bound node are shown.
+		 * @return true if the children of the bound node are shown.
+		 */
+		bool IsExpanded() const;
+
+	protected:
+		/** Ctor.
+		 */
+		TreeViewRow();
+
+		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
+		bool CanInvalidateConcurrently() const override;
+		sf::Vector2f CalculateRequisition() override;
+		bool CanMeasureConcurrently() const override;
+
+	private:
+		void HandleMouseEnter( int x, int y ) override;
+		void HandleMouseLeave( int x, int y ) override;
+
+		sf::String m_text;
+		std::size_t m_node;
+		unsigned int m_depth;
+		bool m_expandable;
+		bool m_expanded;
+};
+
+}
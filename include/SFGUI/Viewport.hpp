@@ -78,6 +78,10 @@ class SFGUI_API Viewport : public Bin {
 		 */
 		void HandleViewportUpdate() override;
 
+		/** Handle transform change.
+		 */
+		void HandleTransformUpdate() override;
+
 		std::unique_ptr<RenderQueue> InvalidateImpl() const override;
 
 	private:
@@ -20,6 +20,7 @@ namespace sfg {
 
 class Container;
 class RendererViewport;
+class RendererTransform;
 class RenderQueue;
 
 /** Base class for widgets.
@@ -184,6 +185,8 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		virtual sf::Vector2f GetAbsolutePosition() const;
 
 		/** Handle absolute position changes.
+		 * Not called when a root widget is moved, since its whole hierarchy
+		 * is then moved by changing the offset of its RendererTransform.
 		 */
 		virtual void HandleAbsolutePositionChange();
 
@@ -191,6 +194,12 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		 */
 		virtual void HandleGlobalVisibilityChange();
 
+		/** Collect the invalidated widgets of this hierarchy whose drawable can be built concurrently.
+		 * Containers only descend into their children if one of them was invalidated since the last call.
+		 * @param widgets Vector to append the widgets to.
+		 */
+		virtual void CollectConcurrentInvalidations( std::vector<Widget*>& widgets );
+
 		/** Update position of drawable.
 		 */
 		virtual void UpdateDrawablePosition() const;
@@ -238,6 +247,17 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		 */
 		static void RefreshAll();
 
+		/** Refresh this widget and its children if their style changed.
+		 * Widgets are checked against the property changes of the active
+		 * engine. Widgets whose style didn't change are left alone, widgets
+		 * whose changed properties can't affect their size are only invalidated.
+		 */
+		void RefreshStyle();
+
+		/** Refresh all widgets whose style changed.
+		 */
+		static void RefreshStyleAll();
+
 		/** Set hierarchy level of this widget.
 		 * @param level New hierarchy level of this widget.
 		 */
@@ -258,6 +278,18 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		 */
 		std::shared_ptr<RendererViewport> GetViewport() const;
 
+		/** Set transform of this widget.
+		 * Root widgets own a transform whose offset is their position,
+		 * all other widgets share the transform of their root widget.
+		 * @param transform Transform of this widget.
+		 */
+		void SetTransform( std::shared_ptr<RendererTransform> transform );
+
+		/** Get transform of this widget.
+		 * @return Transform of this widget.
+		 */
+		std::shared_ptr<RendererTransform> GetTransform() const;
+
 		/** Get the Z layer this widget should be rendered in.
 		 * Larger values are rendered later. Default: 0.
 		 * @return Z layer this widget should be rendered in.
@@ -312,6 +344,30 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		 */
 		virtual std::unique_ptr<RenderQueue> InvalidateImpl() const;
 
+		/** Check if InvalidateImpl() may be called from a worker thread.
+		 * This is only the case if InvalidateImpl() does nothing but read the
+		 * widget's state and build its drawable through the engine, e.g. it
+		 * doesn't invalidate or allocate other widgets or load textures.
+		 * @return true if InvalidateImpl() may be called from a worker thread.
+		 */
+		virtual bool CanInvalidateConcurrently() const;
+
+		/** Check if CalculateRequisition() may be called from a worker thread.
+		 * This is only the case if CalculateRequisition() does nothing but read the
+		 * widget's state, its properties and text metrics.
+		 * @return true if CalculateRequisition() may be called from a worker thread.
+		 */
+		virtual bool CanMeasureConcurrently() const;
+
+		/** Refresh this widget and all its descendants in a single pass.
+		 * Childless widgets are measured first, concurrently if the context has
+		 * worker threads. Their parents are measured afterwards and the hierarchy
+		 * is only allocated once. Only done if concurrent layout is enabled in the
+		 * context and the hierarchy is large enough to be worth it.
+		 * @return true if the hierarchy was refreshed, false if it still has to be.
+		 */
+		bool RefreshConcurrently();
+
 		/** Requisition implementation (recalculate requisition).
 		 * @return New requisition.
 		 */
@@ -425,6 +481,21 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 		 */
 		virtual void HandleViewportUpdate();
 
+		/** Handle transform change.
+		 */
+		virtual void HandleTransformUpdate();
+
+		/** Get position of the drawable relative to the offset of the widget's transform.
+		 * @return Position of the drawable relative to the offset of the widget's transform.
+		 */
+		sf::Vector2f GetDrawablePosition() const;
+
+		/** Check if any part of this widget lies within the visible area of its viewport.
+		 * Widgets that are not drawn in a Viewport are always considered visible.
+		 * @return true if any part of this widget lies within the visible area of its viewport.
+		 */
+		bool IsInViewport() const;
+
 		/** Set the focused widget.
 		 * @param widget Focused widget.
 		 */
@@ -462,11 +533,18 @@ class SFGUI_API Widget : public Object, public std::enable_shared_from_this<Widg
 
 		static const std::vector<Widget*>& GetRootWidgets();
 
+		void BuildDrawablesConcurrently();
+		void SetDrawable( std::unique_ptr<RenderQueue> drawable );
+
+		void CollectRefreshOrder( std::vector<Widget*>& widgets );
+		void ApplyRequisition( const sf::Vector2f& requisition );
+
 		sf::FloatRect m_allocation;
 		sf::Vector2f m_requisition;
 		std::unique_ptr<sf::Vector2f> m_custom_requisition;
 
 		std::shared_ptr<RendererViewport> m_viewport;
+		std::shared_ptr<RendererTransform> m_transform;
 
 		std::weak_ptr<Container> m_parent;
 
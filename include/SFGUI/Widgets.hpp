@@ -18,8 +18,11 @@
 #include <SFGUI/Fixed.hpp>
 #include <SFGUI/Frame.hpp>
 #include <SFGUI/Image.hpp>
-#include <SFGUI/Label.hpp>
+#include <SFGUI/Label.hpp>
+#include <SFGUI/ListView.hpp>
 #include <SFGUI/Notebook.hpp>
+#include <SFGUI/Profiler.hpp>
+#include <SFGUI/ProfilerOverlay.hpp>
 #include <SFGUI/ProgressBar.hpp>
 #include <SFGUI/RadioButton.hpp>
 #include <SFGUI/Range.hpp>
@@ -31,6 +34,8 @@
 #include <SFGUI/Spinner.hpp>
 #include <SFGUI/SpinButton.hpp>
 #include <SFGUI/Table.hpp>
-#include <SFGUI/ToggleButton.hpp>
+#include <SFGUI/ToggleButton.hpp>
+#include <SFGUI/TreeView.hpp>
+#include <SFGUI/TreeViewRow.hpp>
 #include <SFGUI/Viewport.hpp>
 #include <SFGUI/Window.hpp>
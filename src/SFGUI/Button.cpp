@@ -16,6 +16,10 @@ std::unique_ptr<RenderQueue> Button::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateButtonDrawable( std::dynamic_pointer_cast<const Button>( shared_from_this() ) );
 }
 
+bool Button::CanInvalidateConcurrently() const {
+	return true;
+}
+
 void Button::SetLabel( const sf::String& label ) {
 	m_label = label;
 	RequestResize();
@@ -99,6 +103,10 @@ sf::Vector2f Button::CalculateRequisition() {
 	return requisition;
 }
 
+bool Button::CanMeasureConcurrently() const {
+	return true;
+}
+
 const std::string& Button::GetName() const {
 	static const std::string name( "Button" );
 	return name;
@@ -8,6 +8,7 @@
 #include <SFGUI/Renderer.hpp>
 #include <SFGUI/Container.hpp>
 #include <SFGUI/RendererViewport.hpp>
+#include <SFGUI/RendererTransform.hpp>
 #include <SFGUI/RenderQueue.hpp>
 #include <SFGUI/Renderers/NonLegacyRenderer.hpp>
 #include <SFGUI/GLCheck.hpp>
@@ -226,7 +227,7 @@ Canvas::Canvas( bool depth ) :
 	m_resize( false )
 {
 	m_custom_viewport = Renderer::Get().CreateViewport();
-	SetViewport( m_custom_viewport );
+	m_custom_viewport->SetTransform( GetTransform() );
 
 	m_custom_draw_callback->Connect( [this] { DrawRenderTexture(); } );
 
@@ -330,6 +331,9 @@ void Canvas::HandleAbsolutePositionChange() {
 		parent = parent->GetParent();
 	}
 
+	// The destination origin is relative to our transform.
+	parent_position -= GetTransform()->GetOffset();
+
 	m_custom_viewport->SetDestinationOrigin(
 		sf::Vector2f(
 			std::floor( parent_position.x + position.x + .5f ),
@@ -340,6 +344,12 @@ void Canvas::HandleAbsolutePositionChange() {
 	Invalidate();
 }
 
+void Canvas::HandleTransformUpdate() {
+	m_custom_viewport->SetTransform( GetTransform() );
+
+	Widget::HandleTransformUpdate();
+}
+
 const std::string& Canvas::GetName() const {
 	static const std::string name( "Canvas" );
 	return name;
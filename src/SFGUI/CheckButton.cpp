@@ -41,6 +41,10 @@ sf::Vector2f CheckButton::CalculateRequisition() {
 	return requisition;
 }
 
+bool CheckButton::CanMeasureConcurrently() const {
+	return true;
+}
+
 void CheckButton::HandleSizeChange() {
 	float spacing( Context::Get().GetEngine().GetProperty<float>( "Spacing", shared_from_this() ) );
 	float box_size( Context::Get().GetEngine().GetProperty<float>( "BoxSize", shared_from_this() ) );
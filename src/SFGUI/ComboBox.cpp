@@ -31,7 +31,9 @@ ComboBox::ConstIterator end( const ComboBox& combo_box ) {
 ComboBox::ComboBox() :
 	m_active_item( NONE ),
 	m_highlighted_item( NONE ),
-	m_start_entry( 0 )
+	m_start_entry( 0 ),
+	m_max_entry_width( 0.f ),
+	m_measured_font_size( 0 )
 {
 }
 
@@ -43,6 +45,10 @@ std::unique_ptr<RenderQueue> ComboBox::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateComboBoxDrawable( std::dynamic_pointer_cast<const ComboBox>( shared_from_this() ) );
 }
 
+bool ComboBox::CanInvalidateConcurrently() const {
+	return true;
+}
+
 ComboBox::IndexType ComboBox::GetSelectedItem() const {
 	return m_active_item;
 }
@@ -61,7 +67,35 @@ void ComboBox::SelectItem( IndexType index ) {
 }
 
 void ComboBox::AppendItem( const sf::String& text ) {
+	auto old_max_entry_width = m_max_entry_width;
+
 	m_entries.push_back( text );
+	m_entry_widths.push_back( 0.f );
+
+	MeasureItems( m_entries.size() - 1, m_entries.size() );
+
+	if( IsMouseInWidget() ) {
+		SetState( State::PRELIGHT );
+	}
+	else {
+		SetState( State::NORMAL );
+	}
+
+	UpdateRequisition( old_max_entry_width );
+}
+
+void ComboBox::AppendItems( const std::vector<sf::String>& texts ) {
+	if( texts.empty() ) {
+		return;
+	}
+
+	auto old_max_entry_width = m_max_entry_width;
+	auto begin = m_entries.size();
+
+	m_entries.insert( m_entries.end(), texts.begin(), texts.end() );
+	m_entry_widths.resize( m_entries.size(), 0.f );
+
+	MeasureItems( begin, m_entries.size() );
 
 	if( IsMouseInWidget() ) {
 		SetState( State::PRELIGHT );
@@ -70,11 +104,16 @@ void ComboBox::AppendItem( const sf::String& text ) {
 		SetState( State::NORMAL );
 	}
 
-	RequestResize();
+	UpdateRequisition( old_max_entry_width );
 }
 
 void ComboBox::InsertItem( IndexType index, const sf::String& text ) {
+	auto old_max_entry_width = m_max_entry_width;
+
 	m_entries.insert( m_entries.begin() + index, text );
+	m_entry_widths.insert( m_entry_widths.begin() + index, 0.f );
+
+	MeasureItems( static_cast<std::size_t>( index ), static_cast<std::size_t>( index ) + 1 );
 
 	if( m_active_item != NONE && m_active_item >= index ) {
 		++m_active_item;
@@ -87,11 +126,16 @@ void ComboBox::InsertItem( IndexType index, const sf::String& text ) {
 		SetState( State::NORMAL );
 	}
 
-	RequestResize();
+	UpdateRequisition( old_max_entry_width );
 }
 
 void ComboBox::PrependItem( const sf::String& text ) {
+	auto old_max_entry_width = m_max_entry_width;
+
 	m_entries.insert( m_entries.begin(), text );
+	m_entry_widths.insert( m_entry_widths.begin(), 0.f );
+
+	MeasureItems( 0, 1 );
 
 	if( m_active_item != NONE ) {
 		++m_active_item;
@@ -104,7 +148,7 @@ void ComboBox::PrependItem( const sf::String& text ) {
 		SetState( State::NORMAL );
 	}
 
-	RequestResize();
+	UpdateRequisition( old_max_entry_width );
 }
 
 void ComboBox::ChangeItem( IndexType index, const sf::String& text ) {
@@ -112,8 +156,17 @@ void ComboBox::ChangeItem( IndexType index, const sf::String& text ) {
 		return;
 	}
 
+	auto old_max_entry_width = m_max_entry_width;
+
+	// The changed item might have been the widest one.
+	if( m_entry_widths[static_cast<std::size_t>( index )] >= m_max_entry_width ) {
+		m_max_entry_width = -1.f;
+	}
+
 	m_entries[static_cast<std::size_t>( index )] = text;
 
+	MeasureItems( static_cast<std::size_t>( index ), static_cast<std::size_t>( index ) + 1 );
+
 	if( IsMouseInWidget() ) {
 		SetState( State::PRELIGHT );
 	}
@@ -121,7 +174,7 @@ void ComboBox::ChangeItem( IndexType index, const sf::String& text ) {
 		SetState( State::NORMAL );
 	}
 
-	Invalidate();
+	UpdateRequisition( old_max_entry_width );
 }
 
 void ComboBox::RemoveItem( IndexType index ) {
@@ -129,7 +182,15 @@ void ComboBox::RemoveItem( IndexType index ) {
 		return;
 	}
 
+	auto old_max_entry_width = m_max_entry_width;
+
+	// Only removing the widest item can shrink the requisition.
+	if( m_entry_widths[static_cast<std::size_t>( index )] >= m_max_entry_width ) {
+		m_max_entry_width = -1.f;
+	}
+
 	m_entries.erase( m_entries.begin() + index );
+	m_entry_widths.erase( m_entry_widths.begin() + index );
 
 	// Make sure active item index keeps valid.
 	if( m_active_item != NONE ) {
@@ -148,7 +209,7 @@ void ComboBox::RemoveItem( IndexType index ) {
 		SetState( State::NORMAL );
 	}
 
-	Invalidate();
+	UpdateRequisition( old_max_entry_width );
 }
 
 void ComboBox::Clear() {
@@ -156,13 +217,17 @@ void ComboBox::Clear() {
 		return;
 	}
 
+	auto old_max_entry_width = m_max_entry_width;
+
 	m_entries.clear();
+	m_entry_widths.clear();
+	m_max_entry_width = 0.f;
 
 	m_active_item = NONE;
 
 	SetState( State::NORMAL );
 
-	Invalidate();
+	UpdateRequisition( old_max_entry_width );
 }
 
 ComboBox::ConstIterator ComboBox::Begin() const {
@@ -353,12 +418,20 @@ sf::Vector2f ComboBox::CalculateRequisition() {
 	unsigned int font_size( Context::Get().GetEngine().GetProperty<unsigned int>( "FontSize", shared_from_this() ) );
 	const sf::Font& font( *Context::Get().GetEngine().GetResourceManager().GetFont( font_name ) );
 
-	// Determine highest needed width of all items.
-	sf::Vector2f metrics( 0.f, 0.f );
-	for ( IndexType item = 0; item < GetItemCount(); ++item ) {
-		metrics.x = std::max( metrics.x, Context::Get().GetEngine().GetTextStringMetrics( m_entries[static_cast<std::size_t>( item )], font, font_size ).x );
+	// Item widths are cached, only remeasure them if the font changed.
+	MeasureItems( 0, 0 );
+
+	// The widest item was removed, find the new one.
+	if( m_max_entry_width < 0.f ) {
+		m_max_entry_width = 0.f;
+
+		for( auto width : m_entry_widths ) {
+			m_max_entry_width = std::max( m_max_entry_width, width );
+		}
 	}
 
+	sf::Vector2f metrics( m_max_entry_width, 0.f );
+
 	metrics.y = Context::Get().GetEngine().GetFontLineHeight( font, font_size );
 
 	// This is needed for the arrow.
@@ -372,6 +445,45 @@ sf::Vector2f ComboBox::CalculateRequisition() {
 	return requisition;
 }
 
+void ComboBox::MeasureItems( std::size_t begin, std::size_t end ) {
+	const std::string& font_name( Context::Get().GetEngine().GetProperty<std::string>( "FontName", shared_from_this() ) );
+	unsigned int font_size( Context::Get().GetEngine().GetProperty<unsigned int>( "FontSize", shared_from_this() ) );
+
+	// Cached widths are only valid for the font they were measured with.
+	if( ( font_name != m_measured_font_name ) || ( font_size != m_measured_font_size ) ) {
+		m_measured_font_name = font_name;
+		m_measured_font_size = font_size;
+
+		begin = 0;
+		end = m_entries.size();
+
+		m_max_entry_width = 0.f;
+	}
+
+	if( begin == end ) {
+		return;
+	}
+
+	const sf::Font& font( *Context::Get().GetEngine().GetResourceManager().GetFont( font_name ) );
+
+	for( auto item = begin; item < end; ++item ) {
+		m_entry_widths[item] = Context::Get().GetEngine().GetTextStringMetrics( m_entries[item], font, font_size ).x;
+
+		if( m_max_entry_width >= 0.f ) {
+			m_max_entry_width = std::max( m_max_entry_width, m_entry_widths[item] );
+		}
+	}
+}
+
+void ComboBox::UpdateRequisition( float old_max_entry_width ) {
+	// Resizing is only needed if the widest item changed.
+	if( m_max_entry_width != old_max_entry_width ) {
+		RequestResize();
+	}
+
+	Invalidate();
+}
+
 const std::string& ComboBox::GetName() const {
 	static const std::string name( "ComboBox" );
 	return name;
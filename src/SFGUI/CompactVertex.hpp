@@ -0,0 +1,121 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+#include <SFGUI/PrimitiveVertex.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <algorithm>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+
+namespace sfg {
+namespace priv {
+
+/** Interleaved 12 byte vertex used by the GL renderers.
+ * Positions are stored as 16-bit fixed point numbers, texture coordinates
+ * as 16-bit fixed point fractions of the atlas page and the color as RGBA8.
+ */
+struct CompactVertex {
+	std::int16_t x;
+	std::int16_t y;
+	std::uint16_t u;
+	std::uint16_t v;
+	sf::Color color;
+};
+
+static_assert( sizeof( CompactVertex ) == 12, "CompactVertex has to be tightly packed." );
+
+// Largest value representable by a compact position.
+const float compact_position_limit = 32767.f;
+
+// Largest number of steps per pixel compact positions are stored with.
+const float max_compact_position_scale = 16.f;
+
+// Multiple of the target size compact positions have to cover so
+// geometry slightly outside of the target isn't clamped.
+const float compact_position_margin = 2.f;
+
+/** Check if a target of the given size can be drawn with compact vertices.
+ * Positions are clamped to 16 bits, which leaves axis aligned geometry
+ * unchanged as long as the clamped range contains the whole target.
+ * @param max_target_size Largest possible size of the target.
+ * @return true if compact positions cover the target.
+ */
+inline bool CompactPositionsFit( int max_target_size ) {
+	return static_cast<float>( max_target_size ) <= compact_position_limit + 1.f;
+}
+
+/** Check if texture coordinates on the given atlas page size can be compacted.
+ * Compacted coordinates have to resolve at least half a texel.
+ * @param max_texture_size Largest possible size of an atlas page.
+ * @param texture_coordinate_scale Value a normalized coordinate of 1 is stored as.
+ * @return true if compact texture coordinates are precise enough.
+ */
+inline bool CompactTextureCoordinatesFit( int max_texture_size, float texture_coordinate_scale ) {
+	return static_cast<float>( max_texture_size ) * 2.f <= texture_coordinate_scale + 1.f;
+}
+
+/** Get the number of steps per pixel compact positions are stored with on a target.
+ * The finer the steps, the smaller the range of positions that can be
+ * stored. They are chosen as fine as possible while covering a multiple
+ * of the target size. Positions are snapped to the nearest step, which
+ * only moves geometry that isn't pixel aligned, e.g. triangles, diagonal
+ * lines and text at fractional positions, by a fraction of a pixel.
+ * Targets of up to 2048 pixels get steps of an eighth of a pixel.
+ * @param target_size Size of the target.
+ * @return Steps per pixel, a power of two.
+ */
+inline float CompactPositionScale( const sf::Vector2i& target_size ) {
+	const auto extent = static_cast<float>( std::max( target_size.x, target_size.y ) ) * compact_position_margin;
+
+	auto scale = max_compact_position_scale;
+
+	while( ( scale > 1.f ) && ( extent * scale > compact_position_limit + 1.f ) ) {
+		scale /= 2.f;
+	}
+
+	return scale;
+}
+
+/** Check if all vertices of a primitive can be stored as compact positions without clamping.
+ * @param vertices Vertices of the primitive.
+ * @param offset Offset added to every vertex.
+ * @param position_scale Steps per pixel positions are stored with.
+ * @return true if all positions fit.
+ */
+inline bool CompactPositionsFit( const std::vector<PrimitiveVertex>& vertices, const sf::Vector2f& offset, float position_scale ) {
+	const auto limit = compact_position_limit / position_scale;
+
+	for( const auto& vertex : vertices ) {
+		if( ( std::abs( vertex.position.x + offset.x ) > limit ) || ( std::abs( vertex.position.y + offset.y ) > limit ) ) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/** Compact a vertex.
+ * @param position Position in target coordinates.
+ * @param texture_coordinate Normalized texture coordinate.
+ * @param color Color.
+ * @param texture_coordinate_scale Value a normalized coordinate of 1 is stored as.
+ * @param position_scale Steps per pixel positions are stored with, see CompactPositionScale().
+ * @return Compact vertex.
+ */
+inline CompactVertex MakeCompactVertex( const sf::Vector2f& position, const sf::Vector2f& texture_coordinate, const sf::Color& color, float texture_coordinate_scale, float position_scale ) {
+	CompactVertex vertex;
+
+	vertex.x = static_cast<std::int16_t>( std::clamp( std::round( position.x * position_scale ), -compact_position_limit - 1.f, compact_position_limit ) );
+	vertex.y = static_cast<std::int16_t>( std::clamp( std::round( position.y * position_scale ), -compact_position_limit - 1.f, compact_position_limit ) );
+	vertex.u = static_cast<std::uint16_t>( std::clamp( texture_coordinate.x, 0.f, 1.f ) * texture_coordinate_scale + .5f );
+	vertex.v = static_cast<std::uint16_t>( std::clamp( texture_coordinate.y, 0.f, 1.f ) * texture_coordinate_scale + .5f );
+	vertex.color = color;
+
+	return vertex;
+}
+
+}
+}
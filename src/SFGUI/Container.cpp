@@ -1,4 +1,5 @@
 #include <SFGUI/Container.hpp>
+#include <SFGUI/ProfilerScope.hpp>
 
 #include <SFML/Window/Event.hpp>
 
@@ -9,6 +10,10 @@ namespace sfg {
 void Container::Add( Widget::Ptr widget ) {
 	if( HandleAdd( widget ) ) {
 		widget->SetParent( shared_from_this() );
+
+		// The widget might have been invalidated before it was added.
+		HandleChildInvalidate( widget );
+
 		RequestResize();
 	}
 }
@@ -46,6 +51,11 @@ const Container::WidgetsList& Container::GetChildren() const {
 }
 
 void Container::Refresh() {
+	// Root widgets refresh large hierarchies in a single pass.
+	if( !GetParent() && RefreshConcurrently() ) {
+		return;
+	}
+
 	for( const auto& child : m_children ) {
 		child->Refresh();
 	}
@@ -54,6 +64,8 @@ void Container::Refresh() {
 }
 
 void Container::HandleEvent( const sf::Event& event ) {
+	SFGUI_PROFILE_SCOPE( HANDLE_EVENT );
+
 	// Ignore event when widget is not visible.
 	if( !IsGloballyVisible() ) {
 		return;
@@ -99,6 +111,8 @@ void Container::HandleRemove( Widget::Ptr /*child*/ ) {
 }
 
 void Container::HandleChildInvalidate( Widget::PtrConst child ) const {
+	m_children_invalidated = true;
+
 	auto parent = GetParent();
 
 	if( parent ) {
@@ -106,6 +120,22 @@ void Container::HandleChildInvalidate( Widget::PtrConst child ) const {
 	}
 }
 
+void Container::CollectConcurrentInvalidations( std::vector<Widget*>& widgets ) {
+	Widget::CollectConcurrentInvalidations( widgets );
+
+	// Widgets that are scrolled out of their viewport aren't collected
+	// again, Update() builds their drawable once they are scrolled back.
+	if( !m_children_invalidated ) {
+		return;
+	}
+
+	m_children_invalidated = false;
+
+	for( const auto& child : m_children ) {
+		child->CollectConcurrentInvalidations( widgets );
+	}
+}
+
 void Container::HandleAbsolutePositionChange() {
 	// Update children's drawable positions.
 	for( const auto& child : m_children ) {
@@ -148,4 +178,12 @@ void Container::HandleViewportUpdate() {
 	Widget::HandleViewportUpdate();
 }
 
+void Container::HandleTransformUpdate() {
+	for( const auto& child : m_children ) {
+		child->SetTransform( GetTransform() );
+	}
+
+	Widget::HandleTransformUpdate();
+}
+
 }
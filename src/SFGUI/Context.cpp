@@ -1,6 +1,7 @@
 #include <SFGUI/Context.hpp>
 #include <SFGUI/Engine.hpp>
 #include <SFGUI/Engines/BREW.hpp>
+#include <SFGUI/ThreadPool.hpp>
 
 namespace {
 
@@ -40,7 +41,8 @@ bool Context::Deactivate() {
 }
 
 Context::Context() :
-	m_engine( nullptr )
+	m_engine( nullptr ),
+	m_concurrent_layout( false )
 {
 }
 
@@ -76,4 +78,36 @@ std::shared_ptr<Widget> Context::GetActiveWidget() const {
 	return m_active_widget.lock();
 }
 
+void Context::SetWorkerThreadCount( unsigned int count ) {
+	if( count == GetWorkerThreadCount() ) {
+		return;
+	}
+
+	m_thread_pool.reset();
+
+	if( count ) {
+		m_thread_pool = std::make_shared<priv::ThreadPool>( count );
+	}
+}
+
+unsigned int Context::GetWorkerThreadCount() const {
+	return m_thread_pool ? m_thread_pool->GetThreadCount() : 0;
+}
+
+void Context::SetConcurrentLayout( bool enable ) {
+	m_concurrent_layout = enable;
+}
+
+bool Context::IsConcurrentLayoutEnabled() const {
+	return m_concurrent_layout;
+}
+
+/// @cond
+
+priv::ThreadPool* Context::GetThreadPool() const {
+	return m_thread_pool.get();
+}
+
+/// @endcond
+
 }
@@ -1,14 +1,31 @@
 #include <SFGUI/Desktop.hpp>
 #include <SFGUI/Widget.hpp>
+#include <SFGUI/ProfilerScope.hpp>
 
 #include <SFML/Window/Event.hpp>
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <limits>
 
 namespace sfg {
 
+struct Desktop::ThemeWatch {
+	std::string filename;
+	std::filesystem::file_time_type time;
+	float interval;
+	float elapsed;
+};
+
+Desktop::Desktop() {
+}
+
+Desktop::~Desktop() {
+}
+
 void Desktop::Update( float seconds ) {
+	CheckWatchedThemeFile( seconds );
+
 	Context::Activate( m_context );
 
 	std::reverse_iterator<WidgetsList::iterator> iter( std::end( m_children ) );
@@ -22,6 +39,8 @@ void Desktop::Update( float seconds ) {
 }
 
 void Desktop::HandleEvent( const sf::Event& event ) {
+	SFGUI_PROFILE_SCOPE( HANDLE_EVENT );
+
 	// Activate context.
 	Context::Activate( m_context );
 
@@ -173,13 +192,112 @@ void Desktop::Refresh() {
 }
 
 bool Desktop::LoadThemeFromFile( const std::string& filename ) {
+	Context::Activate( m_context );
+
 	bool result( m_context.GetEngine().LoadThemeFromFile( filename ) );
-	if( !result ) {
-		return false;
+
+	if( result ) {
+		RefreshAfterThemeChange();
+	}
+
+	Context::Deactivate();
+
+	return result;
+}
+
+bool Desktop::WatchThemeFile( const std::string& filename, float interval ) {
+	std::error_code error;
+	auto time = std::filesystem::last_write_time( filename, error );
+
+	m_theme_watch.reset( new ThemeWatch{ filename, time, interval, 0.f } );
+
+	return LoadThemeFromFile( filename );
+}
+
+void Desktop::StopWatchingThemeFile() {
+	m_theme_watch.reset();
+}
+
+void Desktop::CheckWatchedThemeFile( float seconds ) {
+	if( !m_theme_watch ) {
+		return;
+	}
+
+	m_theme_watch->elapsed += seconds;
+
+	if( m_theme_watch->elapsed < m_theme_watch->interval ) {
+		return;
+	}
+
+	m_theme_watch->elapsed = 0.f;
+
+	std::error_code error;
+	auto time = std::filesystem::last_write_time( m_theme_watch->filename, error );
+
+	// The file might be in the middle of being replaced.
+	if( error || ( time == m_theme_watch->time ) ) {
+		return;
+	}
+
+	m_theme_watch->time = time;
+
+	LoadThemeFromFile( m_theme_watch->filename );
+}
+
+void Desktop::BeginThemeUpdate() {
+	m_context.GetEngine().BeginThemeUpdate();
+	++m_theme_update_depth;
+}
+
+void Desktop::EndThemeUpdate() {
+	if( !m_theme_update_depth ) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "SFGUI warning: EndThemeUpdate() called without matching BeginThemeUpdate().\n";
+#endif
+		return;
+	}
+
+	--m_theme_update_depth;
+
+	Context::Activate( m_context );
+
+	m_context.GetEngine().EndThemeUpdate();
+
+	if( !m_theme_update_depth && m_refresh_pending ) {
+		m_refresh_pending = false;
+
+		RefreshAfterThemeChange();
+	}
+
+	Context::Deactivate();
+}
+
+void Desktop::RefreshAfterThemeChange() {
+	if( m_theme_update_depth ) {
+		m_refresh_pending = true;
+		return;
 	}
 
-	Refresh();
-	return true;
+	// Only refresh widgets whose style changed. If the engine refreshes
+	// widgets automatically, it already did and there is nothing left to do.
+	std::reverse_iterator<WidgetsList::iterator> iter( std::end( m_children ) );
+	std::reverse_iterator<WidgetsList::iterator> finish( std::begin( m_children ) );
+
+	for( ; iter != finish; ++iter ) {
+		(*iter)->RefreshStyle();
+	}
+
+	m_context.GetEngine().ClearStyleChanges();
+}
+
+Desktop::ThemeUpdate::ThemeUpdate( Desktop& desktop ) :
+	m_desktop( desktop )
+{
+	m_desktop.BeginThemeUpdate();
+}
+
+Desktop::ThemeUpdate::~ThemeUpdate() {
+	m_desktop.EndThemeUpdate();
 }
 
 Engine& Desktop::GetEngine() {
@@ -227,12 +345,17 @@ void Desktop::RecalculateWidgetLevels() {
 }
 
 bool Desktop::SetProperties( const std::string& properties ) {
-	if( !m_context.GetEngine().SetProperties( properties ) ) {
-		return false;
+	Context::Activate( m_context );
+
+	auto result = m_context.GetEngine().SetProperties( properties );
+
+	if( result ) {
+		RefreshAfterThemeChange();
 	}
 
-	Refresh();
-	return true;
+	Context::Deactivate();
+
+	return result;
 }
 
 }
@@ -0,0 +1,252 @@
+#include <SFGUI/DistanceFieldFont.hpp>
+#include <SFGUI/PrimitiveTexture.hpp>
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Width of the distance field image, glyphs are packed into rows.
+const int image_width = 1024;
+
+// Empty space between glyph cells so bilinear sampling never reaches a neighbour.
+const int cell_padding = 1;
+
+// Offset of a pixel to its nearest seed pixel.
+struct SeedOffset {
+	int x;
+	int y;
+
+	int SquaredDistance() const {
+		return x * x + y * y;
+	}
+};
+
+void CompareSeed( std::vector<SeedOffset>& grid, int width, int height, int x, int y, int offset_x, int offset_y ) {
+	auto neighbour_x = x + offset_x;
+	auto neighbour_y = y + offset_y;
+
+	if( ( neighbour_x < 0 ) || ( neighbour_y < 0 ) || ( neighbour_x >= width ) || ( neighbour_y >= height ) ) {
+		return;
+	}
+
+	auto candidate = grid[static_cast<std::size_t>( neighbour_y * width + neighbour_x )];
+	candidate.x += offset_x;
+	candidate.y += offset_y;
+
+	auto& current = grid[static_cast<std::size_t>( y * width + x )];
+
+	if( candidate.SquaredDistance() < current.SquaredDistance() ) {
+		current = candidate;
+	}
+}
+
+// 8SSEDT, two passes over the grid propagating the offset to the nearest seed.
+void PropagateSeeds( std::vector<SeedOffset>& grid, int width, int height ) {
+	for( int y = 0; y < height; ++y ) {
+		for( int x = 0; x < width; ++x ) {
+			CompareSeed( grid, width, height, x, y, -1, 0 );
+			CompareSeed( grid, width, height, x, y, 0, -1 );
+			CompareSeed( grid, width, height, x, y, -1, -1 );
+			CompareSeed( grid, width, height, x, y, 1, -1 );
+		}
+
+		for( int x = width - 1; x >= 0; --x ) {
+			CompareSeed( grid, width, height, x, y, 1, 0 );
+		}
+	}
+
+	for( int y = height - 1; y >= 0; --y ) {
+		for( int x = width - 1; x >= 0; --x ) {
+			CompareSeed( grid, width, height, x, y, 1, 0 );
+			CompareSeed( grid, width, height, x, y, 0, 1 );
+			CompareSeed( grid, width, height, x, y, -1, 1 );
+			CompareSeed( grid, width, height, x, y, 1, 1 );
+		}
+
+		for( int x = 0; x < width; ++x ) {
+			CompareSeed( grid, width, height, x, y, -1, 0 );
+		}
+	}
+}
+
+}
+
+namespace sfg {
+namespace priv {
+
+DistanceFieldFont::DistanceFieldFont( const sf::Font& font, const std::vector<std::pair<std::uint32_t, std::uint32_t>>& character_sets ) {
+	std::vector<std::pair<std::uint32_t, std::uint32_t>> ranges( character_sets );
+
+	// Same default as the bitmap fonts.
+	if( ranges.empty() ) {
+		ranges.emplace_back( 0, 0x0370 );
+	}
+
+	// Rasterize all glyphs first so the glyph page only has to be copied once.
+	std::vector<std::uint32_t> codepoints;
+
+	for( const auto& range : ranges ) {
+		for( auto codepoint = range.first; codepoint < range.second; ++codepoint ) {
+			const auto& glyph = font.getGlyph( codepoint, reference_size, false );
+
+			if( ( glyph.advance != 0.f ) || ( glyph.textureRect.size.x > 0 ) ) {
+				codepoints.push_back( codepoint );
+			}
+		}
+	}
+
+	const auto page = font.getTexture( reference_size ).copyToImage();
+	const auto page_pixels = page.getPixelsPtr();
+	const auto page_width = static_cast<int>( page.getSize().x );
+
+	// Pack the glyph cells into rows.
+	std::vector<sf::IntRect> cells;
+	cells.reserve( codepoints.size() );
+
+	sf::Vector2i pen( cell_padding, cell_padding );
+	auto row_height = 0;
+
+	for( auto codepoint : codepoints ) {
+		const auto& glyph = font.getGlyph( codepoint, reference_size, false );
+
+		if( ( glyph.textureRect.size.x <= 0 ) || ( glyph.textureRect.size.y <= 0 ) ) {
+			cells.emplace_back();
+			continue;
+		}
+
+		const sf::Vector2i cell_size( glyph.textureRect.size.x + 2 * spread, glyph.textureRect.size.y + 2 * spread );
+
+		if( pen.x + cell_size.x + cell_padding > image_width ) {
+			pen.x = cell_padding;
+			pen.y += row_height + cell_padding;
+			row_height = 0;
+		}
+
+		cells.emplace_back( pen, cell_size );
+
+		pen.x += cell_size.x + cell_padding;
+		row_height = std::max( row_height, cell_size.y );
+	}
+
+	const auto image_height = pen.y + row_height + cell_padding;
+
+	// The color is white so the coverage is fully defined by the alpha channel.
+	std::vector<std::uint8_t> pixels( static_cast<std::size_t>( image_width * image_height * 4 ), 255 );
+
+	for( std::size_t index = 3; index < pixels.size(); index += 4 ) {
+		pixels[index] = 0;
+	}
+
+	std::vector<SeedOffset> inside;
+	std::vector<SeedOffset> outside;
+	std::vector<std::uint8_t> coverage;
+
+	const SeedOffset unreached = { 4096, 4096 };
+	const SeedOffset seed = { 0, 0 };
+
+	for( std::size_t index = 0; index < codepoints.size(); ++index ) {
+		const auto& glyph = font.getGlyph( codepoints[index], reference_size, false );
+		const auto& cell = cells[index];
+
+		DistanceFieldGlyph distance_field_glyph;
+
+		distance_field_glyph.advance = glyph.advance;
+
+		if( cell.size.x <= 0 ) {
+			m_glyphs[codepoints[index]] = distance_field_glyph;
+			continue;
+		}
+
+		const auto width = cell.size.x;
+		const auto height = cell.size.y;
+		const auto cell_pixel_count = static_cast<std::size_t>( width * height );
+
+		coverage.assign( cell_pixel_count, 0 );
+
+		for( int y = 0; y < glyph.textureRect.size.y; ++y ) {
+			for( int x = 0; x < glyph.textureRect.size.x; ++x ) {
+				const auto page_index = ( glyph.textureRect.position.y + y ) * page_width + glyph.textureRect.position.x + x;
+				coverage[static_cast<std::size_t>( ( y + spread ) * width + x + spread )] = page_pixels[static_cast<std::size_t>( page_index * 4 + 3 )];
+			}
+		}
+
+		// Distance of inside pixels to the outside and the other way around.
+		inside.resize( cell_pixel_count );
+		outside.resize( cell_pixel_count );
+
+		for( std::size_t pixel = 0; pixel < cell_pixel_count; ++pixel ) {
+			const auto is_inside = coverage[pixel] >= 128;
+
+			inside[pixel] = is_inside ? unreached : seed;
+			outside[pixel] = is_inside ? seed : unreached;
+		}
+
+		PropagateSeeds( inside, width, height );
+		PropagateSeeds( outside, width, height );
+
+		for( int y = 0; y < height; ++y ) {
+			for( int x = 0; x < width; ++x ) {
+				const auto pixel = static_cast<std::size_t>( y * width + x );
+				const auto alpha = coverage[pixel];
+
+				float distance = 0.f;
+
+				if( ( alpha > 0 ) && ( alpha < 255 ) ) {
+					// Antialiased edge pixels already tell how far the outline is.
+					distance = static_cast<float>( alpha ) / 255.f - .5f;
+				}
+				else if( alpha ) {
+					distance = std::sqrt( static_cast<float>( inside[pixel].SquaredDistance() ) ) - .5f;
+				}
+				else {
+					distance = .5f - std::sqrt( static_cast<float>( outside[pixel].SquaredDistance() ) );
+				}
+
+				const auto value = std::clamp( .5f + distance / static_cast<float>( 2 * spread ), 0.f, 1.f );
+
+				pixels[static_cast<std::size_t>( ( ( cell.position.y + y ) * image_width + cell.position.x + x ) * 4 + 3 )] = static_cast<std::uint8_t>( value * 255.f + .5f );
+			}
+		}
+
+		distance_field_glyph.bounds = sf::FloatRect(
+			glyph.bounds.position - sf::Vector2f( static_cast<float>( spread ), static_cast<float>( spread ) ),
+			glyph.bounds.size + sf::Vector2f( static_cast<float>( 2 * spread ), static_cast<float>( 2 * spread ) )
+		);
+		distance_field_glyph.texture_rect = sf::FloatRect( cell );
+
+		m_glyphs[codepoints[index]] = distance_field_glyph;
+	}
+
+	m_image.resize( { static_cast<unsigned int>( image_width ), static_cast<unsigned int>( image_height ) }, pixels.data() );
+}
+
+const DistanceFieldGlyph* DistanceFieldFont::GetGlyph( std::uint32_t codepoint ) const {
+	auto iter = m_glyphs.find( codepoint );
+
+	if( iter == m_glyphs.end() ) {
+		return nullptr;
+	}
+
+	return &iter->second;
+}
+
+const sf::Image& DistanceFieldFont::GetImage() const {
+	return m_image;
+}
+
+std::shared_ptr<PrimitiveTexture> DistanceFieldFont::GetTexture() const {
+	return m_texture;
+}
+
+void DistanceFieldFont::SetTexture( std::shared_ptr<PrimitiveTexture> texture ) {
+	m_texture = texture;
+
+	// The atlas holds the only copy we need from now on.
+	m_image = sf::Image();
+}
+
+}
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <cstdint>
+
+namespace sf {
+class Font;
+}
+
+namespace sfg {
+
+class PrimitiveTexture;
+
+namespace priv {
+
+/** Glyph of a distance field font.
+ * Metrics are given at the reference size and scaled to the requested
+ * character size when text is laid out.
+ */
+struct DistanceFieldGlyph {
+	sf::FloatRect bounds; // Bounds relative to the pen position, including the spread.
+	sf::FloatRect texture_rect; // Area of the glyph in the distance field image.
+	float advance;
+};
+
+/** Signed distance field glyph atlas of a font face.
+ * Glyphs are rasterized once at the reference size and converted into
+ * a distance field stored in the alpha channel, 0.5 being the outline.
+ * Text of any character size can be drawn from it by a shader that
+ * thresholds the interpolated distance.
+ */
+class DistanceFieldFont {
+	public:
+		static const unsigned int reference_size = 32; // Character size the glyphs are rasterized at.
+		static const int spread = 4; // Distance in pixels at the reference size covered by the field.
+
+		/** Ctor.
+		 * Generates the distance field image of all glyphs in the given character sets.
+		 * @param font Font to generate the glyphs from.
+		 * @param character_sets Codepoint ranges to load, Latin and its extensions if empty.
+		 */
+		DistanceFieldFont( const sf::Font& font, const std::vector<std::pair<std::uint32_t, std::uint32_t>>& character_sets );
+
+		/** Get a glyph.
+		 * @param codepoint Codepoint of the glyph.
+		 * @return Glyph or nullptr if the codepoint wasn't loaded.
+		 */
+		const DistanceFieldGlyph* GetGlyph( std::uint32_t codepoint ) const;
+
+		/** Get the distance field image.
+		 * The image is released once the texture has been set.
+		 * @return Distance field image.
+		 */
+		const sf::Image& GetImage() const;
+
+		/** Get the texture the distance field image was loaded into.
+		 * @return Texture handle or nullptr if not loaded yet.
+		 */
+		std::shared_ptr<PrimitiveTexture> GetTexture() const;
+
+		/** Set the texture the distance field image was loaded into.
+		 * @param texture Texture handle.
+		 */
+		void SetTexture( std::shared_ptr<PrimitiveTexture> texture );
+
+	private:
+		std::map<std::uint32_t, DistanceFieldGlyph> m_glyphs;
+		sf::Image m_image;
+		std::shared_ptr<PrimitiveTexture> m_texture;
+};
+
+}
+}
@@ -1,6 +1,9 @@
 #include <SFGUI/Engine.hpp>
 #include <SFGUI/Selector.hpp>
 #include <SFGUI/Widget.hpp>
+#include <SFGUI/Context.hpp>
+#include <SFGUI/Renderer.hpp>
+#include <SFGUI/DistanceFieldFont.hpp>
 #include <SFGUI/RenderQueue.hpp>
 #include <SFGUI/Parsers/ThemeParser/Parse.hpp>
 
@@ -8,6 +11,14 @@
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Color.hpp>
 #include <fstream>
+#include <functional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <map>
+#include <tuple>
+#include <cstdint>
+#include <cstring>
 #include <algorithm>
 #include <cstdlib>
 
@@ -51,10 +62,237 @@ std::istream& operator>>( std::istream& stream, Color& color ) {
 }
 
 
+namespace {
+
+// sf::Font loads glyphs on demand and isn't thread-safe. Text metrics are
+// cached per font and size so they can be looked up from multiple threads,
+// fonts are only touched under the font mutex to load missing metrics.
+// Distance field text is laid out from the glyphs at the reference size
+// scaled to the character size, its metrics are cached separately.
+struct GlyphMetrics {
+	float advance;
+	float height;
+};
+
+struct FontMetrics {
+	std::unordered_map<std::uint32_t, GlyphMetrics> glyphs;
+	std::unordered_map<std::uint64_t, float> kernings;
+	float line_spacing;
+};
+
+// Typed property values are formatted as strings on first use, possibly
+// by multiple threads building drawables at once.
+std::mutex property_string_mutex;
+
+std::shared_mutex font_metrics_mutex;
+std::map<std::tuple<const sf::Font*, unsigned int, bool>, FontMetrics> font_metrics_cache;
+
+class FontMetricsLookup {
+	public:
+		// Missing metrics are only loaded if a font is passed.
+		FontMetricsLookup( FontMetrics& metrics, const sf::Font* font, unsigned int font_size, bool distance_field ) :
+			m_metrics( metrics ),
+			m_font( font ),
+			m_glyph_size( distance_field ? sfg::priv::DistanceFieldFont::reference_size : font_size ),
+			m_glyph_scale( static_cast<float>( font_size ) / static_cast<float>( m_glyph_size ) )
+		{
+		}
+
+		const GlyphMetrics* GetGlyph( std::uint32_t character ) {
+			auto iter = m_metrics.glyphs.find( character );
+
+			if( iter != m_metrics.glyphs.end() ) {
+				return &iter->second;
+			}
+
+			if( !m_font ) {
+				return nullptr;
+			}
+
+			const auto& glyph = m_font->getGlyph( character, m_glyph_size, false );
+
+			return &( m_metrics.glyphs[character] = GlyphMetrics{ glyph.advance * m_glyph_scale, glyph.bounds.size.y * m_glyph_scale } );
+		}
+
+		bool GetKerning( std::uint32_t first, std::uint32_t second, float& kerning ) {
+			auto id = ( static_cast<std::uint64_t>( first ) << 32 ) | second;
+			auto iter = m_metrics.kernings.find( id );
+
+			if( iter != m_metrics.kernings.end() ) {
+				kerning = iter->second;
+				return true;
+			}
+
+			if( !m_font ) {
+				return false;
+			}
+
+			// Scaled from the reference size for distance field text, just like the advances.
+			kerning = m_metrics.kernings[id] = static_cast<float>( m_font->getKerning( first, second, m_glyph_size ) ) * m_glyph_scale;
+			return true;
+		}
+
+		float GetLineSpacing() const {
+			return m_metrics.line_spacing;
+		}
+
+	private:
+		FontMetrics& m_metrics;
+		const sf::Font* m_font;
+		unsigned int m_glyph_size;
+		float m_glyph_scale;
+};
+
+// Measure returns false if it needs metrics that aren't cached yet,
+// it is then called again with a lookup that loads them.
+template<typename Measure>
+sf::Vector2f MeasureText( const sf::Font& font, unsigned int font_size, Measure measure ) {
+	auto distance_field = sfg::Renderer::Exists() && sfg::Renderer::Get().UsesDistanceFieldText();
+
+	std::tuple<const sf::Font*, unsigned int, bool> id( &font, font_size, distance_field );
+	sf::Vector2f metrics( 0.f, 0.f );
+
+	{
+		std::shared_lock<std::shared_mutex> lock( font_metrics_mutex );
+
+		auto iter = font_metrics_cache.find( id );
+
+		if( iter != font_metrics_cache.end() ) {
+			FontMetricsLookup lookup( iter->second, nullptr, font_size, distance_field );
+
+			if( measure( lookup, metrics ) ) {
+				return metrics;
+			}
+		}
+	}
+
+	std::lock_guard<std::recursive_mutex> font_lock( sfg::Engine::GetFontMutex() );
+	std::lock_guard<std::shared_mutex> lock( font_metrics_mutex );
+
+	auto iter = font_metrics_cache.find( id );
+
+	if( iter == font_metrics_cache.end() ) {
+		iter = font_metrics_cache.emplace( id, FontMetrics{ {}, {}, static_cast<float>( font.getLineSpacing( font_size ) ) } ).first;
+	}
+
+	FontMetricsLookup lookup( iter->second, &font, font_size, distance_field );
+	measure( lookup, metrics );
+
+	return metrics;
+}
+
+// Selectors separated by grouping combinators are returned separately.
+std::vector<sfg::Selector::Ptr> CreateSelectors( const sfg::parser::theme::Selector& parsed_selector ) {
+	std::vector<sfg::Selector::Ptr> selectors;
+	sfg::Selector::Ptr selector;
+
+	// Iterate over all simple selectors
+	for( const auto& simple_selector : parsed_selector.m_simple_selectors ) {
+		auto hierarchy = sfg::Selector::HierarchyType::ROOT;
+
+		if( simple_selector.m_combinator == ">" ) {
+			hierarchy = sfg::Selector::HierarchyType::CHILD;
+		}
+		else if( simple_selector.m_combinator == " " ) {
+			hierarchy = sfg::Selector::HierarchyType::DESCENDANT;
+		}
+		else if( simple_selector.m_combinator == "," ) {
+			// Grouping combinator detected. The current selector is complete,
+			// the next simple selector is the root of a new chain.
+			selectors.push_back( selector );
+			selector = sfg::Selector::Ptr();
+		}
+
+		selector = sfg::Selector::Create(
+			simple_selector.m_type_selector,
+			simple_selector.m_id_selector,
+			simple_selector.m_class_selector,
+			simple_selector.m_state_selector,
+			hierarchy,
+			selector
+		);
+	}
+
+	if( selector ) {
+		selectors.push_back( selector );
+	}
+
+	return selectors;
+}
+
+// Compiled theme layout, integers in native byte order:
+// Header, string entries, selectors (parents first),
+// properties (in priority order), string characters.
+const char compiled_theme_magic[4] = { 'S', 'F', 'G', 'T' };
+const std::uint32_t compiled_theme_version = 1;
+const std::uint32_t compiled_theme_byte_order = 0x01020304;
+const std::uint32_t compiled_theme_no_index = 0xffffffff;
+
+struct CompiledThemeHeader {
+	char magic[4];
+	std::uint32_t version;
+	std::uint32_t byte_order;
+	std::uint32_t string_count;
+	std::uint32_t selector_count;
+	std::uint32_t property_count;
+	// Selector hashes are only valid if std::hash yields the same here.
+	std::uint64_t hash_check;
+};
+
+struct CompiledString {
+	std::uint32_t offset;
+	std::uint32_t length;
+};
+
+struct CompiledSelector {
+	std::uint32_t widget;
+	std::uint32_t id;
+	std::uint32_t class_;
+	std::uint32_t parent;
+	std::uint64_t hash;
+	std::int32_t score;
+	std::int8_t state;
+	std::uint8_t hierarchy;
+	std::uint8_t padding[2];
+};
+
+struct CompiledProperty {
+	std::uint32_t property;
+	std::uint32_t widget;
+	std::uint32_t selector;
+	std::uint32_t value;
+};
+
+std::uint64_t GetCompiledThemeHashCheck() {
+	return static_cast<std::uint64_t>( std::hash<std::string>()( "SFGUI" ) );
+}
+
+template<typename T>
+void AppendCompiled( std::vector<char>& buffer, const T& value ) {
+	auto bytes = reinterpret_cast<const char*>( &value );
+	buffer.insert( buffer.end(), bytes, bytes + sizeof( T ) );
+}
+
+template<typename T>
+bool ReadCompiled( const char*& data, const char* end, T& value ) {
+	if( static_cast<std::size_t>( end - data ) < sizeof( T ) ) {
+		return false;
+	}
+
+	std::memcpy( &value, data, sizeof( T ) );
+	data += sizeof( T );
+
+	return true;
+}
+
+}
+
 namespace sfg {
 
 Engine::Engine() :
-	m_auto_refresh( false )
+	m_theme_update_depth( 0 ),
+	m_auto_refresh( false ),
+	m_refresh_pending( false )
 {
 }
 
@@ -62,6 +300,7 @@ sf::Vector2f Engine::GetFontHeightProperties( const sf::Font& font, unsigned int
 	// We want to cache line height values because they are expensive to compute.
 
 	static std::map<std::pair<void*, unsigned int>, sf::Vector2f> height_property_cache;
+	static std::shared_mutex height_property_mutex;
 
 	// Get the font face that Laurent tries to hide from us.
 	struct FontStruct {
@@ -82,12 +321,18 @@ sf::Vector2f Engine::GetFontHeightProperties( const sf::Font& font, unsigned int
 
 	std::pair<void*, unsigned int> id( face, font_size );
 
-	std::map<std::pair<void*, unsigned int>, sf::Vector2f>::iterator iter( height_property_cache.find( id ) );
+	{
+		std::shared_lock<std::shared_mutex> lock( height_property_mutex );
+
+		std::map<std::pair<void*, unsigned int>, sf::Vector2f>::iterator iter( height_property_cache.find( id ) );
 
-	if( iter != height_property_cache.end() ) {
-		return iter->second;
+		if( iter != height_property_cache.end() ) {
+			return iter->second;
+		}
 	}
 
+	std::lock_guard<std::recursive_mutex> font_lock( GetFontMutex() );
+
 	sf::Vector2f properties( 0.f, 0.f );
 
 	if( m_character_sets.empty() ) {
@@ -106,6 +351,7 @@ sf::Vector2f Engine::GetFontHeightProperties( const sf::Font& font, unsigned int
 		}
 	}
 
+	std::lock_guard<std::shared_mutex> lock( height_property_mutex );
 	height_property_cache[id] = properties;
 
 	return properties;
@@ -120,106 +366,147 @@ float Engine::GetFontBaselineOffset( const sf::Font& font, unsigned int font_siz
 }
 
 float Engine::GetFontLineSpacing( const sf::Font& font, unsigned int font_size ) const {
-	return static_cast<float>( font.getLineSpacing( font_size ) );
+	return MeasureText( font, font_size, []( FontMetricsLookup& lookup, sf::Vector2f& metrics ) {
+		metrics.y = lookup.GetLineSpacing();
+		return true;
+	} ).y;
 }
 
 sf::Vector2f Engine::GetTextStringMetrics( const std::u32string& string, const sf::Font& font, unsigned int font_size ) const {
-	// SFML is incapable of giving us the metrics we need so we have to do it ourselves.
-	auto horizontal_spacing = static_cast<float>( font.getGlyph( L' ', font_size, false ).advance );
-	auto vertical_spacing = static_cast<float>( font.getLineSpacing( font_size ) );
+	return MeasureText( font, font_size, [&string]( FontMetricsLookup& lookup, sf::Vector2f& metrics ) {
+		// SFML is incapable of giving us the metrics we need so we have to do it ourselves.
+		auto space_glyph = lookup.GetGlyph( L' ' );
 
-	sf::Vector2f metrics( 0.f, 0.f );
-
-	const static auto tab_spaces = 2.f;
-
-	std::uint32_t previous_character = 0;
-
-	auto longest_line = 0.f;
-
-	for( const auto& current_character : string ) {
-		metrics.x += static_cast<float>( font.getKerning( previous_character, current_character, font_size ) );
-
-		switch( current_character ) {
-			case L' ':
-				metrics.x += horizontal_spacing;
-				continue;
-			case L'\t':
-				metrics.x += horizontal_spacing * tab_spaces;
-				continue;
-			case L'\n':
-				metrics.y += vertical_spacing;
-				longest_line = std::max( metrics.x, longest_line );
-				metrics.x = 0.f;
-				continue;
-			case L'\v':
-				metrics.y += vertical_spacing * tab_spaces;
-				continue;
-			default:
-				break;
+		if( !space_glyph ) {
+			return false;
 		}
 
-		const auto& glyph = font.getGlyph( current_character, font_size, false );
+		auto horizontal_spacing = space_glyph->advance;
+		auto vertical_spacing = lookup.GetLineSpacing();
 
-		metrics.x += static_cast<float>( glyph.advance );
-		metrics.y = std::max( metrics.y, static_cast<float>( glyph.bounds.size.y ) );
-	}
+		metrics = sf::Vector2f( 0.f, 0.f );
 
-	metrics.x = std::max( longest_line, metrics.x );
+		const static auto tab_spaces = 2.f;
 
-	return metrics;
+		std::uint32_t previous_character = 0;
+
+		auto longest_line = 0.f;
+
+		for( const auto& current_character : string ) {
+			auto kerning = 0.f;
+
+			if( !lookup.GetKerning( previous_character, current_character, kerning ) ) {
+				return false;
+			}
+
+			metrics.x += kerning;
+
+			switch( current_character ) {
+				case L' ':
+					metrics.x += horizontal_spacing;
+					continue;
+				case L'\t':
+					metrics.x += horizontal_spacing * tab_spaces;
+					continue;
+				case L'\n':
+					metrics.y += vertical_spacing;
+					longest_line = std::max( metrics.x, longest_line );
+					metrics.x = 0.f;
+					continue;
+				case L'\v':
+					metrics.y += vertical_spacing * tab_spaces;
+					continue;
+				default:
+					break;
+			}
+
+			auto glyph = lookup.GetGlyph( current_character );
+
+			if( !glyph ) {
+				return false;
+			}
+
+			metrics.x += glyph->advance;
+			metrics.y = std::max( metrics.y, glyph->height );
+		}
+
+		metrics.x = std::max( longest_line, metrics.x );
+
+		return true;
+	} );
 }
 
 sf::Vector2f Engine::GetTextStringMetrics( const sf::String& string, const sf::Font& font, unsigned int font_size ) const {
-	// SFML is incapable of giving us the metrics we need so we have to do it ourselves.
-	auto horizontal_spacing = static_cast<float>( font.getGlyph( L' ', font_size, false ).advance );
-	auto vertical_spacing = static_cast<float>( font.getLineSpacing( font_size ) );
+	return MeasureText( font, font_size, [&string]( FontMetricsLookup& lookup, sf::Vector2f& metrics ) {
+		// SFML is incapable of giving us the metrics we need so we have to do it ourselves.
+		auto space_glyph = lookup.GetGlyph( L' ' );
 
-	sf::Vector2f metrics( 0.f, 0.f );
+		if( !space_glyph ) {
+			return false;
+		}
 
-	const static auto tab_spaces = 2.f;
+		auto horizontal_spacing = space_glyph->advance;
+		auto vertical_spacing = lookup.GetLineSpacing();
 
-	std::uint32_t previous_character = 0;
+		metrics = sf::Vector2f( 0.f, 0.f );
 
-	auto longest_line = 0.f;
+		const static auto tab_spaces = 2.f;
 
-	for( const auto& current_character : string ) {
-		switch( current_character ) {
-			case L' ':
-				metrics.x += horizontal_spacing;
-				break;
+		std::uint32_t previous_character = 0;
 
-			case L'\t':
-				metrics.x += horizontal_spacing * tab_spaces;
-				break;
+		auto longest_line = 0.f;
 
-			case L'\n':
-				metrics.y += vertical_spacing;
-				longest_line = std::max( metrics.x, longest_line );
-				metrics.x = 0.f;
-				break;
+		for( const auto& current_character : string ) {
+			switch( current_character ) {
+				case L' ':
+					metrics.x += horizontal_spacing;
+					break;
 
-			case L'\v':
-				metrics.y += vertical_spacing * tab_spaces;
-				break;
+				case L'\t':
+					metrics.x += horizontal_spacing * tab_spaces;
+					break;
 
-			default:
-				if( previous_character != 0 ) {
-					metrics.x += static_cast<float>( font.getKerning( previous_character, current_character, font_size ) );
-				}
+				case L'\n':
+					metrics.y += vertical_spacing;
+					longest_line = std::max( metrics.x, longest_line );
+					metrics.x = 0.f;
+					break;
+
+				case L'\v':
+					metrics.y += vertical_spacing * tab_spaces;
+					break;
 
-				previous_character = current_character;
+				default: {
+					if( previous_character != 0 ) {
+						auto kerning = 0.f;
 
-				const auto& glyph = font.getGlyph( current_character, font_size, false );
-				metrics.x += static_cast<float>( glyph.advance );
-				metrics.y = std::max( metrics.y, static_cast<float>( glyph.bounds.size.y ) );
+						if( !lookup.GetKerning( previous_character, current_character, kerning ) ) {
+							return false;
+						}
+
+						metrics.x += kerning;
+					}
 
-				break;
+					previous_character = current_character;
+
+					auto glyph = lookup.GetGlyph( current_character );
+
+					if( !glyph ) {
+						return false;
+					}
+
+					metrics.x += glyph->advance;
+					metrics.y = std::max( metrics.y, glyph->height );
+
+					break;
+				}
+			}
 		}
-	}
 
-	metrics.x = std::max( longest_line, metrics.x );
+		metrics.x = std::max( longest_line, metrics.x );
 
-	return metrics;
+		return true;
+	} );
 }
 
 bool Engine::LoadThemeFromString( const std::string& data ) {
@@ -249,6 +536,256 @@ bool Engine::LoadThemeFromFile( const std::string& filename ) {
 	return LoadThemeFromString( data );
 }
 
+std::vector<char> Engine::CompileTheme() const {
+	std::vector<std::string> strings;
+	std::map<std::string, std::uint32_t> string_indices;
+
+	auto add_string = [&strings, &string_indices]( const std::string& str ) {
+		auto result = string_indices.emplace( str, static_cast<std::uint32_t>( strings.size() ) );
+
+		if( result.second ) {
+			strings.push_back( str );
+		}
+
+		return result.first->second;
+	};
+
+	std::vector<CompiledSelector> selectors;
+	std::map<const Selector*, std::uint32_t> selector_indices;
+
+	std::function<std::uint32_t( const Selector& )> add_selector = [&]( const Selector& selector ) {
+		auto iter = selector_indices.find( &selector );
+
+		if( iter != selector_indices.end() ) {
+			return iter->second;
+		}
+
+		// Parents are stored before their children.
+		auto parent = compiled_theme_no_index;
+
+		if( selector.GetParent() ) {
+			parent = add_selector( *selector.GetParent() );
+		}
+
+		CompiledSelector compiled_selector{};
+
+		compiled_selector.widget = add_string( selector.GetWidgetName() );
+		compiled_selector.id = add_string( selector.GetId() );
+		compiled_selector.class_ = add_string( selector.GetClass() );
+		compiled_selector.parent = parent;
+		compiled_selector.hash = static_cast<std::uint64_t>( selector.GetHash() );
+		compiled_selector.score = selector.GetScore();
+		compiled_selector.state = static_cast<std::int8_t>( selector.GetState() ? static_cast<int>( *selector.GetState() ) : -1 );
+		compiled_selector.hierarchy = static_cast<std::uint8_t>( selector.GetHierarchyType() );
+
+		auto index = static_cast<std::uint32_t>( selectors.size() );
+
+		selectors.push_back( compiled_selector );
+		selector_indices[&selector] = index;
+
+		return index;
+	};
+
+	std::vector<CompiledProperty> properties;
+
+	for( const auto& property : m_properties ) {
+		for( const auto& widget_name : property.second ) {
+			for( const auto& selector_value : widget_name.second ) {
+				CompiledProperty compiled_property{};
+
+				compiled_property.property = add_string( property.first );
+				compiled_property.widget = add_string( widget_name.first );
+				compiled_property.selector = add_selector( *selector_value.first );
+				compiled_property.value = add_string( GetValueString( selector_value.second ) );
+
+				properties.push_back( compiled_property );
+			}
+		}
+	}
+
+	CompiledThemeHeader header{};
+
+	std::memcpy( header.magic, compiled_theme_magic, sizeof( header.magic ) );
+	header.version = compiled_theme_version;
+	header.byte_order = compiled_theme_byte_order;
+	header.string_count = static_cast<std::uint32_t>( strings.size() );
+	header.selector_count = static_cast<std::uint32_t>( selectors.size() );
+	header.property_count = static_cast<std::uint32_t>( properties.size() );
+	header.hash_check = GetCompiledThemeHashCheck();
+
+	std::vector<char> buffer;
+	AppendCompiled( buffer, header );
+
+	std::uint32_t offset = 0;
+
+	for( const auto& str : strings ) {
+		AppendCompiled( buffer, CompiledString{ offset, static_cast<std::uint32_t>( str.size() ) } );
+		offset += static_cast<std::uint32_t>( str.size() );
+	}
+
+	for( const auto& selector : selectors ) {
+		AppendCompiled( buffer, selector );
+	}
+
+	for( const auto& property : properties ) {
+		AppendCompiled( buffer, property );
+	}
+
+	for( const auto& str : strings ) {
+		buffer.insert( buffer.end(), str.begin(), str.end() );
+	}
+
+	return buffer;
+}
+
+bool Engine::LoadCompiledTheme( const void* data, std::size_t size ) {
+	auto current = static_cast<const char*>( data );
+	auto end = current + size;
+
+	CompiledThemeHeader header;
+
+	if(
+		!ReadCompiled( current, end, header ) ||
+		std::memcmp( header.magic, compiled_theme_magic, sizeof( header.magic ) ) ||
+		( header.version != compiled_theme_version ) ||
+		( header.byte_order != compiled_theme_byte_order )
+	) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "SFGUI warning: Data is no compiled theme of this version.\n";
+#endif
+		return false;
+	}
+
+	// Selector data is bounds checked while reading, the string
+	// characters need to be located before the strings can be built.
+	auto records_size = static_cast<std::size_t>( header.string_count ) * sizeof( CompiledString ) + static_cast<std::size_t>( header.selector_count ) * sizeof( CompiledSelector ) + static_cast<std::size_t>( header.property_count ) * sizeof( CompiledProperty );
+
+	if( static_cast<std::size_t>( end - current ) < records_size ) {
+		return false;
+	}
+
+	auto characters = current + records_size;
+	auto characters_size = static_cast<std::size_t>( end - characters );
+
+	std::vector<std::string> strings;
+	strings.reserve( header.string_count );
+
+	for( std::uint32_t index = 0; index < header.string_count; ++index ) {
+		CompiledString compiled_string;
+		ReadCompiled( current, end, compiled_string );
+
+		if( ( compiled_string.offset > characters_size ) || ( compiled_string.length > characters_size - compiled_string.offset ) ) {
+			return false;
+		}
+
+		strings.emplace_back( characters + compiled_string.offset, compiled_string.length );
+	}
+
+	auto hashes_valid = ( header.hash_check == GetCompiledThemeHashCheck() );
+
+	std::vector<Selector::Ptr> selectors;
+	selectors.reserve( header.selector_count );
+
+	for( std::uint32_t index = 0; index < header.selector_count; ++index ) {
+		CompiledSelector compiled_selector;
+		ReadCompiled( current, end, compiled_selector );
+
+		if(
+			( compiled_selector.widget >= strings.size() ) ||
+			( compiled_selector.id >= strings.size() ) ||
+			( compiled_selector.class_ >= strings.size() ) ||
+			( ( compiled_selector.parent != compiled_theme_no_index ) && ( compiled_selector.parent >= index ) ) ||
+			( compiled_selector.state > static_cast<std::int8_t>( Widget::State::INSENSITIVE ) ) ||
+			( compiled_selector.hierarchy > static_cast<std::uint8_t>( Selector::HierarchyType::DESCENDANT ) )
+		) {
+			return false;
+		}
+
+		auto state = static_cast<Widget::State>( compiled_selector.state );
+		auto parent = ( compiled_selector.parent != compiled_theme_no_index ) ? selectors[compiled_selector.parent] : Selector::Ptr();
+
+		auto selector = Selector::Create(
+			strings[compiled_selector.widget],
+			strings[compiled_selector.id],
+			strings[compiled_selector.class_],
+			( compiled_selector.state < 0 ) ? nullptr : &state,
+			static_cast<Selector::HierarchyType>( compiled_selector.hierarchy ),
+			parent,
+			static_cast<std::size_t>( compiled_selector.hash ),
+			compiled_selector.score
+		);
+
+		// Themes compiled with another standard library hash differently.
+		if( !hashes_valid ) {
+			selector = Selector::Create(
+				strings[compiled_selector.widget],
+				strings[compiled_selector.id],
+				strings[compiled_selector.class_],
+				( compiled_selector.state < 0 ) ? nullptr : &state,
+				static_cast<Selector::HierarchyType>( compiled_selector.hierarchy ),
+				parent,
+				std::hash<std::string>()( selector->BuildString() ),
+				compiled_selector.score
+			);
+		}
+
+		selectors.push_back( selector );
+	}
+
+	PropertyMap properties;
+
+	for( std::uint32_t index = 0; index < header.property_count; ++index ) {
+		CompiledProperty compiled_property;
+		ReadCompiled( current, end, compiled_property );
+
+		if(
+			( compiled_property.property >= strings.size() ) ||
+			( compiled_property.widget >= strings.size() ) ||
+			( compiled_property.selector >= selectors.size() ) ||
+			( compiled_property.value >= strings.size() )
+		) {
+			return false;
+		}
+
+		properties[strings[compiled_property.property]][strings[compiled_property.widget]].emplace_back(
+			selectors[compiled_property.selector],
+			PropertyValue{ strings[compiled_property.value], std::any() }
+		);
+	}
+
+	for( const auto& property : m_properties ) {
+		RecordStyleChange( property.first );
+	}
+
+	for( const auto& property : properties ) {
+		RecordStyleChange( property.first );
+	}
+
+	m_properties.swap( properties );
+
+	// Properties set earlier in a running theme update are replaced as well.
+	m_pending_properties.clear();
+
+	RefreshWidgets();
+
+	return true;
+}
+
+bool Engine::LoadCompiledThemeFromFile( const std::string& filename ) {
+	std::ifstream in( filename.c_str(), std::ios::binary );
+
+	if( !in.good() ) {
+		return false;
+	}
+
+	std::vector<char> data(
+		(std::istreambuf_iterator<char>( in )),
+		(std::istreambuf_iterator<char>())
+	);
+
+	return LoadCompiledTheme( data.data(), data.size() );
+}
+
 void Engine::ShiftBorderColors( sf::Color& light_color, sf::Color& dark_color, int offset ) const {
 	// TODO: Replace by += and -=. Currently not possible with SFML (see SFML issue #114).
 	light_color.r = static_cast<std::uint8_t>( std::max( 0, std::min( 255, static_cast<int>( light_color.r ) + offset ) ) );
@@ -260,40 +797,29 @@ void Engine::ShiftBorderColors( sf::Color& light_color, sf::Color& dark_color, i
 	dark_color.b = static_cast<std::uint8_t>( std::min( 255, std::max( 0, static_cast<int>( dark_color.b ) - offset ) ) );
 }
 
-const std::string* Engine::GetValue( const std::string& property, Widget::PtrConst widget ) const {
+const Engine::PropertyValue* Engine::GetValue( const std::string& property, Widget::PtrConst widget ) const {
 	// Look for property.
 	PropertyMap::const_iterator prop_iter( m_properties.find( property ) );
 
-	const std::string* value = 0;
+	if( prop_iter == m_properties.end() ) {
+		return nullptr;
+	}
+
+	return FindValue( prop_iter->second, widget );
+}
+
+const Engine::PropertyValue* Engine::FindValue( const WidgetNameMap& widget_names, Widget::PtrConst widget ) {
+	const PropertyValue* value = 0;
 	int score = -1;
 
-	if( prop_iter != m_properties.end() ) {
-		WidgetNameMap::const_iterator name_iter;
-
-		if( widget ) {
-			// Find widget-specific properties, first.
-			name_iter = prop_iter->second.find( widget->GetName() );
-
-			if( name_iter != prop_iter->second.end() ) {
-				// Check against selectors.
-				for( const auto& selector_value : name_iter->second ) {
-					if( selector_value.first->Matches( widget ) ) {
-						// Found, check if it is better than current best.
-						auto new_score = selector_value.first->GetScore();
-
-						if( new_score > score ) {
-							value = &selector_value.second;
-							score = new_score;
-						}
-					}
-				}
-			}
-		}
+	WidgetNameMap::const_iterator name_iter;
 
-		// Look for general properties now.
-		name_iter = prop_iter->second.find( "*" );
+	if( widget ) {
+		// Find widget-specific properties, first.
+		name_iter = widget_names.find( widget->GetName() );
 
-		if( name_iter != prop_iter->second.end() ) {
+		if( name_iter != widget_names.end() ) {
+			// Check against selectors.
 			for( const auto& selector_value : name_iter->second ) {
 				if( selector_value.first->Matches( widget ) ) {
 					// Found, check if it is better than current best.
@@ -308,13 +834,147 @@ const std::string* Engine::GetValue( const std::string& property, Widget::PtrCon
 		}
 	}
 
+	// Look for general properties now.
+	name_iter = widget_names.find( "*" );
+
+	if( name_iter != widget_names.end() ) {
+		for( const auto& selector_value : name_iter->second ) {
+			if( selector_value.first->Matches( widget ) ) {
+				// Found, check if it is better than current best.
+				auto new_score = selector_value.first->GetScore();
+
+				if( new_score > score ) {
+					value = &selector_value.second;
+					score = new_score;
+				}
+			}
+		}
+	}
+
 	return value;
 }
 
+Engine::StyleChange Engine::GetStyleChange( Widget::PtrConst widget ) const {
+	static const WidgetNameMap no_values;
+
+	// Properties that are never used to compute requisitions or allocations.
+	static const std::unordered_set<std::string> appearance_properties = {
+		"ArrowColor",
+		"BackgroundColor",
+		"BackgroundColorDark",
+		"BackgroundColorPrelight",
+		"BarBorderColor",
+		"BarBorderColorShift",
+		"BarColor",
+		"BorderColor",
+		"BorderColorShift",
+		"CheckColor",
+		"CloseThickness",
+		"Color",
+		"CycleDuration",
+		"HighlightedColor",
+		"InnerRadius",
+		"RodThickness",
+		"ScrollButtonPrelightColor",
+		"ScrollSpeed",
+		"ShadowAlpha",
+		"ShadowDistance",
+		"SliderColor",
+		"StepperArrowColor",
+		"StepperBackgroundColor",
+		"StepperRepeatDelay",
+		"StepperSpeed",
+		"StoppedAlpha",
+		"TitleBackgroundColor",
+		"TroughColor"
+	};
+
+	auto style_change = StyleChange::NONE;
+
+	for( const auto& previous_property : m_previous_properties ) {
+		auto prop_iter = m_properties.find( previous_property.first );
+
+		auto previous_value = FindValue( previous_property.second, widget );
+		auto value = FindValue( ( prop_iter != m_properties.end() ) ? prop_iter->second : no_values, widget );
+
+		if( ( previous_value == value ) || ( previous_value && value && ( GetValueString( *previous_value ) == GetValueString( *value ) ) ) ) {
+			continue;
+		}
+
+		if( appearance_properties.find( previous_property.first ) == appearance_properties.end() ) {
+			return StyleChange::SIZE;
+		}
+
+		style_change = StyleChange::APPEARANCE;
+	}
+
+	return style_change;
+}
+
+void Engine::ClearStyleChanges() {
+	m_previous_properties.clear();
+}
+
+void Engine::RecordStyleChange( const std::string& property ) {
+	// Only the values before the first change since the last refresh are of interest.
+	if( m_previous_properties.find( property ) != m_previous_properties.end() ) {
+		return;
+	}
+
+	auto prop_iter = m_properties.find( property );
+
+	if( prop_iter != m_properties.end() ) {
+		m_previous_properties.emplace( property, prop_iter->second );
+	}
+	else {
+		m_previous_properties.emplace( property, WidgetNameMap() );
+	}
+}
+
+const std::string& Engine::GetValueString( const PropertyValue& value ) {
+	// Values set as strings are stored as they are.
+	if( !value.format ) {
+		return value.string;
+	}
+
+	std::lock_guard<std::mutex> lock( property_string_mutex );
+
+	// The string doesn't change anymore once it is formatted.
+	if( !value.formatted ) {
+		value.string = value.format( value.typed );
+		value.formatted = true;
+	}
+
+	return value.string;
+}
+
 ResourceManager& Engine::GetResourceManager() const {
 	return m_resource_manager;
 }
 
+/// @cond
+
+std::recursive_mutex& Engine::GetFontMutex() {
+	static std::recursive_mutex font_mutex;
+	return font_mutex;
+}
+
+void Engine::ForgetFontMetrics( const sf::Font& font ) {
+	std::lock_guard<std::shared_mutex> lock( font_metrics_mutex );
+
+	// Entries are ordered by font first.
+	auto begin = font_metrics_cache.lower_bound( std::make_tuple( &font, 0u, false ) );
+	auto end = begin;
+
+	while( ( end != font_metrics_cache.end() ) && ( std::get<0>( end->first ) == &font ) ) {
+		++end;
+	}
+
+	font_metrics_cache.erase( begin, end );
+}
+
+/// @endcond
+
 void Engine::AddCharacterSet( std::uint32_t low_bound, std::uint32_t high_bound ) {
 	if( high_bound <= low_bound ) {
 		return;
@@ -324,11 +984,63 @@ void Engine::AddCharacterSet( std::uint32_t low_bound, std::uint32_t high_bound
 }
 
 bool Engine::SetProperty( sfg::Selector::Ptr selector, const std::string& property, const std::string& value ) {
+	return SetPropertyValue( selector, property, PropertyValue{ value, std::any() } );
+}
+
+const std::vector<Selector::Ptr>* Engine::GetSelectors( const std::string& selector ) {
+	auto iter = m_selector_cache.find( selector );
+
+	if( iter != m_selector_cache.end() ) {
+		return &iter->second;
+	}
+
+	parser::theme::Selector parsed_selector;
+
+	if( !parser::theme::ParseSelector( selector, parsed_selector ) ) {
+		return nullptr;
+	}
+
+	return &( m_selector_cache[selector] = CreateSelectors( parsed_selector ) );
+}
+
+bool Engine::SetPropertyValue( const std::string& selector, const std::string& property, PropertyValue value ) {
+	auto selectors = GetSelectors( selector );
+
+	if( !selectors ) {
+		// Invalid selector string given.
+		return false;
+	}
+
+	for( const auto& current_selector : *selectors ) {
+		InsertPropertyValue( current_selector, property, value );
+	}
+
+	RefreshWidgets();
+
+	return true;
+}
+
+bool Engine::SetPropertyValue( sfg::Selector::Ptr selector, const std::string& property, PropertyValue value ) {
 	if( !selector ) {
 		// Invalid selector string given.
 		return false;
 	}
 
+	InsertPropertyValue( selector, property, std::move( value ) );
+
+	RefreshWidgets();
+
+	return true;
+}
+
+void Engine::InsertPropertyValue( sfg::Selector::Ptr selector, const std::string& property, PropertyValue value ) {
+	if( m_theme_update_depth ) {
+		m_pending_properties.emplace_back( property, SelectorValuePair( selector, std::move( value ) ) );
+		return;
+	}
+
+	RecordStyleChange( property );
+
 	// If the selector does already exist, we'll remove it to make sure the newly
 	// added value will get a higher priority than the previous one, because
 	// that's the expected behaviour (LIFO).
@@ -345,13 +1057,7 @@ bool Engine::SetProperty( sfg::Selector::Ptr selector, const std::string& proper
 	}
 
 	// Insert at top to get highest priority.
-	list.insert( list.begin(), SelectorValuePair( selector, value ) );
-
-	if( m_auto_refresh ) {
-		Widget::RefreshAll();
-	}
-
-	return true;
+	list.insert( list.begin(), SelectorValuePair( selector, std::move( value ) ) );
 }
 
 bool Engine::SetProperties( const std::string& properties ) {
@@ -363,70 +1069,142 @@ bool Engine::SetProperties( const std::string& properties ) {
 
 	ParseTheme( theme );
 
-	if( m_auto_refresh ) {
-		Widget::RefreshAll();
-	}
-
 	return true;
 }
 
 void Engine::ClearProperties() {
+	for( const auto& property : m_properties ) {
+		RecordStyleChange( property.first );
+	}
+
 	m_properties.clear();
+	m_pending_properties.clear();
 }
 
 void Engine::SetAutoRefresh( bool enable ) {
 	m_auto_refresh = enable;
 }
 
-void Engine::ParseTheme( const parser::theme::Theme& theme_to_parse ) {
-	// Iterate over all rules
-	for( const auto& rule : theme_to_parse ) {
-		Selector::Ptr selector;
+void Engine::BeginThemeUpdate() {
+	++m_theme_update_depth;
+}
 
-		// Iterate over all simple selectors
-		for( const auto& simple_selector : rule.m_selector.m_simple_selectors ) {
-			auto hierarchy = Selector::HierarchyType::ROOT;
+void Engine::EndThemeUpdate() {
+	if( !m_theme_update_depth ) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "SFGUI warning: EndThemeUpdate() called without matching BeginThemeUpdate().\n";
+#endif
+		return;
+	}
 
-			if( simple_selector.m_combinator == ">" ) {
-				hierarchy = Selector::HierarchyType::CHILD;
-			}
-			else if( simple_selector.m_combinator == " " ) {
-				hierarchy = Selector::HierarchyType::DESCENDANT;
-			}
-			else if( simple_selector.m_combinator == "," ) {
-				// Grouping combinator detected. Stop eating simple selectors and set the properties now.
-				// Iterate over all declarations
-				for( const auto& declaration : rule.m_declarations ) {
-					auto property_name = declaration.m_property_name;
-					auto property_value = declaration.m_property_value;
-
-					// Finally set the property
-					SetProperty( selector, property_name, property_value );
-				}
+	if( --m_theme_update_depth ) {
+		return;
+	}
 
-				// Reset the current simple selector to be the root of a new chain.
-				selector = Selector::Ptr();
-			}
+	CommitPendingProperties();
 
-			selector = Selector::Create(
-				simple_selector.m_type_selector,
-				simple_selector.m_id_selector,
-				simple_selector.m_class_selector,
-				simple_selector.m_state_selector,
-				hierarchy,
-				selector
-			);
+	if( m_refresh_pending ) {
+		m_refresh_pending = false;
+
+		RefreshWidgets();
+	}
+}
+
+void Engine::CommitPendingProperties() {
+	if( m_pending_properties.empty() ) {
+		return;
+	}
+
+	// Every affected list is rebuilt once: The new values come first, newest
+	// first, followed by the previous values that weren't replaced. This
+	// results in the same order as inserting the values one by one. Selectors
+	// are equal if their hashes are, selectors without hash never are.
+	struct RebuiltList {
+		SelectorValueList values;
+		std::unordered_set<std::size_t> hashes;
+	};
+
+	std::unordered_map<SelectorValueList*, RebuiltList> rebuilt_lists;
+
+	for( auto iter = m_pending_properties.rbegin(); iter != m_pending_properties.rend(); ++iter ) {
+		RecordStyleChange( iter->first );
+
+		auto& list = m_properties[iter->first][iter->second.first->GetWidgetName()];
+		auto& rebuilt_list = rebuilt_lists[&list];
+		auto hash = iter->second.first->GetHash();
+
+		if( hash && !rebuilt_list.hashes.insert( hash ).second ) {
+			// Replaced by a newer value.
+			continue;
 		}
 
-		// Iterate over all declarations
-		for( const auto& declaration : rule.m_declarations ) {
-			auto property_name = declaration.m_property_name;
-			auto property_value = declaration.m_property_value;
+		rebuilt_list.values.push_back( std::move( iter->second ) );
+	}
+
+	m_pending_properties.clear();
+
+	for( auto& rebuilt_list : rebuilt_lists ) {
+		for( auto& selector_value : *rebuilt_list.first ) {
+			auto hash = selector_value.first->GetHash();
 
-			// Finally set the property
-			SetProperty( selector, property_name, property_value );
+			if( !hash || !rebuilt_list.second.hashes.count( hash ) ) {
+				rebuilt_list.second.values.push_back( std::move( selector_value ) );
+			}
 		}
+
+		rebuilt_list.first->swap( rebuilt_list.second.values );
 	}
 }
 
+void Engine::RefreshWidgets() {
+	if( !m_auto_refresh ) {
+		return;
+	}
+
+	if( m_theme_update_depth ) {
+		m_refresh_pending = true;
+		return;
+	}
+
+	// Widgets get their properties from the active engine, the changes
+	// of other engines don't tell which of them changed their style.
+	if( &Context::Get().GetEngine() == this ) {
+		Widget::RefreshStyleAll();
+	}
+	else {
+		Widget::RefreshAll();
+	}
+
+	ClearStyleChanges();
+}
+
+Engine::ThemeUpdate::ThemeUpdate( Engine& engine ) :
+	m_engine( engine )
+{
+	m_engine.BeginThemeUpdate();
+}
+
+Engine::ThemeUpdate::~ThemeUpdate() {
+	m_engine.EndThemeUpdate();
+}
+
+void Engine::ParseTheme( const parser::theme::Theme& theme_to_parse ) {
+	// Apply all declarations at once and refresh a single time.
+	ThemeUpdate theme_update( *this );
+
+	// Iterate over all rules
+	for( const auto& rule : theme_to_parse ) {
+		// Iterate over all selectors of the group
+		for( const auto& selector : CreateSelectors( rule.m_selector ) ) {
+			// Iterate over all declarations
+			for( const auto& declaration : rule.m_declarations ) {
+				// Finally set the property
+				InsertPropertyValue( selector, declaration.m_property_name, PropertyValue{ declaration.m_property_value, std::any() } );
+			}
+		}
+	}
+
+	RefreshWidgets();
+}
+
 }
@@ -0,0 +1,76 @@
+#include <SFGUI/Engines/BREW.hpp>
+#include <SFGUI/Renderer.hpp>
+#include <SFGUI/TreeViewRow.hpp>
+#include <SFGUI/RenderQueue.hpp>
+
+#include <SFML/Graphics/Text.hpp>
+
+namespace sfg {
+namespace eng {
+
+std::unique_ptr<RenderQueue> BREW::CreateTreeViewRowDrawable( std::shared_ptr<const TreeViewRow> row ) const {
+	auto background_color = GetProperty<sf::Color>( "BackgroundColor", row );
+	auto color = GetProperty<sf::Color>( "Color", row );
+	auto arrow_color = GetProperty<sf::Color>( "ArrowColor", row );
+	auto padding = GetProperty<float>( "ItemPadding", row );
+	auto indent = GetProperty<float>( "Indent", row );
+	const auto& font_name = GetProperty<std::string>( "FontName", row );
+	auto font_size = GetProperty<unsigned int>( "FontSize", row );
+	const auto& font = GetResourceManager().GetFont( font_name );
+	auto line_height = GetFontLineHeight( *font, font_size );
+
+	std::unique_ptr<RenderQueue> queue( new RenderQueue );
+
+	// Background.
+	if( background_color.a ) {
+		queue->Add(
+			Renderer::Get().CreateRect(
+				sf::FloatRect(
+					{ 0.f, 0.f },
+					{ row->GetAllocation().size.x, row->GetAllocation().size.y }
+				),
+				background_color
+			)
+		);
+	}
+
+	sf::Vector2f position(
+		padding + static_cast<float>( row->GetDepth() ) * indent,
+		row->GetAllocation().size.y / 2.f - line_height / 2.f
+	);
+
+	// Expander arrow, pointing down when expanded and right when collapsed.
+	if( row->IsExpandable() ) {
+		if( row->IsExpanded() ) {
+			queue->Add(
+				Renderer::Get().CreateTriangle(
+					position + sf::Vector2f( line_height / 2.f, line_height * 3.f / 4.f ),
+					position + sf::Vector2f( line_height * 3.f / 4.f, line_height / 4.f ),
+					position + sf::Vector2f( line_height / 4.f, line_height / 4.f ),
+					arrow_color
+				)
+			);
+		}
+		else {
+			queue->Add(
+				Renderer::Get().CreateTriangle(
+					position + sf::Vector2f( line_height * 3.f / 4.f, line_height / 2.f ),
+					position + sf::Vector2f( line_height / 4.f, line_height / 4.f ),
+					position + sf::Vector2f( line_height / 4.f, line_height * 3.f / 4.f ),
+					arrow_color
+				)
+			);
+		}
+	}
+
+	// Text.
+	sf::Text text( *font, row->GetText(), font_size );
+	text.setPosition( { position.x + line_height + padding, position.y } );
+	text.setFillColor( color );
+	queue->Add( Renderer::Get().CreateText( text ) );
+
+	return queue;
+}
+
+}
+}
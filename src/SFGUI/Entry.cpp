@@ -34,6 +34,10 @@ std::unique_ptr<RenderQueue> Entry::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateEntryDrawable( std::dynamic_pointer_cast<const Entry>( shared_from_this() ) );
 }
 
+bool Entry::CanInvalidateConcurrently() const {
+	return true;
+}
+
 void Entry::SetText( const sf::String& text ) {
 	m_string = text;
 	m_visible_offset = 0;
@@ -318,6 +322,10 @@ sf::Vector2f Entry::CalculateRequisition() {
 	return sf::Vector2f( 2 * (border_width + text_padding), line_height + 2 * ( border_width + text_padding ) );
 }
 
+bool Entry::CanMeasureConcurrently() const {
+	return true;
+}
+
 bool Entry::IsCursorVisible() const {
 	return m_cursor_status;
 }
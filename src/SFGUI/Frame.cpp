@@ -16,6 +16,10 @@ std::unique_ptr<RenderQueue> Frame::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateFrameDrawable( std::dynamic_pointer_cast<const Frame>( shared_from_this() ) );
 }
 
+bool Frame::CanInvalidateConcurrently() const {
+	return true;
+}
+
 void Frame::SetLabel( const sf::String& label ) {
 	m_label = label;
 	RequestResize();
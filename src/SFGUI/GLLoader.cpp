@@ -68,6 +68,15 @@ int sfgogl_ext_ARB_vertex_array_object = sfgogl_LOAD_FAILED;
 int sfgogl_ext_ARB_geometry_shader4 = sfgogl_LOAD_FAILED;
 int sfgogl_ext_ARB_explicit_attrib_location = sfgogl_LOAD_FAILED;
 int sfgogl_ext_ARB_explicit_uniform_location = sfgogl_LOAD_FAILED;
+int sfgogl_ext_ARB_map_buffer_range = sfgogl_LOAD_FAILED;
+int sfgogl_ext_ARB_sync = sfgogl_LOAD_FAILED;
+int sfgogl_ext_ARB_buffer_storage = sfgogl_LOAD_FAILED;
+int sfgogl_ext_ARB_draw_elements_base_vertex = sfgogl_LOAD_FAILED;
+int sfgogl_ext_ARB_instanced_arrays = sfgogl_LOAD_FAILED;
+int sfgogl_ext_ARB_draw_instanced = sfgogl_LOAD_FAILED;
+int sfgogl_ext_EXT_texture_array = sfgogl_LOAD_FAILED;
+int sfgogl_ext_ARB_occlusion_query = sfgogl_LOAD_FAILED;
+int sfgogl_ext_ARB_pixel_buffer_object = sfgogl_LOAD_FAILED;
 
 void (CODEGEN_FUNCPTR *sfg_ptrc_glActiveTextureARB)(GLenum) = NULL;
 void (CODEGEN_FUNCPTR *sfg_ptrc_glClientActiveTextureARB)(GLenum) = NULL;
@@ -722,6 +731,140 @@ static int Load_ARB_geometry_shader4(void)
 	return numFailed;
 }
 
+void (CODEGEN_FUNCPTR *sfg_ptrc_glFlushMappedBufferRange)(GLenum, GLintptr, GLsizeiptr) = NULL;
+void * (CODEGEN_FUNCPTR *sfg_ptrc_glMapBufferRange)(GLenum, GLintptr, GLsizeiptr, GLbitfield) = NULL;
+
+static int Load_ARB_map_buffer_range(void)
+{
+	int numFailed = 0;
+	sfg_ptrc_glFlushMappedBufferRange = (void (CODEGEN_FUNCPTR *)(GLenum, GLintptr, GLsizeiptr))IntGetProcAddress("glFlushMappedBufferRange");
+	if(!sfg_ptrc_glFlushMappedBufferRange) numFailed++;
+	sfg_ptrc_glMapBufferRange = (void * (CODEGEN_FUNCPTR *)(GLenum, GLintptr, GLsizeiptr, GLbitfield))IntGetProcAddress("glMapBufferRange");
+	if(!sfg_ptrc_glMapBufferRange) numFailed++;
+	return numFailed;
+}
+
+GLenum (CODEGEN_FUNCPTR *sfg_ptrc_glClientWaitSync)(GLsync, GLbitfield, GLuint64) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glDeleteSync)(GLsync) = NULL;
+GLsync (CODEGEN_FUNCPTR *sfg_ptrc_glFenceSync)(GLenum, GLbitfield) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glGetInteger64v)(GLenum, GLint64 *) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glGetSynciv)(GLsync, GLenum, GLsizei, GLsizei *, GLint *) = NULL;
+GLboolean (CODEGEN_FUNCPTR *sfg_ptrc_glIsSync)(GLsync) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glWaitSync)(GLsync, GLbitfield, GLuint64) = NULL;
+
+static int Load_ARB_sync(void)
+{
+	int numFailed = 0;
+	sfg_ptrc_glClientWaitSync = (GLenum (CODEGEN_FUNCPTR *)(GLsync, GLbitfield, GLuint64))IntGetProcAddress("glClientWaitSync");
+	if(!sfg_ptrc_glClientWaitSync) numFailed++;
+	sfg_ptrc_glDeleteSync = (void (CODEGEN_FUNCPTR *)(GLsync))IntGetProcAddress("glDeleteSync");
+	if(!sfg_ptrc_glDeleteSync) numFailed++;
+	sfg_ptrc_glFenceSync = (GLsync (CODEGEN_FUNCPTR *)(GLenum, GLbitfield))IntGetProcAddress("glFenceSync");
+	if(!sfg_ptrc_glFenceSync) numFailed++;
+	sfg_ptrc_glGetInteger64v = (void (CODEGEN_FUNCPTR *)(GLenum, GLint64 *))IntGetProcAddress("glGetInteger64v");
+	if(!sfg_ptrc_glGetInteger64v) numFailed++;
+	sfg_ptrc_glGetSynciv = (void (CODEGEN_FUNCPTR *)(GLsync, GLenum, GLsizei, GLsizei *, GLint *))IntGetProcAddress("glGetSynciv");
+	if(!sfg_ptrc_glGetSynciv) numFailed++;
+	sfg_ptrc_glIsSync = (GLboolean (CODEGEN_FUNCPTR *)(GLsync))IntGetProcAddress("glIsSync");
+	if(!sfg_ptrc_glIsSync) numFailed++;
+	sfg_ptrc_glWaitSync = (void (CODEGEN_FUNCPTR *)(GLsync, GLbitfield, GLuint64))IntGetProcAddress("glWaitSync");
+	if(!sfg_ptrc_glWaitSync) numFailed++;
+	return numFailed;
+}
+
+void (CODEGEN_FUNCPTR *sfg_ptrc_glBufferStorage)(GLenum, GLsizeiptr, const void *, GLbitfield) = NULL;
+
+static int Load_ARB_buffer_storage(void)
+{
+	int numFailed = 0;
+	sfg_ptrc_glBufferStorage = (void (CODEGEN_FUNCPTR *)(GLenum, GLsizeiptr, const void *, GLbitfield))IntGetProcAddress("glBufferStorage");
+	if(!sfg_ptrc_glBufferStorage) numFailed++;
+	return numFailed;
+}
+
+void (CODEGEN_FUNCPTR *sfg_ptrc_glDrawElementsBaseVertex)(GLenum, GLsizei, GLenum, const GLvoid *, GLint) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glDrawElementsInstancedBaseVertex)(GLenum, GLsizei, GLenum, const GLvoid *, GLsizei, GLint) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glDrawRangeElementsBaseVertex)(GLenum, GLuint, GLuint, GLsizei, GLenum, const GLvoid *, GLint) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glMultiDrawElementsBaseVertex)(GLenum, const GLsizei *, GLenum, const GLvoid *const*, GLsizei, const GLint *) = NULL;
+
+static int Load_ARB_draw_elements_base_vertex(void)
+{
+	int numFailed = 0;
+	sfg_ptrc_glDrawElementsBaseVertex = (void (CODEGEN_FUNCPTR *)(GLenum, GLsizei, GLenum, const GLvoid *, GLint))IntGetProcAddress("glDrawElementsBaseVertex");
+	if(!sfg_ptrc_glDrawElementsBaseVertex) numFailed++;
+	sfg_ptrc_glDrawElementsInstancedBaseVertex = (void (CODEGEN_FUNCPTR *)(GLenum, GLsizei, GLenum, const GLvoid *, GLsizei, GLint))IntGetProcAddress("glDrawElementsInstancedBaseVertex");
+	if(!sfg_ptrc_glDrawElementsInstancedBaseVertex) numFailed++;
+	sfg_ptrc_glDrawRangeElementsBaseVertex = (void (CODEGEN_FUNCPTR *)(GLenum, GLuint, GLuint, GLsizei, GLenum, const GLvoid *, GLint))IntGetProcAddress("glDrawRangeElementsBaseVertex");
+	if(!sfg_ptrc_glDrawRangeElementsBaseVertex) numFailed++;
+	sfg_ptrc_glMultiDrawElementsBaseVertex = (void (CODEGEN_FUNCPTR *)(GLenum, const GLsizei *, GLenum, const GLvoid *const*, GLsizei, const GLint *))IntGetProcAddress("glMultiDrawElementsBaseVertex");
+	if(!sfg_ptrc_glMultiDrawElementsBaseVertex) numFailed++;
+	return numFailed;
+}
+
+void (CODEGEN_FUNCPTR *sfg_ptrc_glVertexAttribDivisorARB)(GLuint, GLuint) = NULL;
+
+static int Load_ARB_instanced_arrays(void)
+{
+	int numFailed = 0;
+	sfg_ptrc_glVertexAttribDivisorARB = (void (CODEGEN_FUNCPTR *)(GLuint, GLuint))IntGetProcAddress("glVertexAttribDivisorARB");
+	if(!sfg_ptrc_glVertexAttribDivisorARB) numFailed++;
+	return numFailed;
+}
+
+void (CODEGEN_FUNCPTR *sfg_ptrc_glDrawArraysInstancedARB)(GLenum, GLint, GLsizei, GLsizei) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glDrawElementsInstancedARB)(GLenum, GLsizei, GLenum, const GLvoid *, GLsizei) = NULL;
+
+static int Load_ARB_draw_instanced(void)
+{
+	int numFailed = 0;
+	sfg_ptrc_glDrawArraysInstancedARB = (void (CODEGEN_FUNCPTR *)(GLenum, GLint, GLsizei, GLsizei))IntGetProcAddress("glDrawArraysInstancedARB");
+	if(!sfg_ptrc_glDrawArraysInstancedARB) numFailed++;
+	sfg_ptrc_glDrawElementsInstancedARB = (void (CODEGEN_FUNCPTR *)(GLenum, GLsizei, GLenum, const GLvoid *, GLsizei))IntGetProcAddress("glDrawElementsInstancedARB");
+	if(!sfg_ptrc_glDrawElementsInstancedARB) numFailed++;
+	return numFailed;
+}
+
+void (CODEGEN_FUNCPTR *sfg_ptrc_glFramebufferTextureLayerEXT)(GLenum, GLenum, GLuint, GLint, GLint) = NULL;
+
+static int Load_EXT_texture_array(void)
+{
+	int numFailed = 0;
+	sfg_ptrc_glFramebufferTextureLayerEXT = (void (CODEGEN_FUNCPTR *)(GLenum, GLenum, GLuint, GLint, GLint))IntGetProcAddress("glFramebufferTextureLayerEXT");
+	if(!sfg_ptrc_glFramebufferTextureLayerEXT) numFailed++;
+	return numFailed;
+}
+
+void (CODEGEN_FUNCPTR *sfg_ptrc_glBeginQueryARB)(GLenum, GLuint) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glDeleteQueriesARB)(GLsizei, const GLuint *) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glEndQueryARB)(GLenum) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glGenQueriesARB)(GLsizei, GLuint *) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glGetQueryObjectivARB)(GLuint, GLenum, GLint *) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glGetQueryObjectuivARB)(GLuint, GLenum, GLuint *) = NULL;
+void (CODEGEN_FUNCPTR *sfg_ptrc_glGetQueryivARB)(GLenum, GLenum, GLint *) = NULL;
+GLboolean (CODEGEN_FUNCPTR *sfg_ptrc_glIsQueryARB)(GLuint) = NULL;
+
+static int Load_ARB_occlusion_query(void)
+{
+	int numFailed = 0;
+	sfg_ptrc_glBeginQueryARB = (void (CODEGEN_FUNCPTR *)(GLenum, GLuint))IntGetProcAddress("glBeginQueryARB");
+	if(!sfg_ptrc_glBeginQueryARB) numFailed++;
+	sfg_ptrc_glDeleteQueriesARB = (void (CODEGEN_FUNCPTR *)(GLsizei, const GLuint *))IntGetProcAddress("glDeleteQueriesARB");
+	if(!sfg_ptrc_glDeleteQueriesARB) numFailed++;
+	sfg_ptrc_glEndQueryARB = (void (CODEGEN_FUNCPTR *)(GLenum))IntGetProcAddress("glEndQueryARB");
+	if(!sfg_ptrc_glEndQueryARB) numFailed++;
+	sfg_ptrc_glGenQueriesARB = (void (CODEGEN_FUNCPTR *)(GLsizei, GLuint *))IntGetProcAddress("glGenQueriesARB");
+	if(!sfg_ptrc_glGenQueriesARB) numFailed++;
+	sfg_ptrc_glGetQueryObjectivARB = (void (CODEGEN_FUNCPTR *)(GLuint, GLenum, GLint *))IntGetProcAddress("glGetQueryObjectivARB");
+	if(!sfg_ptrc_glGetQueryObjectivARB) numFailed++;
+	sfg_ptrc_glGetQueryObjectuivARB = (void (CODEGEN_FUNCPTR *)(GLuint, GLenum, GLuint *))IntGetProcAddress("glGetQueryObjectuivARB");
+	if(!sfg_ptrc_glGetQueryObjectuivARB) numFailed++;
+	sfg_ptrc_glGetQueryivARB = (void (CODEGEN_FUNCPTR *)(GLenum, GLenum, GLint *))IntGetProcAddress("glGetQueryivARB");
+	if(!sfg_ptrc_glGetQueryivARB) numFailed++;
+	sfg_ptrc_glIsQueryARB = (GLboolean (CODEGEN_FUNCPTR *)(GLuint))IntGetProcAddress("glIsQueryARB");
+	if(!sfg_ptrc_glIsQueryARB) numFailed++;
+	return numFailed;
+}
+
 void (CODEGEN_FUNCPTR *sfg_ptrc_glAccum)(GLenum, GLfloat) = NULL;
 void (CODEGEN_FUNCPTR *sfg_ptrc_glAlphaFunc)(GLenum, GLfloat) = NULL;
 void (CODEGEN_FUNCPTR *sfg_ptrc_glBegin)(GLenum) = NULL;
@@ -1765,7 +1908,7 @@ typedef struct sfgogl_StrToExtMap_s
 	PFN_LOADFUNCPOINTERS LoadExtension;
 } sfgogl_StrToExtMap;
 
-static sfgogl_StrToExtMap ExtensionMap[19] = {
+static sfgogl_StrToExtMap ExtensionMap[28] = {
 	{"GL_SGIS_texture_edge_clamp", &sfgogl_ext_SGIS_texture_edge_clamp, NULL},
 	{"GL_ARB_multitexture", &sfgogl_ext_ARB_multitexture, Load_ARB_multitexture},
 	{"GL_EXT_blend_minmax", &sfgogl_ext_EXT_blend_minmax, Load_EXT_blend_minmax},
@@ -1784,10 +1927,19 @@ static sfgogl_StrToExtMap ExtensionMap[19] = {
 	{"GL_ARB_vertex_array_object", &sfgogl_ext_ARB_vertex_array_object, Load_ARB_vertex_array_object},
 	{"GL_ARB_geometry_shader4", &sfgogl_ext_ARB_geometry_shader4, Load_ARB_geometry_shader4},
 	{"GL_ARB_explicit_attrib_location", &sfgogl_ext_ARB_explicit_attrib_location, NULL},
-	{"GL_ARB_explicit_uniform_location", &sfgogl_ext_ARB_explicit_uniform_location, NULL}
+	{"GL_ARB_explicit_uniform_location", &sfgogl_ext_ARB_explicit_uniform_location, NULL},
+	{"GL_ARB_map_buffer_range", &sfgogl_ext_ARB_map_buffer_range, Load_ARB_map_buffer_range},
+	{"GL_ARB_sync", &sfgogl_ext_ARB_sync, Load_ARB_sync},
+	{"GL_ARB_buffer_storage", &sfgogl_ext_ARB_buffer_storage, Load_ARB_buffer_storage},
+	{"GL_ARB_draw_elements_base_vertex", &sfgogl_ext_ARB_draw_elements_base_vertex, Load_ARB_draw_elements_base_vertex},
+	{"GL_ARB_instanced_arrays", &sfgogl_ext_ARB_instanced_arrays, Load_ARB_instanced_arrays},
+	{"GL_ARB_draw_instanced", &sfgogl_ext_ARB_draw_instanced, Load_ARB_draw_instanced},
+	{"GL_EXT_texture_array", &sfgogl_ext_EXT_texture_array, Load_EXT_texture_array},
+	{"GL_ARB_occlusion_query", &sfgogl_ext_ARB_occlusion_query, Load_ARB_occlusion_query},
+	{"GL_ARB_pixel_buffer_object", &sfgogl_ext_ARB_pixel_buffer_object, NULL}
 };
 
-static int g_extensionMapSize = 19;
+static int g_extensionMapSize = 28;
 
 static sfgogl_StrToExtMap *FindExtEntry(const char *extensionName)
 {
@@ -1823,6 +1975,15 @@ static void ClearExtensionVars(void)
 	sfgogl_ext_ARB_geometry_shader4 = sfgogl_LOAD_FAILED;
 	sfgogl_ext_ARB_explicit_attrib_location = sfgogl_LOAD_FAILED;
 	sfgogl_ext_ARB_explicit_uniform_location = sfgogl_LOAD_FAILED;
+	sfgogl_ext_ARB_map_buffer_range = sfgogl_LOAD_FAILED;
+	sfgogl_ext_ARB_sync = sfgogl_LOAD_FAILED;
+	sfgogl_ext_ARB_buffer_storage = sfgogl_LOAD_FAILED;
+	sfgogl_ext_ARB_draw_elements_base_vertex = sfgogl_LOAD_FAILED;
+	sfgogl_ext_ARB_instanced_arrays = sfgogl_LOAD_FAILED;
+	sfgogl_ext_ARB_draw_instanced = sfgogl_LOAD_FAILED;
+	sfgogl_ext_EXT_texture_array = sfgogl_LOAD_FAILED;
+	sfgogl_ext_ARB_occlusion_query = sfgogl_LOAD_FAILED;
+	sfgogl_ext_ARB_pixel_buffer_object = sfgogl_LOAD_FAILED;
 }
 
 
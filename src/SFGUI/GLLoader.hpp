@@ -173,6 +173,15 @@ extern int sfgogl_ext_ARB_vertex_array_object;
 extern int sfgogl_ext_ARB_geometry_shader4;
 extern int sfgogl_ext_ARB_explicit_attrib_location;
 extern int sfgogl_ext_ARB_explicit_uniform_location;
+extern int sfgogl_ext_ARB_map_buffer_range;
+extern int sfgogl_ext_ARB_sync;
+extern int sfgogl_ext_ARB_buffer_storage;
+extern int sfgogl_ext_ARB_draw_elements_base_vertex;
+extern int sfgogl_ext_ARB_instanced_arrays;
+extern int sfgogl_ext_ARB_draw_instanced;
+extern int sfgogl_ext_EXT_texture_array;
+extern int sfgogl_ext_ARB_occlusion_query;
+extern int sfgogl_ext_ARB_pixel_buffer_object;
 
 #define GL_CLAMP_TO_EDGE_SGIS 0x812F
 
@@ -545,6 +554,60 @@ extern int sfgogl_ext_ARB_explicit_uniform_location;
 
 #define GL_MAX_UNIFORM_LOCATIONS 0x826E
 
+#define GL_MAP_FLUSH_EXPLICIT_BIT 0x0010
+#define GL_MAP_INVALIDATE_BUFFER_BIT 0x0008
+#define GL_MAP_INVALIDATE_RANGE_BIT 0x0004
+#define GL_MAP_READ_BIT 0x0001
+#define GL_MAP_UNSYNCHRONIZED_BIT 0x0020
+#define GL_MAP_WRITE_BIT 0x0002
+
+#define GL_ALREADY_SIGNALED 0x911A
+#define GL_CONDITION_SATISFIED 0x911C
+#define GL_MAX_SERVER_WAIT_TIMEOUT 0x9111
+#define GL_OBJECT_TYPE 0x9112
+#define GL_SIGNALED 0x9119
+#define GL_SYNC_CONDITION 0x9113
+#define GL_SYNC_FENCE 0x9116
+#define GL_SYNC_FLAGS 0x9115
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#define GL_SYNC_STATUS 0x9114
+#define GL_TIMEOUT_EXPIRED 0x911B
+#define GL_TIMEOUT_IGNORED 0xFFFFFFFFFFFFFFFFull
+#define GL_UNSIGNALED 0x9118
+#define GL_WAIT_FAILED 0x911D
+
+#define GL_BUFFER_IMMUTABLE_STORAGE 0x821F
+#define GL_BUFFER_STORAGE_FLAGS 0x8220
+#define GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT 0x00004000
+#define GL_CLIENT_STORAGE_BIT 0x0200
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#define GL_MAP_COHERENT_BIT 0x0080
+#define GL_MAP_PERSISTENT_BIT 0x0040
+
+#define GL_VERTEX_ATTRIB_ARRAY_DIVISOR_ARB 0x88FE
+
+#define GL_COMPARE_REF_DEPTH_TO_TEXTURE_EXT 0x884E
+#define GL_FRAMEBUFFER_ATTACHMENT_TEXTURE_LAYER_EXT 0x8CD4
+#define GL_MAX_ARRAY_TEXTURE_LAYERS_EXT 0x88FF
+#define GL_PROXY_TEXTURE_1D_ARRAY_EXT 0x8C19
+#define GL_PROXY_TEXTURE_2D_ARRAY_EXT 0x8C1B
+#define GL_TEXTURE_1D_ARRAY_EXT 0x8C18
+#define GL_TEXTURE_2D_ARRAY_EXT 0x8C1A
+#define GL_TEXTURE_BINDING_1D_ARRAY_EXT 0x8C1C
+#define GL_TEXTURE_BINDING_2D_ARRAY_EXT 0x8C1D
+
+#define GL_CURRENT_QUERY_ARB 0x8865
+#define GL_QUERY_COUNTER_BITS_ARB 0x8864
+#define GL_QUERY_RESULT_ARB 0x8866
+#define GL_QUERY_RESULT_AVAILABLE_ARB 0x8867
+#define GL_SAMPLES_PASSED_ARB 0x8914
+
+#define GL_PIXEL_PACK_BUFFER_ARB 0x88EB
+#define GL_PIXEL_PACK_BUFFER_BINDING_ARB 0x88ED
+#define GL_PIXEL_UNPACK_BUFFER_ARB 0x88EC
+#define GL_PIXEL_UNPACK_BUFFER_BINDING_ARB 0x88EF
+
 #define GL_2D 0x0600
 #define GL_2_BYTES 0x1407
 #define GL_3D 0x0601
@@ -1561,6 +1624,90 @@ extern void (CODEGEN_FUNCPTR *sfg_ptrc_glProgramParameteriARB)(GLuint, GLenum, G
 #define glProgramParameteriARB sfg_ptrc_glProgramParameteriARB
 #endif /*GL_ARB_geometry_shader4*/
 
+#ifndef GL_ARB_map_buffer_range
+#define GL_ARB_map_buffer_range 1
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glFlushMappedBufferRange)(GLenum, GLintptr, GLsizeiptr);
+#define glFlushMappedBufferRange sfg_ptrc_glFlushMappedBufferRange
+extern void * (CODEGEN_FUNCPTR *sfg_ptrc_glMapBufferRange)(GLenum, GLintptr, GLsizeiptr, GLbitfield);
+#define glMapBufferRange sfg_ptrc_glMapBufferRange
+#endif /*GL_ARB_map_buffer_range*/
+
+#ifndef GL_ARB_sync
+#define GL_ARB_sync 1
+extern GLenum (CODEGEN_FUNCPTR *sfg_ptrc_glClientWaitSync)(GLsync, GLbitfield, GLuint64);
+#define glClientWaitSync sfg_ptrc_glClientWaitSync
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glDeleteSync)(GLsync);
+#define glDeleteSync sfg_ptrc_glDeleteSync
+extern GLsync (CODEGEN_FUNCPTR *sfg_ptrc_glFenceSync)(GLenum, GLbitfield);
+#define glFenceSync sfg_ptrc_glFenceSync
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glGetInteger64v)(GLenum, GLint64 *);
+#define glGetInteger64v sfg_ptrc_glGetInteger64v
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glGetSynciv)(GLsync, GLenum, GLsizei, GLsizei *, GLint *);
+#define glGetSynciv sfg_ptrc_glGetSynciv
+extern GLboolean (CODEGEN_FUNCPTR *sfg_ptrc_glIsSync)(GLsync);
+#define glIsSync sfg_ptrc_glIsSync
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glWaitSync)(GLsync, GLbitfield, GLuint64);
+#define glWaitSync sfg_ptrc_glWaitSync
+#endif /*GL_ARB_sync*/
+
+#ifndef GL_ARB_buffer_storage
+#define GL_ARB_buffer_storage 1
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glBufferStorage)(GLenum, GLsizeiptr, const void *, GLbitfield);
+#define glBufferStorage sfg_ptrc_glBufferStorage
+#endif /*GL_ARB_buffer_storage*/
+
+#ifndef GL_ARB_draw_elements_base_vertex
+#define GL_ARB_draw_elements_base_vertex 1
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glDrawElementsBaseVertex)(GLenum, GLsizei, GLenum, const GLvoid *, GLint);
+#define glDrawElementsBaseVertex sfg_ptrc_glDrawElementsBaseVertex
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glDrawElementsInstancedBaseVertex)(GLenum, GLsizei, GLenum, const GLvoid *, GLsizei, GLint);
+#define glDrawElementsInstancedBaseVertex sfg_ptrc_glDrawElementsInstancedBaseVertex
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glDrawRangeElementsBaseVertex)(GLenum, GLuint, GLuint, GLsizei, GLenum, const GLvoid *, GLint);
+#define glDrawRangeElementsBaseVertex sfg_ptrc_glDrawRangeElementsBaseVertex
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glMultiDrawElementsBaseVertex)(GLenum, const GLsizei *, GLenum, const GLvoid *const*, GLsizei, const GLint *);
+#define glMultiDrawElementsBaseVertex sfg_ptrc_glMultiDrawElementsBaseVertex
+#endif /*GL_ARB_draw_elements_base_vertex*/
+
+#ifndef GL_ARB_instanced_arrays
+#define GL_ARB_instanced_arrays 1
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glVertexAttribDivisorARB)(GLuint, GLuint);
+#define glVertexAttribDivisorARB sfg_ptrc_glVertexAttribDivisorARB
+#endif /*GL_ARB_instanced_arrays*/
+
+#ifndef GL_ARB_draw_instanced
+#define GL_ARB_draw_instanced 1
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glDrawArraysInstancedARB)(GLenum, GLint, GLsizei, GLsizei);
+#define glDrawArraysInstancedARB sfg_ptrc_glDrawArraysInstancedARB
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glDrawElementsInstancedARB)(GLenum, GLsizei, GLenum, const GLvoid *, GLsizei);
+#define glDrawElementsInstancedARB sfg_ptrc_glDrawElementsInstancedARB
+#endif /*GL_ARB_draw_instanced*/
+
+#ifndef GL_EXT_texture_array
+#define GL_EXT_texture_array 1
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glFramebufferTextureLayerEXT)(GLenum, GLenum, GLuint, GLint, GLint);
+#define glFramebufferTextureLayerEXT sfg_ptrc_glFramebufferTextureLayerEXT
+#endif /*GL_EXT_texture_array*/
+
+#ifndef GL_ARB_occlusion_query
+#define GL_ARB_occlusion_query 1
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glBeginQueryARB)(GLenum, GLuint);
+#define glBeginQueryARB sfg_ptrc_glBeginQueryARB
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glDeleteQueriesARB)(GLsizei, const GLuint *);
+#define glDeleteQueriesARB sfg_ptrc_glDeleteQueriesARB
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glEndQueryARB)(GLenum);
+#define glEndQueryARB sfg_ptrc_glEndQueryARB
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glGenQueriesARB)(GLsizei, GLuint *);
+#define glGenQueriesARB sfg_ptrc_glGenQueriesARB
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glGetQueryObjectivARB)(GLuint, GLenum, GLint *);
+#define glGetQueryObjectivARB sfg_ptrc_glGetQueryObjectivARB
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glGetQueryObjectuivARB)(GLuint, GLenum, GLuint *);
+#define glGetQueryObjectuivARB sfg_ptrc_glGetQueryObjectuivARB
+extern void (CODEGEN_FUNCPTR *sfg_ptrc_glGetQueryivARB)(GLenum, GLenum, GLint *);
+#define glGetQueryivARB sfg_ptrc_glGetQueryivARB
+extern GLboolean (CODEGEN_FUNCPTR *sfg_ptrc_glIsQueryARB)(GLuint);
+#define glIsQueryARB sfg_ptrc_glIsQueryARB
+#endif /*GL_ARB_occlusion_query*/
+
 extern void (CODEGEN_FUNCPTR *sfg_ptrc_glAccum)(GLenum, GLfloat);
 #define glAccum sfg_ptrc_glAccum
 extern void (CODEGEN_FUNCPTR *sfg_ptrc_glAlphaFunc)(GLenum, GLfloat);
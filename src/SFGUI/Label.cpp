@@ -170,6 +170,10 @@ std::unique_ptr<RenderQueue> Label::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateLabelDrawable( std::dynamic_pointer_cast<const Label>( shared_from_this() ) );
 }
 
+bool Label::CanInvalidateConcurrently() const {
+	return true;
+}
+
 sf::Vector2f Label::CalculateRequisition() {
 	const std::string& font_name( Context::Get().GetEngine().GetProperty<std::string>( "FontName", shared_from_this() ) );
 	unsigned int font_size( Context::Get().GetEngine().GetProperty<unsigned int>( "FontSize", shared_from_this() ) );
@@ -207,6 +211,10 @@ sf::Vector2f Label::CalculateRequisition() {
 	return metrics;
 }
 
+bool Label::CanMeasureConcurrently() const {
+	return true;
+}
+
 const std::string& Label::GetName() const {
 	static const std::string name( "Label" );
 	return name;
@@ -0,0 +1,305 @@
+#include <SFGUI/ListView.hpp>
+#include <SFGUI/Label.hpp>
+#include <SFGUI/Renderer.hpp>
+#include <SFGUI/RendererViewport.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace sfg {
+
+const ListView::IndexType ListView::NONE = std::numeric_limits<ListView::IndexType>::max();
+
+ListView::ListView( RowFactory factory, RowBinder binder ) :
+	m_factory( factory ),
+	m_binder( binder ),
+	m_item_count( 0 ),
+	m_first_visible( 0 ),
+	m_last_visible( 0 ),
+	m_row_height( 0.f ),
+	m_estimated_row_height( 0.f ),
+	m_row_width( 0.f ),
+	m_visible_top( 0. ),
+	m_adding_row( false )
+{
+}
+
+ListView::Ptr ListView::Create( RowFactory factory, RowBinder binder ) {
+	return Ptr( new ListView( factory, binder ) );
+}
+
+ListView::Ptr ListView::Create( TextSource text_source ) {
+	return Create(
+		[] {
+			auto label = Label::Create();
+			label->SetAlignment( sf::Vector2f( 0.f, .5f ) );
+			return label;
+		},
+		[text_source]( Widget::Ptr row, IndexType index ) {
+			std::static_pointer_cast<Label>( row )->SetText( text_source( index ) );
+		}
+	);
+}
+
+const std::string& ListView::GetName() const {
+	static const std::string name( "ListView" );
+	return name;
+}
+
+sf::Vector2f ListView::CalculateRequisition() {
+	// Multiply in double, the item count doesn't fit a float exactly.
+	return sf::Vector2f( m_row_width, static_cast<float>( static_cast<double>( m_item_count ) * static_cast<double>( GetRowHeight() ) ) );
+}
+
+void ListView::SetItemCount( IndexType count ) {
+	if( count == m_item_count ) {
+		return;
+	}
+
+	m_item_count = count;
+
+	RequestResize();
+	UpdateRows( false );
+}
+
+ListView::IndexType ListView::GetItemCount() const {
+	return m_item_count;
+}
+
+void ListView::SetRowHeight( float height ) {
+	m_row_height = std::max( height, 0.f );
+
+	RequestResize();
+	UpdateRows( false );
+}
+
+float ListView::GetRowHeight() const {
+	return ( m_row_height > 0.f ) ? m_row_height : m_estimated_row_height;
+}
+
+std::pair<ListView::IndexType, ListView::IndexType> ListView::GetVisibleRange() const {
+	return std::make_pair( m_first_visible, m_last_visible );
+}
+
+std::size_t ListView::GetRowCount() const {
+	return m_rows.size();
+}
+
+void ListView::RefreshItems() {
+	UpdateRows( true );
+}
+
+void ListView::RefreshItem( IndexType index ) {
+	for( std::size_t row = 0; row < m_rows.size(); ++row ) {
+		if( m_row_items[row] == index ) {
+			m_binder( m_rows[row], index );
+			AllocateRow( row );
+			return;
+		}
+	}
+}
+
+bool ListView::HandleAdd( Widget::Ptr child ) {
+	// Rows are created by the list view itself.
+	if( !m_adding_row ) {
+
+#if defined( SFGUI_DEBUG )
+		std::cerr << "SFGUI warning: Widgets can't be added to sfg::ListView, rows are created through its row factory.\n";
+#endif
+
+		return false;
+	}
+
+	return Container::HandleAdd( child );
+}
+
+void ListView::HandleRemove( Widget::Ptr child ) {
+	auto iter = std::find( m_rows.begin(), m_rows.end(), child );
+
+	if( iter != m_rows.end() ) {
+		m_row_items.erase( m_row_items.begin() + ( iter - m_rows.begin() ) );
+		m_rows.erase( iter );
+	}
+}
+
+void ListView::HandleUpdate( float seconds ) {
+	// Only look at the visible area once per update. Scrolling
+	// changes the source origin of our viewport, rows are
+	// rebound before they get updated themselves.
+	auto visible_rect = GetVisibleRect();
+
+	if( visible_rect != m_last_visible_rect ) {
+		m_last_visible_rect = visible_rect;
+
+		UpdateRows( false );
+	}
+
+	Container::HandleUpdate( seconds );
+}
+
+void ListView::HandleSizeChange() {
+	for( std::size_t row = 0; row < m_rows.size(); ++row ) {
+		if( m_row_items[row] != NONE ) {
+			AllocateRow( row );
+		}
+	}
+}
+
+sf::FloatRect ListView::GetVisibleRect() const {
+	auto viewport = GetViewport();
+	auto position = GetAbsolutePosition();
+
+	// Outside of a Viewport the visible area is the window.
+	if( !viewport || ( viewport == Renderer::Get().GetDefaultViewport() ) ) {
+		return sf::FloatRect( -position, sf::Vector2f( Renderer::Get().GetWindowSize() ) );
+	}
+
+	// Inside a Viewport absolute positions are relative to its source origin.
+	return sf::FloatRect( viewport->GetSourceOrigin() - position, viewport->GetSize() );
+}
+
+void ListView::UpdateRows( bool rebind ) {
+	auto old_row_width = m_row_width;
+	auto old_row_height = GetRowHeight();
+
+	// Without a known row height, bind the first item to measure it.
+	if( ( old_row_height <= 0.f ) && m_item_count ) {
+		if( m_rows.empty() ) {
+			auto row = m_factory();
+
+			m_rows.push_back( row );
+			m_row_items.push_back( NONE );
+
+			m_adding_row = true;
+			Container::Add( row );
+			m_adding_row = false;
+		}
+
+		m_binder( m_rows[0], 0 );
+		m_row_items[0] = 0;
+
+		m_estimated_row_height = std::max( m_estimated_row_height, m_rows[0]->GetRequisition().y );
+
+		if( GetRowHeight() <= 0.f ) {
+			return;
+		}
+
+		RequestResize();
+	}
+
+	auto row_height = GetRowHeight();
+
+	m_first_visible = 0;
+	m_last_visible = 0;
+
+	if( ( row_height > 0.f ) && m_item_count ) {
+		// Item offsets of long lists don't fit a float exactly, they
+		// are computed in double relative to the top of the visible area.
+		auto visible_rect = GetVisibleRect();
+		auto top = std::max( static_cast<double>( visible_rect.position.y ), 0. );
+		auto bottom = static_cast<double>( visible_rect.position.y ) + static_cast<double>( visible_rect.size.y );
+
+		m_visible_top = top;
+
+		if( bottom > top ) {
+			m_first_visible = std::min( static_cast<IndexType>( std::floor( top / static_cast<double>( row_height ) ) ), m_item_count );
+			m_last_visible = std::min( static_cast<IndexType>( std::ceil( bottom / static_cast<double>( row_height ) ) ), m_item_count );
+		}
+	}
+
+	// Keep rows that still show a visible item and collect the rest for recycling.
+	std::vector<bool> bound( m_last_visible - m_first_visible, false );
+	std::vector<std::size_t> free_rows;
+
+	for( std::size_t row = 0; row < m_rows.size(); ++row ) {
+		auto item = m_row_items[row];
+
+		if( ( item == NONE ) || ( item < m_first_visible ) || ( item >= m_last_visible ) ) {
+			free_rows.push_back( row );
+			continue;
+		}
+
+		bound[item - m_first_visible] = true;
+
+		if( rebind ) {
+			m_binder( m_rows[row], item );
+		}
+
+		m_rows[row]->Show( true );
+
+		AllocateRow( row );
+	}
+
+	// Bind all visible items that don't have a row yet.
+	for( auto item = m_first_visible; item < m_last_visible; ++item ) {
+		if( bound[item - m_first_visible] ) {
+			continue;
+		}
+
+		std::size_t row = 0;
+
+		if( !free_rows.empty() ) {
+			row = free_rows.back();
+			free_rows.pop_back();
+		}
+		else {
+			row = m_rows.size();
+
+			m_rows.push_back( m_factory() );
+			m_row_items.push_back( NONE );
+
+			m_adding_row = true;
+			Container::Add( m_rows[row] );
+			m_adding_row = false;
+		}
+
+		m_binder( m_rows[row], item );
+		m_row_items[row] = item;
+
+		m_rows[row]->Show( true );
+
+		AllocateRow( row );
+	}
+
+	// Hide surplus rows, they are kept for later reuse.
+	for( auto row : free_rows ) {
+		m_row_items[row] = NONE;
+		m_rows[row]->Show( false );
+	}
+
+	if( m_row_width != old_row_width ) {
+		RequestResize();
+	}
+
+	// The estimated height grew, lay out the rows again with the new height.
+	if( GetRowHeight() != row_height ) {
+		RequestResize();
+		UpdateRows( false );
+	}
+}
+
+void ListView::AllocateRow( std::size_t row ) {
+	auto& widget = m_rows[row];
+	auto requisition = widget->GetRequisition();
+
+	m_row_width = std::max( m_row_width, requisition.x );
+
+	if( m_row_height <= 0.f ) {
+		m_estimated_row_height = std::max( m_estimated_row_height, requisition.y );
+	}
+
+	auto row_height = GetRowHeight();
+
+	// Only the small offset from the top of the visible area is converted to float.
+	auto local_offset = static_cast<double>( m_row_items[row] ) * static_cast<double>( row_height ) - m_visible_top;
+
+	widget->SetAllocation(
+		sf::FloatRect(
+			sf::Vector2f( 0.f, static_cast<float>( m_visible_top ) + static_cast<float>( local_offset ) ),
+			sf::Vector2f( std::max( GetAllocation().size.x, requisition.x ), row_height )
+		)
+	);
+}
+
+}
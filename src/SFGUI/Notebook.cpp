@@ -34,6 +34,10 @@ std::unique_ptr<RenderQueue> Notebook::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateNotebookDrawable( std::dynamic_pointer_cast<const Notebook>( shared_from_this() ) );
 }
 
+bool Notebook::CanInvalidateConcurrently() const {
+	return true;
+}
+
 sf::Vector2f Notebook::CalculateRequisition() {
 	if( !GetPageCount() ) {
 		return sf::Vector2f( 0.f, 0.f );
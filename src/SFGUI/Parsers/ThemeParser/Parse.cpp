@@ -1,92 +1,385 @@
-#include <SFGUI/Parsers/ThemeParser/Grammar.hpp>
 #include <SFGUI/Parsers/ThemeParser/Parse.hpp>
 
 #include <vector>
 #include <string>
 #include <fstream>
+#include <algorithm>
+#include <cstring>
 
-namespace sfg {
-namespace parser {
-namespace theme {
+namespace {
+
+// Recursive descent parser for themes. All parsing state lives in the
+// parser object, themes can be parsed from multiple threads at once.
+class Parser {
+	public:
+		Parser( const char* begin, const char* end ) :
+			m_begin( begin ),
+			m_end( end ),
+			m_position( begin ),
+			m_expected( nullptr )
+		{
+		}
+
+		bool ParseTheme( sfg::parser::theme::Theme& theme ) {
+			SkipBlanks();
+
+			while( m_position != m_end ) {
+				if( !CanStartSimpleSelector() ) {
+					return Fail( "Identifier or *" );
+				}
+
+				theme.emplace_back();
+
+				if( !ParseRule( theme.back() ) ) {
+					return false;
+				}
+
+				SkipBlanks();
+			}
+
+			return true;
+		}
+
+		bool ParseSelectorOnly( sfg::parser::theme::Selector& selector ) {
+			SkipBlanks();
+
+			if( !ParseSelector( selector ) ) {
+				return false;
+			}
+
+			SkipBlanks();
+
+			if( m_position != m_end ) {
+				return Fail( "Selector Combinator or end" );
+			}
+
+			return true;
+		}
+
+		std::size_t GetOffset() const {
+			return static_cast<std::size_t>( m_position - m_begin );
+		}
+
+		std::size_t GetLineNumber() const {
+			return static_cast<std::size_t>( std::count( m_begin, m_position, '\n' ) ) + 1;
+		}
+
+		const char* GetExpected() const {
+			return m_expected ? m_expected : "";
+		}
+
+	private:
+		static bool IsAlpha( char character ) {
+			return ( ( character >= 'a' ) && ( character <= 'z' ) ) || ( ( character >= 'A' ) && ( character <= 'Z' ) ) || ( character == '_' );
+		}
+
+		static bool IsAlnum( char character ) {
+			return IsAlpha( character ) || ( ( character >= '0' ) && ( character <= '9' ) );
+		}
+
+		static bool IsBlank( char character ) {
+			return ( character == ' ' ) || ( character == '\t' ) || ( character == '\n' ) || ( character == '\r' ) || ( character == '\v' );
+		}
+
+		bool Fail( const char* expected ) {
+			m_expected = expected;
+			return false;
+		}
+
+		bool Accept( char character ) {
+			if( ( m_position != m_end ) && ( *m_position == character ) ) {
+				++m_position;
+				return true;
+			}
+
+			return false;
+		}
+
+		// Skip blanks and comments.
+		void SkipBlanks() {
+			while( m_position != m_end ) {
+				if( IsBlank( *m_position ) ) {
+					++m_position;
+				}
+				else if( ( ( m_end - m_position ) >= 2 ) && ( m_position[0] == '/' ) && ( m_position[1] == '*' ) ) {
+					const char terminator[] = "*/";
+					auto comment_end = std::search( m_position + 2, m_end, terminator, terminator + 2 );
+
+					// Unterminated comments are left for the caller to fail on.
+					if( comment_end == m_end ) {
+						return;
+					}
+
+					m_position = comment_end + 2;
+				}
+				else {
+					return;
+				}
+			}
+		}
+
+		bool CanStartSimpleSelector() const {
+			return ( m_position != m_end ) && ( IsAlpha( *m_position ) || ( *m_position == '*' ) || ( *m_position == '.' ) || ( *m_position == ':' ) || ( *m_position == '#' ) );
+		}
+
+		bool ParseIdentifier( std::string& identifier ) {
+			if( ( m_position == m_end ) || !IsAlpha( *m_position ) ) {
+				return Fail( "Identifier" );
+			}
+
+			auto begin = m_position;
+
+			while( ( m_position != m_end ) && ( IsAlnum( *m_position ) || ( *m_position == '-' ) ) ) {
+				++m_position;
+			}
+
+			identifier.assign( begin, m_position );
+			return true;
+		}
+
+		bool ParseValue( std::string& value ) {
+			auto begin = m_position;
+
+			while( m_position != m_end ) {
+				auto character = *m_position;
+
+				if( !IsAlnum( character ) && ( !character || !std::strchr( ".# /-", character ) ) ) {
+					break;
+				}
+
+				++m_position;
+			}
+
+			if( m_position == begin ) {
+				return Fail( "Value" );
+			}
+
+			value.assign( begin, m_position );
+			return true;
+		}
+
+		bool ParseSimpleSelector( sfg::parser::theme::SimpleSelector& simple_selector ) {
+			auto has_type = true;
+
+			if( Accept( '*' ) ) {
+				simple_selector.m_type_selector = "*";
+			}
+			else if( ( m_position != m_end ) && IsAlpha( *m_position ) ) {
+				ParseIdentifier( simple_selector.m_type_selector );
+			}
+			else {
+				simple_selector.m_type_selector = "*";
+				has_type = false;
+			}
+
+			// Class, state and ID may follow in any order, each at most once.
+			auto has_class = false;
+			auto has_state = false;
+			auto has_id = false;
+
+			while( true ) {
+				auto position = m_position;
+
+				SkipBlanks();
+
+				std::string* part = nullptr;
+
+				if( !has_class && Accept( '.' ) ) {
+					has_class = true;
+					part = &simple_selector.m_class_selector;
+				}
+				else if( !has_state && Accept( ':' ) ) {
+					has_state = true;
+					part = &simple_selector.m_state_selector;
+				}
+				else if( !has_id && Accept( '#' ) ) {
+					has_id = true;
+					part = &simple_selector.m_id_selector;
+				}
+				else {
+					m_position = position;
+					break;
+				}
+
+				SkipBlanks();
+
+				if( !ParseIdentifier( *part ) ) {
+					return false;
+				}
+			}
+
+			if( !has_type && !has_class && !has_state && !has_id ) {
+				return Fail( "Simple Selector" );
+			}
 
-static ThemeGrammar _grammar;
+			return true;
+		}
+
+		bool ParseSelector( sfg::parser::theme::Selector& selector ) {
+			selector.m_simple_selectors.emplace_back();
+
+			if( !ParseSimpleSelector( selector.m_simple_selectors.back() ) ) {
+				return false;
+			}
+
+			while( true ) {
+				SkipBlanks();
+
+				const char* combinator = " ";
+
+				if( Accept( '>' ) ) {
+					combinator = ">";
+				}
+				else if( Accept( ',' ) ) {
+					combinator = ",";
+				}
+				else if( !CanStartSimpleSelector() ) {
+					return true;
+				}
+
+				SkipBlanks();
+
+				selector.m_simple_selectors.emplace_back();
+
+				if( !ParseSimpleSelector( selector.m_simple_selectors.back() ) ) {
+					return false;
+				}
+
+				selector.m_simple_selectors.back().m_combinator = combinator;
+			}
+		}
+
+		bool ParseRule( sfg::parser::theme::Rule& rule ) {
+			if( !ParseSelector( rule.m_selector ) ) {
+				return false;
+			}
+
+			SkipBlanks();
+
+			if( !Accept( '{' ) ) {
+				return Fail( "Selector Combinator or {" );
+			}
+
+			while( true ) {
+				SkipBlanks();
+
+				if( Accept( '}' ) ) {
+					return true;
+				}
+
+				if( ( m_position == m_end ) || !IsAlpha( *m_position ) ) {
+					return Fail( "Declaration or }" );
+				}
+
+				rule.m_declarations.emplace_back();
+
+				auto& declaration = rule.m_declarations.back();
+
+				ParseIdentifier( declaration.m_property_name );
+
+				SkipBlanks();
+
+				if( !Accept( ':' ) ) {
+					return Fail( ":" );
+				}
+
+				SkipBlanks();
+
+				if( !ParseValue( declaration.m_property_value ) ) {
+					return false;
+				}
+
+				SkipBlanks();
+
+				if( !Accept( ';' ) ) {
+					return Fail( ";" );
+				}
+			}
+		}
+
+		const char* m_begin;
+		const char* m_end;
+		const char* m_position;
+		const char* m_expected;
+};
+
+#if defined( SFGUI_DEBUG )
+std::string GetLine( const std::string& str, std::size_t line ) {
+	std::size_t begin = 0;
 
-std::string GetLine( std::string str, std::size_t line ) {
 	for( std::size_t current_line = 1; current_line < line; ++current_line ) {
-		auto position = str.find( '\n' );
-		if( ( position == std::string::npos ) || ( position == ( str.size() - 1 ) ) ) {
+		begin = str.find( '\n', begin );
+
+		if( begin == std::string::npos ) {
 			return std::string( "" );
 		}
 
-		str.erase( 0, position + 1 );
+		++begin;
 	}
 
-	str.erase( str.find( '\n' ) );
-
-	return str;
+	return str.substr( begin, str.find( '\n', begin ) - begin );
 }
 
-std::size_t ColumnPosition( std::string str, std::size_t string_position ) {
-	std::size_t column_position = 0;
-
+std::size_t ColumnPosition( const std::string& str, std::size_t string_position ) {
 	if( string_position >= str.size() ) {
 		return 0;
 	}
 
-	for( std::size_t index = 0; ( index < string_position ) && ( index < str.size() ); ++index ) {
-		++column_position;
+	auto line_begin = str.rfind( '\n', string_position ? string_position - 1 : 0 );
 
-		if( str[ index ] == '\n' ) {
-			column_position = 0;
-		}
+	if( ( line_begin == std::string::npos ) || ( line_begin >= string_position ) ) {
+		return string_position;
 	}
 
-	return column_position;
+	return string_position - line_begin - 1;
+}
+#endif
+
 }
 
-std::vector<Rule> ParseString( std::string str ) {
-	_grammar.ClearResults();
-	//ELL_ENABLE_DUMP( grammar );
+namespace sfg {
+namespace parser {
+namespace theme {
 
-	auto result = false;
+std::vector<Rule> ParseString( const std::string& str ) {
+	Parser parser( str.data(), str.data() + str.size() );
 
 	std::vector<Rule> rules;
 
-	try {
-		_grammar.parse( str.c_str() );
-		rules = _grammar.GetTheme();
-		result = true;
+	if( parser.ParseTheme( rules ) ) {
+		return rules;
 	}
-#if defined( SFGUI_DEBUG )
-	catch( const std::runtime_error& e ) {
-		result = false;
 
-		std::cerr << "Error parsing string:\n"
-		 << str << "\n"
-		 << std::string( static_cast<std::size_t>( _grammar.position - str.c_str() ), ' ' ) << "^\n"
-		 << "Expected " << strstr( e.what(), "expecting " ) + 10 << "\n";
-	}
-#else
-	catch( const std::runtime_error& /*e*/ ) {
-		result = false;
-	}
+#if defined( SFGUI_DEBUG )
+	std::cerr << "Error parsing string:\n"
+	 << str << "\n"
+	 << std::string( parser.GetOffset(), ' ' ) << "^\n"
+	 << "Expected " << parser.GetExpected() << "\n";
 #endif
 
-	if( result && ( _grammar.get() == '\0' ) ) {
-		return rules;
-	}
-
 	return std::vector<Rule>();
 }
 
-std::vector<Rule> ParseFile( std::string filename ) {
-	_grammar.ClearResults();
-	//ELL_ENABLE_DUMP( grammar );
+bool ParseSelector( const std::string& str, Selector& selector ) {
+	Parser parser( str.data(), str.data() + str.size() );
 
-	auto result = false;
+	if( parser.ParseSelectorOnly( selector ) ) {
+		return true;
+	}
 
-	std::vector<Rule> rules;
+#if defined( SFGUI_DEBUG )
+	std::cerr << "Error parsing selector:\n"
+	 << str << "\n"
+	 << std::string( parser.GetOffset(), ' ' ) << "^\n"
+	 << "Expected " << parser.GetExpected() << "\n";
+#endif
 
+	selector.m_simple_selectors.clear();
+
+	return false;
+}
+
+std::vector<Rule> ParseFile( const std::string& filename ) {
 	std::ifstream file( filename.c_str(), std::ifstream::in );
 	file.unsetf( std::ios::skipws );
 
@@ -94,38 +387,25 @@ std::vector<Rule> ParseFile( std::string filename ) {
 #if defined( SFGUI_DEBUG )
 		std::cerr << "Error opening file: " << filename << "\n";
 #endif
-		file.close();
 		return std::vector<Rule>();
 	}
 
 	auto str = std::string( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
 
-	try {
-		_grammar.parse( str.c_str() );
-		rules = _grammar.GetTheme();
-		result = true;
-	}
-#if defined( SFGUI_DEBUG )
-	catch( const std::runtime_error& e ) {
-		result = false;
+	Parser parser( str.data(), str.data() + str.size() );
 
-		std::cerr << "Error parsing file \"" << filename << "\" at line " << _grammar.line_number <<":\n"
-		 << GetLine( str, static_cast<std::size_t>( _grammar.line_number ) ) << "\n"
-		 << std::string( ColumnPosition( str, static_cast<std::size_t>( _grammar.position - str.c_str() ) ), ' ' ) << "^\n"
-		 << "Expected " << strstr( e.what(), "expecting " ) + 10 << "\n";
-	}
-#else
-	catch( const std::runtime_error& /*e*/ ) {
-		result = false;
-	}
-#endif
+	std::vector<Rule> rules;
 
-	if( result && ( _grammar.get() == '\0' ) ) {
-		file.close();
+	if( parser.ParseTheme( rules ) ) {
 		return rules;
 	}
 
-	file.close();
+#if defined( SFGUI_DEBUG )
+	std::cerr << "Error parsing file \"" << filename << "\" at line " << parser.GetLineNumber() << ":\n"
+	 << GetLine( str, parser.GetLineNumber() ) << "\n"
+	 << std::string( ColumnPosition( str, parser.GetOffset() ), ' ' ) << "^\n"
+	 << "Expected " << parser.GetExpected() << "\n";
+#endif
 
 	return std::vector<Rule>();
 }
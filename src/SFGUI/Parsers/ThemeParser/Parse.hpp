@@ -36,8 +36,25 @@ struct Rule {
 	std::vector<Declaration> m_declarations;
 };
 
-std::vector<Rule> ParseString( std::string str );
-std::vector<Rule> ParseFile( std::string filename );
+/** Parse a theme from a string.
+ * The parser has no global state, themes can be parsed from multiple threads.
+ * @param str Theme data.
+ * @return Rules of the theme, empty on error.
+ */
+std::vector<Rule> ParseString( const std::string& str );
+
+/** Parse a single selector, e.g. "Window > Button:PRELIGHT".
+ * @param str Selector string.
+ * @param selector Parsed selector.
+ * @return true on success, false otherwise.
+ */
+bool ParseSelector( const std::string& str, Selector& selector );
+
+/** Parse a theme from a file.
+ * @param filename Filename.
+ * @return Rules of the theme, empty on error.
+ */
+std::vector<Rule> ParseFile( const std::string& filename );
 
 typedef std::vector<Rule> Theme;
 
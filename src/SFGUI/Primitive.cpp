@@ -2,18 +2,83 @@
 #include <SFGUI/PrimitiveTexture.hpp>
 #include <SFGUI/PrimitiveVertex.hpp>
 #include <SFGUI/RendererViewport.hpp>
+#include <SFGUI/RendererTransform.hpp>
 #include <SFGUI/Renderer.hpp>
 #include <SFGUI/Signal.hpp>
 
+#include <SFML/Graphics/Rect.hpp>
+#include <cmath>
+
+namespace {
+
+void AddQuad( sfg::Primitive& primitive, const sf::Vector2f& top_left, const sf::Vector2f& bottom_left,
+              const sf::Vector2f& bottom_right, const sf::Vector2f& top_right,
+              const sf::Color& color, const sf::FloatRect& texture_rect ) {
+	sfg::PrimitiveVertex vertex0;
+	sfg::PrimitiveVertex vertex1;
+	sfg::PrimitiveVertex vertex2;
+	sfg::PrimitiveVertex vertex3;
+
+	vertex0.position = sf::Vector2f( std::floor( top_left.x + .5f ), std::floor( top_left.y + .5f ) );
+	vertex1.position = sf::Vector2f( std::floor( bottom_left.x + .5f ), std::floor( bottom_left.y + .5f ) );
+	vertex2.position = sf::Vector2f( std::floor( top_right.x + .5f ), std::floor( top_right.y + .5f ) );
+	vertex3.position = sf::Vector2f( std::floor( bottom_right.x + .5f ), std::floor( bottom_right.y + .5f ) );
+
+	vertex0.color = color;
+	vertex1.color = color;
+	vertex2.color = color;
+	vertex3.color = color;
+
+	vertex0.texture_coordinate = texture_rect.position;
+	vertex1.texture_coordinate = texture_rect.position + sf::Vector2f( 0.f, texture_rect.size.y );
+	vertex2.texture_coordinate = texture_rect.position + sf::Vector2f( texture_rect.size.x, 0.f );
+	vertex3.texture_coordinate = texture_rect.position + texture_rect.size;
+
+	primitive.AddVertex( vertex0 );
+	primitive.AddVertex( vertex1 );
+	primitive.AddVertex( vertex2 );
+	primitive.AddVertex( vertex2 );
+	primitive.AddVertex( vertex1 );
+	primitive.AddVertex( vertex3 );
+}
+
+void AddLine( sfg::Primitive& primitive, const sf::Vector2f& begin, const sf::Vector2f& end,
+              const sf::Color& color, float thickness, const sf::FloatRect& texture_rect ) {
+	sf::Vector2f normal( end - begin );
+	sf::Vector2f unrotated_normal( normal );
+	std::swap( normal.x, normal.y );
+	auto length = std::sqrt( normal.x * normal.x + normal.y * normal.y );
+
+	if( !( length > 0.f ) ) {
+		return;
+	}
+
+	normal.x /= -length;
+	normal.y /= length;
+	unrotated_normal.x /= length;
+	unrotated_normal.y /= length;
+
+	sf::Vector2f corner0( begin + normal * ( thickness * .5f ) - unrotated_normal * ( thickness * .5f ) );
+	sf::Vector2f corner1( begin - normal * ( thickness * .5f ) - unrotated_normal * ( thickness * .5f ) );
+	sf::Vector2f corner2( end - normal * ( thickness * .5f ) + unrotated_normal * ( thickness * .5f ) );
+	sf::Vector2f corner3( end + normal * ( thickness * .5f ) + unrotated_normal * ( thickness * .5f ) );
+
+	AddQuad( primitive, corner3, corner2, corner1, corner0, color, texture_rect );
+}
+
+}
+
 namespace sfg {
 
 Primitive::Primitive( std::size_t vertex_reserve ) :
 	m_layer( 0 ),
 	m_level( 0 ),
 	m_synced( false ),
-	m_visible( true )
+	m_visible( true ),
+	m_opaque( false )
 {
 	m_viewport = Renderer::Get().GetDefaultViewport();
+	m_transform = Renderer::Get().GetDefaultTransform();
 
 	if( vertex_reserve > 0 ) {
 		m_vertices.reserve( vertex_reserve );
@@ -30,6 +95,10 @@ void Primitive::Add( Primitive& primitive ) {
 	for( const auto& index : primitive.GetIndices() ) {
 		m_indices.push_back( static_cast<unsigned int>( current_index + index ) );
 	}
+
+	for( const auto& instance : primitive.GetInstances() ) {
+		m_instances.push_back( instance );
+	}
 }
 
 void Primitive::AddVertex( const PrimitiveVertex& vertex ) {
@@ -53,6 +122,98 @@ void Primitive::AddVertex( const PrimitiveVertex& vertex ) {
 	m_vertices.push_back( vertex );
 }
 
+void Primitive::AddInstance( const PrimitiveInstance& instance ) {
+	m_synced = false;
+
+	m_instances.push_back( instance );
+}
+
+void Primitive::ExpandInstances() {
+	if( m_instances.empty() ) {
+		return;
+	}
+
+	m_vertices.reserve( m_vertices.size() + m_instances.size() * 4 );
+
+	for( const auto& instance : m_instances ) {
+		// Distance field glyphs only make sense to the shader that decodes
+		// them, the text they belong to is re-created as bitmap text.
+		if( instance.distance_field ) {
+			continue;
+		}
+
+		auto left = instance.rect.position.x;
+		auto top = instance.rect.position.y;
+		auto right = left + instance.rect.size.x;
+		auto bottom = top + instance.rect.size.y;
+
+		if( instance.border_width <= 0.f ) {
+			AddQuad(
+				*this,
+				sf::Vector2f( left, top ),
+				sf::Vector2f( left, bottom ),
+				sf::Vector2f( right, bottom ),
+				sf::Vector2f( right, top ),
+				instance.color,
+				instance.texture_rect
+			);
+
+			continue;
+		}
+
+		auto border_width = instance.border_width;
+
+		AddQuad(
+			*this,
+			sf::Vector2f( left + border_width, top + border_width ),
+			sf::Vector2f( left + border_width, bottom - border_width ),
+			sf::Vector2f( right - border_width, bottom - border_width ),
+			sf::Vector2f( right - border_width, top + border_width ),
+			instance.color,
+			instance.texture_rect
+		);
+
+		AddLine(
+			*this,
+			sf::Vector2f( left + border_width / 2.f, top + border_width / 2.f ),
+			sf::Vector2f( right - border_width / 2.f, top + border_width / 2.f ),
+			instance.light_border_color,
+			border_width,
+			instance.texture_rect
+		);
+
+		AddLine(
+			*this,
+			sf::Vector2f( right - border_width / 2.f, top + border_width / 2.f ),
+			sf::Vector2f( right - border_width / 2.f, bottom - border_width / 2.f ),
+			instance.dark_border_color,
+			border_width,
+			instance.texture_rect
+		);
+
+		AddLine(
+			*this,
+			sf::Vector2f( right - border_width / 2.f, bottom - border_width / 2.f ),
+			sf::Vector2f( left + border_width / 2.f, bottom - border_width / 2.f ),
+			instance.dark_border_color,
+			border_width,
+			instance.texture_rect
+		);
+
+		AddLine(
+			*this,
+			sf::Vector2f( left + border_width / 2.f, bottom - border_width / 2.f ),
+			sf::Vector2f( left + border_width / 2.f, top + border_width / 2.f ),
+			instance.light_border_color,
+			border_width,
+			instance.texture_rect
+		);
+	}
+
+	m_instances.clear();
+	m_synced = false;
+}
+
 void Primitive::AddTexture( PrimitiveTexture::Ptr texture ) {
 	m_textures.push_back( texture );
 }
@@ -77,6 +238,16 @@ RendererViewport::Ptr Primitive::GetViewport() const {
 	return m_viewport;
 }
 
+void Primitive::SetTransform( RendererTransform::Ptr transform ) {
+	m_transform = transform;
+
+	m_synced = false;
+}
+
+RendererTransform::Ptr Primitive::GetTransform() const {
+	return m_transform;
+}
+
 void Primitive::SetLayer( int layer ) {
 	m_layer = layer;
 
@@ -105,6 +276,10 @@ std::vector<PrimitiveTexture::Ptr>& Primitive::GetTextures() {
 	return m_textures;
 }
 
+const std::vector<PrimitiveInstance>& Primitive::GetInstances() const {
+	return m_instances;
+}
+
 const std::vector<unsigned int>& Primitive::GetIndices() const {
 	return m_indices;
 }
@@ -127,6 +302,14 @@ bool Primitive::IsVisible() const {
 	return m_visible;
 }
 
+void Primitive::SetOpaque( bool opaque ) {
+	m_opaque = opaque;
+}
+
+bool Primitive::IsOpaque() const {
+	return m_opaque;
+}
+
 void Primitive::SetCustomDrawCallback( std::shared_ptr<Signal> callback ) {
 	m_custom_draw_callback = callback;
 }
@@ -137,6 +320,7 @@ std::shared_ptr<Signal> Primitive::GetCustomDrawCallback() const {
 
 void Primitive::Clear() {
 	m_vertices.clear();
+	m_instances.clear();
 	m_textures.clear();
 	m_indices.clear();
 
@@ -145,8 +329,10 @@ void Primitive::Clear() {
 	m_level = 0;
 	m_synced = false;
 	m_visible = true;
+	m_opaque = false;
 
 	m_viewport = Renderer::Get().GetDefaultViewport();
+	m_transform = Renderer::Get().GetDefaultTransform();
 	m_custom_draw_callback.reset();
 }
 
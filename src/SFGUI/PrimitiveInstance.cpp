@@ -0,0 +1,15 @@
+#include <SFGUI/PrimitiveInstance.hpp>
+
+namespace sfg {
+
+PrimitiveInstance::PrimitiveInstance() :
+	texture_rect( { 0.f, 0.f }, { 1.f, 1.f } ),
+	color( sf::Color::White ),
+	light_border_color( sf::Color::White ),
+	dark_border_color( sf::Color::White ),
+	border_width( 0.f ),
+	distance_field( false )
+{
+}
+
+}
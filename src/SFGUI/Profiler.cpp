@@ -0,0 +1,228 @@
+#include <SFGUI/Profiler.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+namespace {
+
+const auto phase_count = static_cast<std::size_t>( sfg::Profiler::Phase::COUNT );
+const auto counter_count = static_cast<std::size_t>( sfg::Profiler::Counter::COUNT );
+
+std::atomic<bool> enabled( false );
+
+// Counters are also incremented from worker threads.
+std::array<std::atomic<std::int64_t>, phase_count> phase_nanoseconds;
+std::array<std::atomic<std::uint64_t>, counter_count> counters;
+
+std::deque<sfg::Profiler::Frame> history;
+std::size_t history_size = 120;
+
+// Scopes entered on a thread, the innermost scope is the one being timed.
+struct ActiveScope {
+	sfg::Profiler::Phase phase;
+	std::chrono::steady_clock::time_point resumed;
+};
+
+thread_local std::vector<ActiveScope> active_scopes;
+
+void AddTime( const ActiveScope& scope, std::chrono::steady_clock::time_point now ) {
+	phase_nanoseconds[static_cast<std::size_t>( scope.phase )] += std::chrono::duration_cast<std::chrono::nanoseconds>( now - scope.resumed ).count();
+}
+
+}
+
+namespace sfg {
+
+Profiler::Frame::Frame() {
+	timings.fill( 0.f );
+	counters.fill( 0 );
+}
+
+float Profiler::Frame::GetTiming( Phase phase ) const {
+	return timings[static_cast<std::size_t>( phase )];
+}
+
+float Profiler::Frame::GetTotalTiming() const {
+	auto total = 0.f;
+
+	for( auto timing : timings ) {
+		total += timing;
+	}
+
+	return total;
+}
+
+std::uint64_t Profiler::Frame::GetCount( Counter counter ) const {
+	return counters[static_cast<std::size_t>( counter )];
+}
+
+bool Profiler::IsAvailable() {
+#if defined( SFGUI_PROFILER )
+	return true;
+#else
+	return false;
+#endif
+}
+
+void Profiler::SetEnabled( bool enable ) {
+	enabled = enable && IsAvailable();
+}
+
+bool Profiler::IsEnabled() {
+	return enabled;
+}
+
+void Profiler::SetHistorySize( std::size_t size ) {
+	history_size = size;
+
+	while( history.size() > history_size ) {
+		history.pop_front();
+	}
+}
+
+std::size_t Profiler::GetHistorySize() {
+	return history_size;
+}
+
+const std::deque<Profiler::Frame>& Profiler::GetHistory() {
+	return history;
+}
+
+Profiler::Frame Profiler::GetAverage() {
+	Frame average;
+
+	if( history.empty() ) {
+		return average;
+	}
+
+	for( const auto& frame : history ) {
+		for( std::size_t index = 0; index < phase_count; ++index ) {
+			average.timings[index] += frame.timings[index];
+		}
+
+		for( std::size_t index = 0; index < counter_count; ++index ) {
+			average.counters[index] += frame.counters[index];
+		}
+	}
+
+	for( auto& timing : average.timings ) {
+		timing /= static_cast<float>( history.size() );
+	}
+
+	for( auto& counter : average.counters ) {
+		counter /= history.size();
+	}
+
+	return average;
+}
+
+void Profiler::Clear() {
+	history.clear();
+
+	for( auto& nanoseconds : phase_nanoseconds ) {
+		nanoseconds = 0;
+	}
+
+	for( auto& counter : counters ) {
+		counter = 0;
+	}
+}
+
+void Profiler::EndFrame() {
+	if( !enabled ) {
+		return;
+	}
+
+	Frame frame;
+
+	for( std::size_t index = 0; index < phase_count; ++index ) {
+		frame.timings[index] = static_cast<float>( phase_nanoseconds[index].exchange( 0 ) ) / 1000.f;
+	}
+
+	for( std::size_t index = 0; index < counter_count; ++index ) {
+		frame.counters[index] = counters[index].exchange( 0 );
+	}
+
+	history.push_back( frame );
+
+	while( history.size() > history_size ) {
+		history.pop_front();
+	}
+}
+
+const std::string& Profiler::GetPhaseName( Phase phase ) {
+	static const std::array<std::string, phase_count> names = { {
+		"HandleEvent",
+		"Layout",
+		"Drawables",
+		"HandleUpdate",
+		"SortPrimitives",
+		"RefreshVBO",
+		"Display"
+	} };
+
+	return names[static_cast<std::size_t>( phase ) % phase_count];
+}
+
+const std::string& Profiler::GetCounterName( Counter counter ) {
+	static const std::array<std::string, counter_count> names = { {
+		"Invalidated widgets",
+		"Created primitives",
+		"Destroyed primitives",
+		"Uploaded vertices",
+		"Uploaded bytes",
+		"Batches",
+		"Draw calls",
+		"Drawn fragments"
+	} };
+
+	return names[static_cast<std::size_t>( counter ) % counter_count];
+}
+
+/// @cond
+
+Profiler::Scope::Scope( Phase phase ) :
+	m_active( enabled )
+{
+	if( !m_active ) {
+		return;
+	}
+
+	auto now = std::chrono::steady_clock::now();
+
+	// Pause the enclosing scope.
+	if( !active_scopes.empty() ) {
+		AddTime( active_scopes.back(), now );
+	}
+
+	active_scopes.push_back( { phase, now } );
+}
+
+Profiler::Scope::~Scope() {
+	if( !m_active ) {
+		return;
+	}
+
+	auto now = std::chrono::steady_clock::now();
+
+	AddTime( active_scopes.back(), now );
+	active_scopes.pop_back();
+
+	// Resume the enclosing scope.
+	if( !active_scopes.empty() ) {
+		active_scopes.back().resumed = now;
+	}
+}
+
+void Profiler::Count( Counter counter, std::uint64_t amount ) {
+	if( !enabled ) {
+		return;
+	}
+
+	counters[static_cast<std::size_t>( counter )] += amount;
+}
+
+/// @endcond
+
+}
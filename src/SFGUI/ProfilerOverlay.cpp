@@ -0,0 +1,81 @@
+#include <SFGUI/ProfilerOverlay.hpp>
+#include <SFGUI/Profiler.hpp>
+
+#include <iomanip>
+#include <sstream>
+
+namespace sfg {
+
+ProfilerOverlay::ProfilerOverlay( float interval ) :
+	m_interval( interval ),
+	m_elapsed_time( 0.f )
+{
+	SetAlignment( sf::Vector2f( 0.f, 0.f ) );
+}
+
+ProfilerOverlay::Ptr ProfilerOverlay::Create( float interval ) {
+	Ptr overlay( new ProfilerOverlay( interval ) );
+	overlay->UpdateText();
+	return overlay;
+}
+
+const std::string& ProfilerOverlay::GetName() const {
+	static const std::string name( "ProfilerOverlay" );
+	return name;
+}
+
+void ProfilerOverlay::SetInterval( float interval ) {
+	m_interval = interval;
+}
+
+float ProfilerOverlay::GetInterval() const {
+	return m_interval;
+}
+
+void ProfilerOverlay::HandleUpdate( float seconds ) {
+	m_elapsed_time += seconds;
+
+	if( m_elapsed_time < m_interval ) {
+		return;
+	}
+
+	m_elapsed_time = 0.f;
+
+	UpdateText();
+}
+
+void ProfilerOverlay::UpdateText() {
+	if( !Profiler::IsAvailable() ) {
+		SetText( "Profiler not available, build SFGUI with SFGUI_ENABLE_PROFILER." );
+		return;
+	}
+
+	if( !Profiler::IsEnabled() ) {
+		SetText( "Profiler disabled." );
+		return;
+	}
+
+	auto frame = Profiler::GetAverage();
+
+	std::ostringstream stream;
+	stream << std::fixed << std::setprecision( 1 );
+
+	stream << "Average of " << Profiler::GetHistory().size() << " frames\n";
+
+	for( auto phase = 0; phase < static_cast<int>( Profiler::Phase::COUNT ); ++phase ) {
+		stream << Profiler::GetPhaseName( static_cast<Profiler::Phase>( phase ) ) << ": " << frame.GetTiming( static_cast<Profiler::Phase>( phase ) ) << " us\n";
+	}
+
+	stream << "Total: " << frame.GetTotalTiming() << " us\n";
+
+	for( auto counter = 0; counter < static_cast<int>( Profiler::Counter::COUNT ); ++counter ) {
+		stream << Profiler::GetCounterName( static_cast<Profiler::Counter>( counter ) ) << ": " << frame.GetCount( static_cast<Profiler::Counter>( counter ) ) << "\n";
+	}
+
+	auto text = stream.str();
+	text.pop_back();
+
+	SetText( text );
+}
+
+}
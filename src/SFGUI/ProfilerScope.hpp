@@ -0,0 +1,14 @@
+#pragma once
+
+#include <SFGUI/Profiler.hpp>
+
+// Instrumentation is compiled out unless SFGUI is built with the profiler.
+#if defined( SFGUI_PROFILER )
+	#define SFGUI_PROFILE_SCOPE( phase ) sfg::Profiler::Scope sfgui_profiler_scope( sfg::Profiler::Phase::phase )
+	#define SFGUI_PROFILE_COUNT( counter, amount ) sfg::Profiler::Count( sfg::Profiler::Counter::counter, static_cast<std::uint64_t>( amount ) )
+	#define SFGUI_PROFILE_END_FRAME() sfg::Profiler::EndFrame()
+#else
+	#define SFGUI_PROFILE_SCOPE( phase )
+	#define SFGUI_PROFILE_COUNT( counter, amount )
+	#define SFGUI_PROFILE_END_FRAME()
+#endif
@@ -37,10 +37,18 @@ sf::Vector2f ProgressBar::CalculateRequisition() {
 	return sf::Vector2f( 10.f, 20.f );
 }
 
+bool ProgressBar::CanMeasureConcurrently() const {
+	return true;
+}
+
 std::unique_ptr<RenderQueue> ProgressBar::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateProgressBarDrawable( std::dynamic_pointer_cast<const ProgressBar>( shared_from_this() ) );
 }
 
+bool ProgressBar::CanInvalidateConcurrently() const {
+	return true;
+}
+
 void ProgressBar::SetOrientation( Orientation orientation ) {
 	m_orientation = orientation;
 	RequestResize();
@@ -1,5 +1,6 @@
 #include <SFGUI/RenderQueue.hpp>
 #include <SFGUI/RendererViewport.hpp>
+#include <SFGUI/RendererTransform.hpp>
 #include <SFGUI/Renderer.hpp>
 #include <SFGUI/Primitive.hpp>
 
@@ -17,6 +18,7 @@ RenderQueue::RenderQueue() :
 	m_show( true )
 {
 	m_viewport = Renderer::Get().GetDefaultViewport();
+	m_transform = Renderer::Get().GetDefaultTransform();
 }
 
 RenderQueue::~RenderQueue() {
@@ -40,6 +42,7 @@ void RenderQueue::Add( Primitive::Ptr primitive ) {
 	primitive->SetLevel( m_level );
 	primitive->SetPosition( m_position );
 	primitive->SetViewport( m_viewport );
+	primitive->SetTransform( m_transform );
 	primitive->SetVisible( m_show );
 
 	Renderer::Get().Invalidate( sfg::Renderer::INVALIDATE_ALL );
@@ -115,4 +118,18 @@ RendererViewport::Ptr RenderQueue::GetViewport() const {
 	return m_viewport;
 }
 
+void RenderQueue::SetTransform( RendererTransform::Ptr transform ) {
+	m_transform = transform;
+
+	for( const auto& primitive : m_primitives ) {
+		primitive->SetTransform( m_transform );
+	}
+
+	Renderer::Get().Invalidate( sfg::Renderer::INVALIDATE_ALL );
+}
+
+RendererTransform::Ptr RenderQueue::GetTransform() const {
+	return m_transform;
+}
+
 }
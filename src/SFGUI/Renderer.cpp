@@ -5,9 +5,13 @@
 #include <SFGUI/RendererBatch.hpp>
 #include <SFGUI/RendererTextureNode.hpp>
 #include <SFGUI/RendererViewport.hpp>
+#include <SFGUI/RendererTransform.hpp>
 #include <SFGUI/Primitive.hpp>
 #include <SFGUI/PrimitiveTexture.hpp>
 #include <SFGUI/PrimitiveVertex.hpp>
+#include <SFGUI/PrimitiveInstance.hpp>
+#include <SFGUI/DistanceFieldFont.hpp>
+#include <SFGUI/ProfilerScope.hpp>
 
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/Image.hpp>
@@ -25,6 +29,61 @@ namespace {
 std::shared_ptr<sfg::Renderer> instance;
 int max_texture_size = 0;
 
+void* GetFontFace( const sf::Font& font ) {
+	// Get the font face that Laurent tries to hide from us.
+	struct FontStruct {
+		void* library;
+		void* font_face; // Authentic SFML comment: implementation details
+		void* unused1;
+		void* unused2;
+		int* unused3;
+		std::string family;
+
+		// Since maps allocate everything non-contiguously on the heap we can use void* instead of Page here.
+		mutable std::map<unsigned int, void*> unused4;
+		mutable std::vector<std::uint8_t> unused5;
+	};
+
+	// All your font face are belong to us too.
+	return reinterpret_cast<const FontStruct&>( font ).font_face;
+}
+
+bool SamplesPseudoTexture( const sf::FloatRect& texture_rect, const sfg::PrimitiveTexture& pseudo_texture ) {
+	return ( texture_rect.position.x >= pseudo_texture.offset.x ) &&
+	       ( texture_rect.position.y >= pseudo_texture.offset.y ) &&
+	       ( texture_rect.position.x + texture_rect.size.x <= pseudo_texture.offset.x + static_cast<float>( pseudo_texture.size.x ) ) &&
+	       ( texture_rect.position.y + texture_rect.size.y <= pseudo_texture.offset.y + static_cast<float>( pseudo_texture.size.y ) );
+}
+
+// Only untextured geometry with fully opaque colors is considered
+// opaque, texture contents aren't inspected.
+bool IsOpaque( sfg::Primitive& primitive, const sfg::PrimitiveTexture& pseudo_texture ) {
+	const auto& vertices = primitive.GetVertices();
+	const auto& instances = primitive.GetInstances();
+
+	if( primitive.GetCustomDrawCallback() || ( vertices.empty() && instances.empty() ) ) {
+		return false;
+	}
+
+	for( const auto& vertex : vertices ) {
+		if( ( vertex.color.a != 255 ) || !SamplesPseudoTexture( sf::FloatRect( vertex.texture_coordinate, { 0.f, 0.f } ), pseudo_texture ) ) {
+			return false;
+		}
+	}
+
+	for( const auto& instance : instances ) {
+		if( ( instance.color.a != 255 ) || instance.distance_field || !SamplesPseudoTexture( instance.texture_rect, pseudo_texture ) ) {
+			return false;
+		}
+
+		if( ( instance.border_width > 0.f ) && ( ( instance.light_border_color.a != 255 ) || ( instance.dark_border_color.a != 255 ) ) ) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 }
 
 namespace sfg {
@@ -33,6 +92,9 @@ Renderer::Renderer() :
 	m_vertex_count( 0 ),
 	m_index_count( 0 ),
 	m_force_redraw( false ),
+	m_deferred_datasets( 0 ),
+	m_defer_primitives( false ),
+	m_keep_atlas_images( false ),
 	m_primitives_sorted( false ) {
 	static auto checked_max_texture_size = false;
 
@@ -46,6 +108,7 @@ Renderer::Renderer() :
 	}
 
 	m_default_viewport = CreateViewport();
+	m_default_transform = CreateTransform();
 
 	// Load our "no texture" pseudo-texture.
 	sf::Image pseudo_image;
@@ -105,7 +168,22 @@ RendererViewport::Ptr Renderer::CreateViewport() {
 	return std::make_shared<RendererViewport>();
 }
 
+RendererTransform::Ptr Renderer::GetDefaultTransform() {
+	return m_default_transform;
+}
+
+RendererTransform::Ptr Renderer::CreateTransform() {
+	return std::make_shared<RendererTransform>();
+}
+
 Primitive::Ptr Renderer::CreateText( const sf::Text& text ) {
+	if( UsesDistanceFieldText() ) {
+		return CreateDistanceFieldText( text );
+	}
+
+	// Glyphs are loaded on demand, fonts can't be shared between threads.
+	std::lock_guard<std::recursive_mutex> lock( Engine::GetFontMutex() );
+
 	const auto& font = text.getFont();
 	auto character_size = text.getCharacterSize();
 	auto color = text.getFillColor();
@@ -195,6 +273,85 @@ Primitive::Ptr Renderer::CreateText( const sf::Text& text ) {
 	return primitive;
 }
 
+Primitive::Ptr Renderer::CreateDistanceFieldText( const sf::Text& text ) {
+	std::lock_guard<std::recursive_mutex> lock( Engine::GetFontMutex() );
+
+	const auto& font = text.getFont();
+	auto character_size = text.getCharacterSize();
+	auto color = text.getFillColor();
+
+	const auto& distance_field_font = LoadDistanceFieldFont( font );
+	auto atlas_offset = distance_field_font.GetTexture()->offset;
+
+	// Glyph metrics are scaled from the reference size.
+	auto scale = static_cast<float>( character_size ) / static_cast<float>( priv::DistanceFieldFont::reference_size );
+
+	const auto& str = text.getString();
+
+	auto space_glyph = distance_field_font.GetGlyph( L' ' );
+	auto horizontal_spacing = space_glyph ? space_glyph->advance * scale : static_cast<float>( character_size ) / 2.f;
+	auto vertical_spacing = static_cast<float>( Context::Get().GetEngine().GetFontLineHeight( font, character_size ) );
+	sf::Vector2f start_position( std::floor( text.getPosition().x + .5f ), std::floor( text.getPosition().y + static_cast<float>( character_size ) + .5f ) );
+
+	sf::Vector2f position( start_position );
+
+	const static auto tab_spaces = 2.f;
+
+	std::uint32_t previous_character = 0;
+
+	auto primitive = std::make_shared<Primitive>();
+
+	PrimitiveInstance instance;
+
+	instance.color = color;
+	instance.distance_field = true;
+
+	for( const auto& current_character : str ) {
+		// Kerning is scaled from the reference size just like the advances.
+		position.x += static_cast<float>( font.getKerning( previous_character, current_character, priv::DistanceFieldFont::reference_size ) ) * scale;
+
+		switch( current_character ) {
+			case L' ':
+				position.x += horizontal_spacing;
+				continue;
+			case L'\t':
+				position.x += horizontal_spacing * tab_spaces;
+				continue;
+			case L'\n':
+				position.y += vertical_spacing;
+				position.x = start_position.x;
+				continue;
+			case L'\v':
+				position.y += vertical_spacing * tab_spaces;
+				continue;
+			default:
+				break;
+		}
+
+		const auto glyph = distance_field_font.GetGlyph( current_character );
+
+		if( !glyph ) {
+			previous_character = current_character;
+			continue;
+		}
+
+		if( glyph->texture_rect.size.x > 0.f ) {
+			instance.rect = sf::FloatRect( position + glyph->bounds.position * scale, glyph->bounds.size * scale );
+			instance.texture_rect = sf::FloatRect( atlas_offset + glyph->texture_rect.position, glyph->texture_rect.size );
+
+			primitive->AddInstance( instance );
+		}
+
+		position.x += glyph->advance * scale;
+
+		previous_character = current_character;
+	}
+
+	AddPrimitive( primitive );
+
+	return primitive;
+}
+
 Primitive::Ptr Renderer::CreateQuad( const sf::Vector2f& top_left, const sf::Vector2f& bottom_left,
                                      const sf::Vector2f& bottom_right, const sf::Vector2f& top_right,
                                      const sf::Color& color ) {
@@ -238,121 +395,29 @@ Primitive::Ptr Renderer::CreatePane( const sf::Vector2f& position, const sf::Vec
 		return CreateRect( position, position + size, color );
 	}
 
-	auto primitive = std::make_shared<Primitive>( 20 );
-
 	sf::Color dark_border( border_color );
 	sf::Color light_border( border_color );
 
 	Context::Get().GetEngine().ShiftBorderColors( light_border, dark_border, border_color_shift );
 
-	auto left = position.x;
-	auto top = position.y;
-	auto right = left + size.x;
-	auto bottom = top + size.y;
+	PrimitiveInstance instance;
 
-	auto add_quad = [&primitive]( const sf::Vector2f& top_left, const sf::Vector2f& bottom_left,
-                                  const sf::Vector2f& bottom_right, const sf::Vector2f& top_right,
-                                  const sf::Color& quad_color ) {
-		PrimitiveVertex vertex0;
-		PrimitiveVertex vertex1;
-		PrimitiveVertex vertex2;
-		PrimitiveVertex vertex3;
-
-		vertex0.position = sf::Vector2f( std::floor( top_left.x + .5f ), std::floor( top_left.y + .5f ) );
-		vertex1.position = sf::Vector2f( std::floor( bottom_left.x + .5f ), std::floor( bottom_left.y + .5f ) );
-		vertex2.position = sf::Vector2f( std::floor( top_right.x + .5f ), std::floor( top_right.y + .5f ) );
-		vertex3.position = sf::Vector2f( std::floor( bottom_right.x + .5f ), std::floor( bottom_right.y + .5f ) );
-
-		vertex0.color = quad_color;
-		vertex1.color = quad_color;
-		vertex2.color = quad_color;
-		vertex3.color = quad_color;
-
-		vertex0.texture_coordinate = sf::Vector2f( 0.f, 0.f );
-		vertex1.texture_coordinate = sf::Vector2f( 0.f, 1.f );
-		vertex2.texture_coordinate = sf::Vector2f( 1.f, 0.f );
-		vertex3.texture_coordinate = sf::Vector2f( 1.f, 1.f );
-
-		primitive->AddVertex( vertex0 );
-		primitive->AddVertex( vertex1 );
-		primitive->AddVertex( vertex2 );
-		primitive->AddVertex( vertex2 );
-		primitive->AddVertex( vertex1 );
-		primitive->AddVertex( vertex3 );
-	};
-
-	auto add_line = [&add_quad]( const sf::Vector2f& begin, const sf::Vector2f& end, const sf::Color& line_color, float thickness ) {
-		sf::Vector2f normal( end - begin );
-		sf::Vector2f unrotated_normal( normal );
-		std::swap( normal.x, normal.y );
-		auto length = std::sqrt( normal.x * normal.x + normal.y * normal.y );
-
-		if( !( length > 0.f ) ) {
-			return;
-		}
-
-		normal.x /= -length;
-		normal.y /= length;
-		unrotated_normal.x /= length;
-		unrotated_normal.y /= length;
-
-		sf::Vector2f corner0( begin + normal * ( thickness * .5f ) - unrotated_normal * ( thickness * .5f ) );
-		sf::Vector2f corner1( begin - normal * ( thickness * .5f ) - unrotated_normal * ( thickness * .5f ) );
-		sf::Vector2f corner2( end - normal * ( thickness * .5f ) + unrotated_normal * ( thickness * .5f ) );
-		sf::Vector2f corner3( end + normal * ( thickness * .5f ) + unrotated_normal * ( thickness * .5f ) );
-
-		add_quad( corner3, corner2, corner1, corner0, line_color );
-	};
-
-	add_quad(
-		sf::Vector2f( left + border_width, top + border_width ),
-		sf::Vector2f( left + border_width, bottom - border_width ),
-		sf::Vector2f( right - border_width, bottom - border_width ),
-		sf::Vector2f( right - border_width, top + border_width ),
-		color
-	);
-
-	add_line(
-		sf::Vector2f( left + border_width / 2.f, top + border_width / 2.f ),
-		sf::Vector2f( right - border_width / 2.f, top + border_width / 2.f ),
-		light_border,
-		border_width
-	);
-
-	add_line(
-		sf::Vector2f( right - border_width / 2.f, top + border_width / 2.f ),
-		sf::Vector2f( right - border_width / 2.f, bottom - border_width / 2.f ),
-		dark_border,
-		border_width
-	);
-
-	add_line(
-		sf::Vector2f( right - border_width / 2.f, bottom - border_width / 2.f ),
-		sf::Vector2f( left + border_width / 2.f, bottom - border_width / 2.f ),
-		dark_border,
-		border_width
-	);
-
-	add_line(
-		sf::Vector2f( left + border_width / 2.f, bottom - border_width / 2.f ),
-		sf::Vector2f( left + border_width / 2.f, top + border_width / 2.f ),
-		light_border,
-		border_width
-	);
-
-	AddPrimitive( primitive );
+	instance.rect = sf::FloatRect( position, size );
+	instance.color = color;
+	instance.light_border_color = light_border;
+	instance.dark_border_color = dark_border;
+	instance.border_width = border_width;
 
-	return primitive;
+	return CreateInstance( instance, nullptr );
 }
 
 Primitive::Ptr Renderer::CreateRect( const sf::Vector2f& top_left, const sf::Vector2f& bottom_right, const sf::Color& color ) {
-	return CreateQuad(
-		sf::Vector2f( top_left.x, top_left.y ),
-		sf::Vector2f( top_left.x, bottom_right.y ),
-		sf::Vector2f( bottom_right.x, bottom_right.y ),
-		sf::Vector2f( bottom_right.x, top_left.y ),
-		color
-	);
+	PrimitiveInstance instance;
+
+	instance.rect = sf::FloatRect( top_left, bottom_right - top_left );
+	instance.color = color;
+
+	return CreateInstance( instance, nullptr );
 }
 
 Primitive::Ptr Renderer::CreateRect( const sf::FloatRect& rect, const sf::Color& color ) {
@@ -390,6 +455,25 @@ Primitive::Ptr Renderer::CreateTriangle( const sf::Vector2f& point0, const sf::V
 Primitive::Ptr Renderer::CreateSprite( const sf::FloatRect& rect, PrimitiveTexture::Ptr texture, const sf::FloatRect& subrect, int rotation_turns ) {
 	auto offset = texture->offset;
 
+	// Unrotated sprites are axis aligned rects in texture space as well.
+	if( !( rotation_turns % 4 ) ) {
+		PrimitiveInstance instance;
+
+		instance.rect.position = sf::Vector2f( std::floor( rect.position.x + .5f ), std::floor( rect.position.y + .5f ) );
+		instance.rect.size = sf::Vector2f( std::floor( rect.size.x + .5f ), std::floor( rect.size.y + .5f ) );
+
+		if( ( subrect.position.x != 0.f ) || ( subrect.position.y != 0.f ) || ( subrect.size.x != 0.f ) || ( subrect.size.y != 0.f ) ) {
+			instance.texture_rect.position = offset + sf::Vector2f( std::floor( subrect.position.x + .5f ), std::floor( subrect.position.y + .5f ) );
+			instance.texture_rect.size = sf::Vector2f( std::floor( subrect.size.x + .5f ), std::floor( subrect.size.y + .5f ) );
+		}
+		else {
+			instance.texture_rect.position = offset;
+			instance.texture_rect.size = sf::Vector2f( texture->size );
+		}
+
+		return CreateInstance( instance, texture );
+	}
+
 	auto primitive = std::make_shared<Primitive>( 4 );
 
 	PrimitiveVertex vertex0;
@@ -485,6 +569,24 @@ Primitive::Ptr Renderer::CreateGLCanvas( std::shared_ptr<Signal> callback ) {
 	return primitive;
 }
 
+Primitive::Ptr Renderer::CreateInstance( const PrimitiveInstance& instance, PrimitiveTexture::Ptr texture ) {
+	auto primitive = std::make_shared<Primitive>();
+
+	primitive->AddInstance( instance );
+
+	if( texture ) {
+		primitive->AddTexture( texture );
+	}
+
+	if( !UsesInstancing() ) {
+		primitive->ExpandInstances();
+	}
+
+	AddPrimitive( primitive );
+
+	return primitive;
+}
+
 void Renderer::WipeStateCache( sf::RenderTarget& target ) const {
 	// Make SFML disable it's **************** vertex cache without us
 	// having to call ResetGLStates() and disturbing OpenGL needlessly.
@@ -528,24 +630,9 @@ void Renderer::WipeStateCache( sf::RenderTarget& target ) const {
 /// @cond
 
 sf::Vector2f Renderer::LoadFont( const sf::Font& font, unsigned int size ) {
-	// Get the font face that Laurent tries to hide from us.
-	struct FontStruct {
-		void* library;
-		void* font_face; // Authentic SFML comment: implementation details
-		void* unused1;
-		void* unused2;
-		int* unused3;
-		std::string family;
+	std::lock_guard<std::recursive_mutex> lock( Engine::GetFontMutex() );
 
-		// Since maps allocate everything non-contiguously on the heap we can use void* instead of Page here.
-		mutable std::map<unsigned int, void*> unused4;
-		mutable std::vector<std::uint8_t> unused5;
-	};
-
-	// All your font face are belong to us too.
-	void* face = reinterpret_cast<const FontStruct&>( font ).font_face;
-
-	FontID id( face, size );
+	FontID id( GetFontFace( font ), size );
 
 	std::map<FontID, PrimitiveTexture::Ptr >::iterator iter( m_fonts.find( id ) );
 
@@ -553,6 +640,12 @@ sf::Vector2f Renderer::LoadFont( const sf::Font& font, unsigned int size ) {
 		return iter->second->offset;
 	}
 
+#if defined( SFGUI_DEBUG )
+	if( m_defer_primitives ) {
+		std::cerr << "SFGUI warning: Font loaded while primitives are deferred, it should have been preloaded.\n";
+	}
+#endif
+
 	// If the user does not specify their own character sets, make sure all the glyphs we need are loaded.
 	if( m_character_sets.empty() ) {
 		for( std::uint32_t codepoint = 0; codepoint < 0x0370; ++codepoint ) {
@@ -567,33 +660,96 @@ sf::Vector2f Renderer::LoadFont( const sf::Font& font, unsigned int size ) {
 		}
 	}
 
-	const auto image = font.getTexture( size ).copyToImage();
-
-	const auto handle = LoadTexture( image );
+	const auto handle = LoadTexture( font.getTexture( size ) );
 
 	m_fonts[id] = handle;
 
 	return handle->offset;
 }
 
+void Renderer::PreloadFont( const sf::Font& font, unsigned int size ) {
+	if( UsesDistanceFieldText() ) {
+		LoadDistanceFieldFont( font );
+		return;
+	}
+
+	LoadFont( font, size );
+}
+
+const priv::DistanceFieldFont& Renderer::LoadDistanceFieldFont( const sf::Font& font ) {
+	std::lock_guard<std::recursive_mutex> lock( Engine::GetFontMutex() );
+
+	// All character sizes share the glyphs of the face.
+	auto& distance_field_font = m_distance_field_fonts[GetFontFace( font )];
+
+	if( !distance_field_font ) {
+		distance_field_font = std::make_shared<priv::DistanceFieldFont>( font, m_character_sets );
+		distance_field_font->SetTexture( LoadTexture( distance_field_font->GetImage() ) );
+	}
+
+	return *distance_field_font;
+}
+
 PrimitiveTexture::Ptr Renderer::LoadTexture( const sf::Texture& texture ) {
-	return LoadTexture( texture.copyToImage() );
+	// Renderers sampling the atlas on the CPU need the pixels anyway.
+	if( m_keep_atlas_images ) {
+		return LoadTexture( texture.copyToImage() );
+	}
+
+	auto handle = AllocateTexture( texture.getSize() );
+
+	if( !handle ) {
+		return std::make_shared<PrimitiveTexture>();
+	}
+
+	auto offset = static_cast<int>( std::floor( handle->offset.y + .5f ) );
+	auto page = static_cast<std::size_t>( offset / max_texture_size );
+
+	// Copied on the GPU with a framebuffer blit, the
+	// texture never has to be downloaded into an image.
+	m_texture_atlas[page]->update( texture, { 0u, static_cast<unsigned int>( offset % max_texture_size ) } );
+
+	++m_atlas_page_revisions[page];
+
+	return handle;
 }
 
 PrimitiveTexture::Ptr Renderer::LoadTexture( const sf::Image& image ) {
+	auto handle = AllocateTexture( image.getSize() );
+
+	if( !handle ) {
+		return std::make_shared<PrimitiveTexture>();
+	}
+
+	auto offset = static_cast<int>( std::floor( handle->offset.y + .5f ) );
+	auto page = static_cast<std::size_t>( offset / max_texture_size );
+	auto position = sf::Vector2u( 0u, static_cast<unsigned int>( offset % max_texture_size ) );
+
+	m_texture_atlas[page]->update( image, position );
+
+	if( m_keep_atlas_images ) {
+		(void)m_atlas_images[page].copy( image, position );
+	}
+
+	++m_atlas_page_revisions[page];
+
+	return handle;
+}
+
+PrimitiveTexture::Ptr Renderer::AllocateTexture( const sf::Vector2u& size ) {
 	// We insert padding between atlas elements to prevent
 	// texture filtering from screwing up our images.
 	// If 1 pixel isn't enough, increase.
 	const static auto padding = 1;
 
-	auto required_vertical_size = static_cast<int>( image.getSize().y ) + padding;
-	auto required_horizontal_size = static_cast<int>( image.getSize().x );
+	auto required_vertical_size = static_cast<int>( size.y ) + padding;
+	auto required_horizontal_size = static_cast<int>( size.x );
 
 	if( ( required_horizontal_size > max_texture_size ) || ( required_vertical_size > static_cast<int>( max_texture_size ) ) ) {
 #if defined( SFGUI_DEBUG )
 		std::cerr << "SFGUI warning: The image you are using is larger than the maximum size supported by your GPU (" << max_texture_size << "x" << max_texture_size << ").\n";
 #endif
-		return std::make_shared<PrimitiveTexture>();
+		return nullptr;
 	}
 
 	// Look for a nice insertion point for our new texture.
@@ -617,10 +773,6 @@ PrimitiveTexture::Ptr Renderer::LoadTexture( const sf::Image& image ) {
 	auto current_page_index = atlas_last_occupied_location / max_texture_size;
 	auto current_page_last_occupied_location = atlas_last_occupied_location % max_texture_size;
 
-	// Cache the "temporary" sf::Image so its internal std::vector
-	// does not have to constantly be allocated anew.
-	static sf::Image new_image;
-
 	if( m_texture_atlas.empty() || ( current_page_last_occupied_location + required_vertical_size > max_texture_size ) ) {
 		// We need a new atlas page.
 
@@ -639,18 +791,20 @@ PrimitiveTexture::Ptr Renderer::LoadTexture( const sf::Image& image ) {
 		if( !create_maximal && !m_texture_atlas.empty() ) {
 			// Make sure the current page vertical size is maximal
 			// so we can compute the right page from y texture coordinate.
-			auto current_page = m_texture_atlas[static_cast<std::size_t>( current_page_index )].get();
-			auto old_image = current_page->copyToImage();
+			auto current_page_size = m_texture_atlas[static_cast<std::size_t>( current_page_index )]->getSize();
 
-			new_image.resize( { old_image.getSize().x, static_cast<unsigned int>( max_texture_size ) }, sf::Color::White );
-			(void)new_image.copy( old_image, { 0u, 0u } );
-			(void)new_image.copy( image, { 0u, static_cast<unsigned int>( current_page_last_occupied_location ) } );
+			if( !ResizeAtlasPage( static_cast<std::size_t>( current_page_index ), { current_page_size.x, static_cast<unsigned int>( max_texture_size ) } ) ) {
+				return nullptr;
+			}
+		}
 
-			(void)current_page->loadFromImage( new_image );
+		if( m_keep_atlas_images ) {
+			m_atlas_images.emplace_back( new_texture->getSize(), sf::Color::White );
 		}
 
 		// Insert the new page.
 		m_texture_atlas.push_back( std::move( new_texture ) );
+		m_atlas_page_revisions.push_back( 0 );
 
 		current_page_index = static_cast<int>( m_texture_atlas.size() ) - 1;
 		current_page_last_occupied_location = 0;
@@ -662,17 +816,11 @@ PrimitiveTexture::Ptr Renderer::LoadTexture( const sf::Image& image ) {
 
 	if( ( required_horizontal_size > current_page_size_x ) || ( current_page_last_occupied_location + required_vertical_size > current_page_size_y ) ) {
 		// Image is loaded into atlas after expanding texture atlas.
-		auto old_image = current_page->copyToImage();
-
-		new_image.resize( { static_cast<unsigned int>( std::max( current_page_size_x, required_horizontal_size ) ), static_cast<unsigned int>( std::max( current_page_size_y, current_page_last_occupied_location + required_vertical_size ) ) }, sf::Color::White );
-		(void)new_image.copy( old_image, { 0u, 0u } );
-		(void)new_image.copy( image, { 0u, static_cast<unsigned int>( current_page_last_occupied_location ) } );
+		auto new_size = sf::Vector2i( std::max( current_page_size_x, required_horizontal_size ), std::max( current_page_size_y, current_page_last_occupied_location + required_vertical_size ) );
 
-		(void)current_page->loadFromImage( new_image );
-	}
-	else {
-		// Image is loaded into atlas.
-		current_page->update( image, { 0u, static_cast<unsigned int>( current_page_last_occupied_location ) } );
+		if( !ResizeAtlasPage( static_cast<std::size_t>( current_page_index ), static_cast<sf::Vector2u>( new_size ) ) ) {
+			return nullptr;
+		}
 	}
 
 	auto offset = sf::Vector2i( 0, current_page_index * max_texture_size + current_page_last_occupied_location );
@@ -682,21 +830,52 @@ PrimitiveTexture::Ptr Renderer::LoadTexture( const sf::Image& image ) {
 	auto handle = std::make_shared<PrimitiveTexture>();
 
 	handle->offset = static_cast<sf::Vector2f>( offset );
-	handle->size = image.getSize();
+	handle->size = size;
 
 	priv::RendererTextureNode texture_node;
 	texture_node.offset = offset;
-	texture_node.size = static_cast<sf::Vector2i>( image.getSize() ) + sf::Vector2i( 0, padding );
+	texture_node.size = static_cast<sf::Vector2i>( size ) + sf::Vector2i( 0, padding );
 
 	m_textures.insert( texture_iter, texture_node );
 
 	return handle;
 }
 
+bool Renderer::ResizeAtlasPage( std::size_t page, const sf::Vector2u& size ) {
+	auto new_texture = std::unique_ptr<sf::Texture>( new sf::Texture );
+
+	if( !new_texture->resize( size ) ) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "SFGUI warning: Failed to resize texture atlas page to " << size.x << "x" << size.y << ".\n";
+#endif
+		return false;
+	}
+
+	// The old contents are blitted into the new page on the GPU instead
+	// of being downloaded and uploaded again. The rest of the page is left
+	// undefined, it is never sampled until an image is loaded into it.
+	new_texture->update( *m_texture_atlas[page], { 0u, 0u } );
+
+	m_texture_atlas[page] = std::move( new_texture );
+
+	if( m_keep_atlas_images ) {
+		sf::Image new_image( size, sf::Color::White );
+		(void)new_image.copy( m_atlas_images[page], { 0u, 0u } );
+
+		m_atlas_images[page] = std::move( new_image );
+	}
+
+	++m_atlas_page_revisions[page];
+
+	return true;
+}
+
 void Renderer::UnloadImage( const sf::Vector2f& offset ) {
 	sf::Vector2i int_offset( static_cast<int>( std::floor( offset.x + .5f ) ), static_cast<int>( std::floor( offset.y + .5f ) ) );
 	for( auto iter = m_textures.begin(); iter != m_textures.end(); ++iter ) {
 		if( iter->offset == int_offset ) {
+			DiscardAtlasPageUpdates( static_cast<std::size_t>( int_offset.y / max_texture_size ), { 0u, static_cast<unsigned int>( int_offset.y % max_texture_size ) } );
+
 			m_textures.erase( iter );
 			return;
 		}
@@ -728,7 +907,13 @@ void Renderer::UpdateImage( const sf::Vector2f& offset, const sf::Image& data )
 
 			auto page = static_cast<std::size_t>( int_offset.y / max_texture_size );
 
-			m_texture_atlas[page]->update( data, { 0u, static_cast<unsigned int>( int_offset.y % max_texture_size ) } );
+			UpdateAtlasPage( page, { 0u, static_cast<unsigned int>( int_offset.y % max_texture_size ) }, data );
+
+			if( m_keep_atlas_images ) {
+				(void)m_atlas_images[page].copy( data, { 0u, static_cast<unsigned int>( int_offset.y % max_texture_size ) } );
+			}
+
+			++m_atlas_page_revisions[page];
 
 			return;
 		}
@@ -747,6 +932,8 @@ void Renderer::SortPrimitives() {
 		return;
 	}
 
+	SFGUI_PROFILE_SCOPE( SORT_PRIMITIVES );
+
 	std::size_t current_position = 1;
 	std::size_t sort_index;
 
@@ -765,11 +952,25 @@ void Renderer::SortPrimitives() {
 	m_primitives_sorted = true;
 }
 
+void Renderer::ClassifyOpacity( Primitive& primitive ) const {
+	// Renderers can draw opaque primitives front to back and
+	// skip whatever they hide.
+	primitive.SetOpaque( IsOpaque( primitive, *m_pseudo_texture ) );
+}
+
 void Renderer::AddPrimitive( Primitive::Ptr primitive ) {
+	if( m_defer_primitives ) {
+		std::lock_guard<std::mutex> lock( m_deferred_primitives_mutex );
+		m_deferred_primitives.push_back( primitive );
+		return;
+	}
+
 	m_primitives.push_back( primitive );
 
-	// Check for alpha values in primitive.
-	// Disable depth test if any found.
+	SFGUI_PROFILE_COUNT( CREATED_PRIMITIVES, 1 );
+
+	ClassifyOpacity( *primitive );
+
 	const std::vector<PrimitiveVertex>& vertices( primitive->GetVertices() );
 	const std::vector<unsigned int>& indices( primitive->GetIndices() );
 
@@ -782,6 +983,17 @@ void Renderer::AddPrimitive( Primitive::Ptr primitive ) {
 }
 
 void Renderer::RemovePrimitive( Primitive::Ptr primitive ) {
+	if( m_defer_primitives ) {
+		std::lock_guard<std::mutex> lock( m_deferred_primitives_mutex );
+
+		auto deferred_iter = std::find( m_deferred_primitives.begin(), m_deferred_primitives.end(), primitive );
+
+		if( deferred_iter != m_deferred_primitives.end() ) {
+			m_deferred_primitives.erase( deferred_iter );
+			return;
+		}
+	}
+
 	std::vector<Primitive::Ptr>::iterator iter( std::find( m_primitives.begin(), m_primitives.end(), primitive ) );
 
 	if( iter != m_primitives.end() ) {
@@ -795,12 +1007,41 @@ void Renderer::RemovePrimitive( Primitive::Ptr primitive ) {
 		m_index_count -= static_cast<int>( indices.size() );
 
 		m_primitives.erase( iter );
+
+		SFGUI_PROFILE_COUNT( DESTROYED_PRIMITIVES, 1 );
 	}
 
 	Invalidate( INVALIDATE_ALL );
 }
 
+void Renderer::DeferPrimitives() {
+	m_defer_primitives = true;
+}
+
+void Renderer::CommitPrimitives() {
+	m_defer_primitives = false;
+
+	for( const auto& primitive : m_deferred_primitives ) {
+		AddPrimitive( primitive );
+	}
+
+	m_deferred_primitives.clear();
+
+	auto datasets = m_deferred_datasets.exchange( 0 );
+
+	if( datasets ) {
+		Invalidate( datasets );
+	}
+}
+
 void Renderer::Invalidate( unsigned char datasets ) {
+	// Renderer state is only touched from the main thread,
+	// collect invalidations made while primitives are deferred.
+	if( m_defer_primitives ) {
+		m_deferred_datasets |= datasets;
+		return;
+	}
+
 	InvalidateImpl( datasets );
 }
 
@@ -823,6 +1064,35 @@ void Renderer::AddCharacterSet( std::uint32_t low_bound, std::uint32_t high_boun
 void Renderer::InvalidateImpl( unsigned char /*datasets*/ ) {
 }
 
+void Renderer::UpdateAtlasPage( std::size_t page, const sf::Vector2u& position, const sf::Image& data ) {
+	m_texture_atlas[page]->update( data, position );
+}
+
+void Renderer::DiscardAtlasPageUpdates( std::size_t /*page*/, const sf::Vector2u& /*position*/ ) {
+}
+
+void Renderer::KeepAtlasImages() {
+	if( m_keep_atlas_images ) {
+		return;
+	}
+
+	m_atlas_images.clear();
+
+	for( const auto& page : m_texture_atlas ) {
+		m_atlas_images.push_back( page->copyToImage() );
+	}
+
+	m_keep_atlas_images = true;
+}
+
+bool Renderer::UsesInstancing() const {
+	return false;
+}
+
+bool Renderer::UsesDistanceFieldText() const {
+	return false;
+}
+
 int Renderer::GetMaxTextureSize() const {
 	return max_texture_size;
 }
@@ -5,6 +5,9 @@
 namespace sfg {
 namespace priv {
 
+// Largest number of vertices a batch drawn with 16-bit indices can span.
+const int max_short_index_vertices = 65536;
+
 struct RendererBatch {
 	std::shared_ptr<RendererViewport> viewport;
 	std::shared_ptr<Signal> custom_draw_callback;
@@ -13,7 +16,11 @@ struct RendererBatch {
 	int index_count;
 	int min_index;
 	int max_index;
+	int base_vertex; // Vertex 16-bit indices of the batch are relative to.
+	int start_instance = 0; // First instance of the batch, batches hold either indices or instances.
+	int instance_count = 0;
 	bool custom_draw;
+	bool opaque = false; // Drawn with depth writes and without blending.
 };
 
 }
@@ -0,0 +1,176 @@
+#include <SFGUI/RendererBatchBuilder.hpp>
+#include <SFGUI/RendererTransform.hpp>
+
+namespace sfg {
+namespace priv {
+
+RendererBatchBuilder::RendererBatchBuilder( std::vector<RendererBatch>& batches, const std::vector<std::unique_ptr<sf::Texture>>& texture_atlas, int max_texture_size, std::shared_ptr<RendererViewport> default_viewport, const sf::Vector2i& window_size ) :
+	m_batches( batches ),
+	m_texture_atlas( texture_atlas ),
+	m_default_viewport( default_viewport ),
+	m_window_rect( { 0.f, 0.f }, sf::Vector2f( window_size ) ),
+	m_layer_size( 0, 0 ),
+	m_max_texture_size( max_texture_size ),
+	m_vertex_count( 0 ),
+	m_index_count( 0 ),
+	m_instance_count( 0 ),
+	m_cull( false ),
+	m_short_indices( false ),
+	m_layered( false )
+{
+	m_batches.clear();
+
+	// Default viewport
+	m_current_batch.viewport = m_default_viewport;
+	m_current_batch.atlas_page = 0;
+	m_current_batch.start_index = 0;
+	m_current_batch.index_count = 0;
+	m_current_batch.min_index = 0;
+	m_current_batch.max_index = 0;
+	m_current_batch.base_vertex = 0;
+	m_current_batch.start_instance = 0;
+	m_current_batch.instance_count = 0;
+	m_current_batch.custom_draw = false;
+}
+
+void RendererBatchBuilder::SetCull( bool enable ) {
+	m_cull = enable;
+}
+
+void RendererBatchBuilder::SetShortIndices( bool enable ) {
+	m_short_indices = enable;
+}
+
+void RendererBatchBuilder::SetLayerSize( const sf::Vector2u& layer_size ) {
+	m_layer_size = layer_size;
+	m_layered = true;
+}
+
+bool RendererBatchBuilder::Count( const std::vector<std::shared_ptr<Primitive>>& primitives, std::size_t& vertex_count, std::size_t& index_count ) {
+	auto short_indices = true;
+
+	vertex_count = 0;
+	index_count = 0;
+
+	for( const auto& primitive : primitives ) {
+		if( !primitive->IsVisible() || primitive->GetCustomDrawCallback() ) {
+			continue;
+		}
+
+		const auto primitive_vertices = primitive->GetVertices().size();
+
+		vertex_count += primitive_vertices;
+		index_count += primitive->GetIndices().size();
+
+		if( primitive_vertices > static_cast<std::size_t>( max_short_index_vertices ) ) {
+			short_indices = false;
+		}
+	}
+
+	return short_indices;
+}
+
+RendererBatchPlacement RendererBatchBuilder::Place( const Primitive& primitive ) const {
+	RendererBatchPlacement placement;
+
+	placement.viewport = primitive.GetViewport();
+	placement.offset = primitive.GetPosition();
+	placement.cull_rect = m_window_rect;
+
+	const auto& viewport = placement.viewport;
+
+	// Check if primitive needs to be rendered in a custom viewport.
+	if( viewport && ( ( *viewport ) != ( *m_default_viewport ) ) ) {
+		auto destination_origin = viewport->GetAbsoluteDestinationOrigin();
+
+		placement.offset += ( destination_origin - viewport->GetSourceOrigin() );
+		placement.cull_rect = { destination_origin, viewport->GetSize() };
+	}
+	else if( primitive.GetTransform() ) {
+		placement.offset += primitive.GetTransform()->GetOffset();
+	}
+
+	return placement;
+}
+
+void RendererBatchBuilder::AddCustomDraw( const Primitive& primitive ) {
+	// Start a new batch.
+	m_current_batch.max_index = m_vertex_count ? ( m_vertex_count - 1 ) : 0;
+	m_batches.push_back( m_current_batch );
+
+	// Mark current batch custom draw batch.
+	m_current_batch.viewport = primitive.GetViewport();
+	m_current_batch.start_index = 0;
+	m_current_batch.index_count = 0;
+	m_current_batch.min_index = 0;
+	m_current_batch.max_index = 0;
+	m_current_batch.base_vertex = 0;
+	m_current_batch.start_instance = 0;
+	m_current_batch.instance_count = 0;
+	m_current_batch.custom_draw = true;
+	m_current_batch.opaque = false;
+	m_current_batch.custom_draw_callback = primitive.GetCustomDrawCallback();
+
+	// Start a new batch.
+	m_batches.push_back( m_current_batch );
+
+	// Reset current batch to defaults.
+	m_current_batch.viewport = m_default_viewport;
+	m_current_batch.start_index = m_index_count;
+	m_current_batch.index_count = 0;
+	m_current_batch.min_index = m_vertex_count ? ( m_vertex_count - 1 ) : 0;
+	m_current_batch.base_vertex = m_vertex_count;
+	m_current_batch.start_instance = m_instance_count;
+	m_current_batch.custom_draw = false;
+	m_current_batch.custom_draw_callback.reset();
+}
+
+void RendererBatchBuilder::Finish() {
+	m_current_batch.max_index = m_vertex_count ? ( m_vertex_count - 1 ) : 0;
+	m_batches.push_back( m_current_batch );
+}
+
+int RendererBatchBuilder::GetVertexCount() const {
+	return m_vertex_count;
+}
+
+int RendererBatchBuilder::GetIndexCount() const {
+	return m_index_count;
+}
+
+int RendererBatchBuilder::GetInstanceCount() const {
+	return m_instance_count;
+}
+
+void RendererBatchBuilder::StartBatch( std::shared_ptr<RendererViewport> viewport, int atlas_page, bool opaque ) {
+	m_current_batch.max_index = m_vertex_count ? ( m_vertex_count - 1 ) : 0;
+	m_batches.push_back( m_current_batch );
+
+	// Reset current batch to defaults.
+	m_current_batch.viewport = viewport;
+	m_current_batch.opaque = opaque;
+	m_current_batch.atlas_page = atlas_page;
+	m_current_batch.start_index = m_index_count;
+	m_current_batch.index_count = 0;
+	m_current_batch.min_index = m_vertex_count ? ( m_vertex_count - 1 ) : 0;
+	m_current_batch.base_vertex = m_vertex_count;
+	m_current_batch.start_instance = m_instance_count;
+	m_current_batch.instance_count = 0;
+	m_current_batch.custom_draw = false;
+}
+
+sf::Vector2u RendererBatchBuilder::GetTextureSize( int page, float texture_coordinate_y ) const {
+	if( m_layered ) {
+		return m_layer_size;
+	}
+
+	// Coordinates in the top left texel belong to the first page.
+	if( texture_coordinate_y <= 1.f ) {
+		return m_texture_atlas[0]->getSize();
+	}
+
+	return m_texture_atlas[static_cast<std::size_t>( page )]->getSize();
+}
+
+}
+}
@@ -0,0 +1,291 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+#include <SFGUI/RendererViewport.hpp>
+#include <SFGUI/Primitive.hpp>
+#include <SFGUI/PrimitiveVertex.hpp>
+#include <SFGUI/PrimitiveInstance.hpp>
+#include <SFGUI/RendererBatch.hpp>
+
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sfg {
+namespace priv {
+
+/** Where a primitive is drawn and which batches it can join.
+ */
+struct RendererBatchPlacement {
+	std::shared_ptr<RendererViewport> viewport; // Viewport the primitive is batched with.
+	sf::Vector2f offset; // Added to the positions of the primitive's vertices.
+	sf::FloatRect cull_rect; // Primitives outside of it are culled if culling is enabled.
+	bool opaque = false; // Drawn with depth writes and without blending.
+};
+
+/** Base of the writers the batch builder hands vertex, index and instance data to.
+ * Writers provide WriteVertex() and WriteIndex(), writers of renderers that
+ * draw instances also provide WriteInstance(). The builder is a template,
+ * the calls are resolved at compile time.
+ */
+struct RendererBatchWriter {
+	/** Write an instance record.
+	 * @param offset Index of the instance record.
+	 * @param instance Instance of the primitive.
+	 * @param rect Rect of the instance in target coordinates.
+	 * @param texture_rect Normalized texture rect.
+	 * @param layer Atlas page the texture rect is located on.
+	 */
+	void WriteInstance( std::size_t /*offset*/, const PrimitiveInstance& /*instance*/, const sf::FloatRect& /*rect*/, const sf::FloatRect& /*texture_rect*/, int /*layer*/ ) {
+	}
+};
+
+/** Sorts primitives into batches that can each be drawn with a single draw call.
+ * A new batch is started whenever the viewport, the atlas page, opaqueness or
+ * the kind of data changes, when a batch drawn with 16-bit indices is full and
+ * around custom draw callbacks. Shared by all renderers so they batch alike.
+ */
+class RendererBatchBuilder {
+	public:
+		/** Ctor.
+		 * @param batches Vector to store the batches in, cleared.
+		 * @param texture_atlas Atlas pages texture coordinates are normalized by.
+		 * @param max_texture_size Height of an atlas page in atlas coordinates.
+		 * @param default_viewport Viewport of the window.
+		 * @param window_size Size of the window.
+		 */
+		RendererBatchBuilder( std::vector<RendererBatch>& batches, const std::vector<std::unique_ptr<sf::Texture>>& texture_atlas, int max_texture_size, std::shared_ptr<RendererViewport> default_viewport, const sf::Vector2i& window_size );
+
+		/** Enable culling of primitives outside of their viewport.
+		 * @param enable true to enable culling.
+		 */
+		void SetCull( bool enable );
+
+		/** Limit batches to the vertices 16-bit indices can address.
+		 * Indices are then written relative to the base vertex of their batch.
+		 * @param enable true if 16-bit indices are used.
+		 */
+		void SetShortIndices( bool enable );
+
+		/** Normalize texture coordinates by the size of a texture array layer.
+		 * Atlas page changes no longer start a new batch.
+		 * @param layer_size Size of a texture array layer.
+		 */
+		void SetLayerSize( const sf::Vector2u& layer_size );
+
+		/** Count the vertices and indices of the primitives that will be batched.
+		 * @param primitives Primitives.
+		 * @param vertex_count Number of vertices.
+		 * @param index_count Number of indices.
+		 * @return true if every primitive fits into a batch drawn with 16-bit indices.
+		 */
+		static bool Count( const std::vector<std::shared_ptr<Primitive>>& primitives, std::size_t& vertex_count, std::size_t& index_count );
+
+		/** Get the placement of a primitive.
+		 * Viewport and transform offsets are added to the vertices.
+		 * @param primitive Primitive.
+		 * @return Placement of the primitive.
+		 */
+		RendererBatchPlacement Place( const Primitive& primitive ) const;
+
+		/** Add all primitives with the default placement.
+		 * @param primitives Sorted primitives.
+		 * @param writer Writer to hand the data to.
+		 */
+		template<typename Writer>
+		void AddAll( const std::vector<std::shared_ptr<Primitive>>& primitives, Writer& writer );
+
+		/** Add a visible primitive without a custom draw callback.
+		 * @param primitive Primitive.
+		 * @param placement Placement of the primitive.
+		 * @param writer Writer to hand the data to.
+		 */
+		template<typename Writer>
+		void Add( Primitive& primitive, const RendererBatchPlacement& placement, Writer& writer );
+
+		/** Add a batch of its own for a primitive with a custom draw callback.
+		 * @param primitive Primitive.
+		 */
+		void AddCustomDraw( const Primitive& primitive );
+
+		/** Store the last batch.
+		 */
+		void Finish();
+
+		/** Get the number of vertices written.
+		 * @return Number of vertices written.
+		 */
+		int GetVertexCount() const;
+
+		/** Get the number of indices written.
+		 * @return Number of indices written.
+		 */
+		int GetIndexCount() const;
+
+		/** Get the number of instances written.
+		 * @return Number of instances written.
+		 */
+		int GetInstanceCount() const;
+
+	private:
+		void StartBatch( std::shared_ptr<RendererViewport> viewport, int atlas_page, bool opaque );
+
+		sf::Vector2u GetTextureSize( int page, float texture_coordinate_y ) const;
+
+		std::vector<RendererBatch>& m_batches;
+		const std::vector<std::unique_ptr<sf::Texture>>& m_texture_atlas;
+		std::shared_ptr<RendererViewport> m_default_viewport;
+
+		RendererBatch m_current_batch;
+
+		sf::FloatRect m_window_rect;
+		sf::Vector2u m_layer_size;
+
+		int m_max_texture_size;
+		int m_vertex_count;
+		int m_index_count;
+		int m_instance_count;
+
+		bool m_cull;
+		bool m_short_indices;
+		bool m_layered;
+};
+
+template<typename Writer>
+void RendererBatchBuilder::AddAll( const std::vector<std::shared_ptr<Primitive>>& primitives, Writer& writer ) {
+	for( const auto& primitive : primitives ) {
+		primitive->SetSynced();
+
+		if( !primitive->IsVisible() ) {
+			continue;
+		}
+
+		if( primitive->GetCustomDrawCallback() ) {
+			AddCustomDraw( *primitive );
+			continue;
+		}
+
+		Add( *primitive, Place( *primitive ), writer );
+	}
+}
+
+template<typename Writer>
+void RendererBatchBuilder::Add( Primitive& primitive, const RendererBatchPlacement& placement, Writer& writer ) {
+	const auto& vertices = primitive.GetVertices();
+	const auto& indices = primitive.GetIndices();
+
+	const auto vertices_size = vertices.size();
+
+	sf::Vector2f position( 0.f, 0.f );
+	sf::FloatRect bounding_rect( { 0.f, 0.f }, { 0.f, 0.f } );
+	sf::Vector2f normalizer;
+
+	auto layer = 0;
+
+	for( std::size_t index = 0; index < vertices_size; ++index ) {
+		const auto& vertex = vertices[index];
+		position.x = vertex.position.x + placement.offset.x;
+		position.y = vertex.position.y + placement.offset.y;
+
+		// The bound texture can only change between triangles.
+		if( index % 3 == 0 ) {
+			layer = static_cast<int>( vertex.texture_coordinate.y ) / m_max_texture_size;
+
+			auto texture_size = GetTextureSize( layer, vertex.texture_coordinate.y );
+
+			// Used to normalize texture coordinates.
+			normalizer.x = 1.f / static_cast<float>( texture_size.x );
+			normalizer.y = 1.f / static_cast<float>( texture_size.y );
+		}
+
+		// Normalize SFML's pixel texture coordinates.
+		const sf::Vector2f texture_coordinate( vertex.texture_coordinate.x * normalizer.x, static_cast<float>( static_cast<int>( vertex.texture_coordinate.y ) % m_max_texture_size ) * normalizer.y );
+
+		writer.WriteVertex( static_cast<std::size_t>( m_vertex_count ) + index, position, texture_coordinate, vertex.color, layer );
+
+		// Update the bounding rect.
+		if( m_cull ) {
+			if( position.x < bounding_rect.position.x ) {
+				bounding_rect.size.x += bounding_rect.position.x - position.x;
+				bounding_rect.position.x = position.x;
+			}
+			else if( position.x > bounding_rect.position.x + bounding_rect.size.x ) {
+				bounding_rect.size.x = position.x - bounding_rect.position.x;
+			}
+
+			if( position.y < bounding_rect.position.y ) {
+				bounding_rect.size.y += bounding_rect.position.y - position.y;
+				bounding_rect.position.y = position.y;
+			}
+			else if( position.y > bounding_rect.position.y + bounding_rect.size.y ) {
+				bounding_rect.size.y = position.y - bounding_rect.position.y;
+			}
+		}
+	}
+
+	// Culled vertices are simply overwritten by the next primitive.
+	if( vertices_size && ( !m_cull || placement.cull_rect.findIntersection( bounding_rect ) ) ) {
+		const auto atlas_page = m_layered ? 0 : layer;
+
+		// Batches drawn with 16-bit indices can't span more vertices than they can address.
+		const auto batch_full = m_short_indices && ( ( m_vertex_count + static_cast<int>( vertices_size ) - m_current_batch.base_vertex ) > max_short_index_vertices );
+
+		// Check if we need to start a new batch.
+		if( ( ( *placement.viewport ) != ( *m_current_batch.viewport ) ) || ( atlas_page != m_current_batch.atlas_page ) || ( placement.opaque != m_current_batch.opaque ) || batch_full || m_current_batch.instance_count ) {
+			StartBatch( placement.viewport, atlas_page, placement.opaque );
+		}
+
+		const auto batch_offset = static_cast<unsigned int>( m_vertex_count - ( m_short_indices ? m_current_batch.base_vertex : 0 ) );
+		const auto indices_size = indices.size();
+
+		for( std::size_t index = 0; index < indices_size; ++index ) {
+			writer.WriteIndex( static_cast<std::size_t>( m_index_count ) + index, batch_offset + indices[index] );
+		}
+
+		m_current_batch.index_count += static_cast<int>( indices_size );
+
+		m_vertex_count += static_cast<int>( vertices_size );
+		m_index_count += static_cast<int>( indices_size );
+	}
+
+	// Instances are drawn after the vertices of the primitive.
+	for( const auto& instance : primitive.GetInstances() ) {
+		// Round the edges like the vertices of expanded instances.
+		// Distance field glyphs are scaled and keep their exact extent.
+		const sf::Vector2f top_left( std::floor( instance.rect.position.x + .5f ), std::floor( instance.rect.position.y + .5f ) );
+		const sf::Vector2f bottom_right( std::floor( instance.rect.position.x + instance.rect.size.x + .5f ), std::floor( instance.rect.position.y + instance.rect.size.y + .5f ) );
+		const sf::FloatRect rect = instance.distance_field ? sf::FloatRect( instance.rect.position + placement.offset, instance.rect.size ) : sf::FloatRect( top_left + placement.offset, bottom_right - top_left );
+
+		if( m_cull && !placement.cull_rect.findIntersection( rect ) ) {
+			continue;
+		}
+
+		const auto instance_layer = static_cast<int>( instance.texture_rect.position.y ) / m_max_texture_size;
+		const auto atlas_page = m_layered ? 0 : instance_layer;
+		const auto texture_size = GetTextureSize( instance_layer, instance.texture_rect.position.y );
+
+		const sf::Vector2f instance_normalizer( 1.f / static_cast<float>( texture_size.x ), 1.f / static_cast<float>( texture_size.y ) );
+
+		// Check if we need to start a new batch.
+		if( ( ( *placement.viewport ) != ( *m_current_batch.viewport ) ) || ( atlas_page != m_current_batch.atlas_page ) || ( placement.opaque != m_current_batch.opaque ) || m_current_batch.index_count ) {
+			StartBatch( placement.viewport, atlas_page, placement.opaque );
+		}
+
+		const sf::FloatRect texture_rect(
+			{ instance.texture_rect.position.x * instance_normalizer.x, static_cast<float>( static_cast<int>( instance.texture_rect.position.y ) % m_max_texture_size ) * instance_normalizer.y },
+			{ instance.texture_rect.size.x * instance_normalizer.x, instance.texture_rect.size.y * instance_normalizer.y }
+		);
+
+		writer.WriteInstance( static_cast<std::size_t>( m_instance_count ), instance, rect, texture_rect, instance_layer );
+
+		++m_current_batch.instance_count;
+		++m_instance_count;
+	}
+}
+
+}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstddef>
+
+namespace sfg {
+namespace priv {
+
+/** Atlas page update waiting to be streamed to the GPU.
+ */
+struct RendererImageUpload {
+	std::size_t page;
+	sf::Vector2u position; // Position of the image within the page.
+	sf::Image image;
+};
+
+}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+
+namespace sfg {
+namespace priv {
+
+/** Instance record uploaded by the GL renderers.
+ * The vertex shader expands it into a quad covering rect, the fragment
+ * shader picks the border colors within border_width of its edges or
+ * thresholds the alpha channel if the texture holds a distance field.
+ */
+struct RendererInstance {
+	float rect[4]; // Left, top, width and height in target coordinates.
+	float texture_rect[4]; // Left, top, width and height in normalized texture coordinates.
+	sf::Color color;
+	sf::Color light_border_color;
+	sf::Color dark_border_color;
+	float border_width;
+	float transform_slot; // Read together with layer, clip_slot and depth as a single attribute.
+	float layer;
+	float clip_slot;
+	float depth;
+	float distance_field; // 1 if the texture holds a distance field, 0 otherwise.
+};
+
+static_assert( sizeof( RendererInstance ) == 68, "RendererInstance has to be tightly packed." );
+
+}
+}
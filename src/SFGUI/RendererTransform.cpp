@@ -0,0 +1,23 @@
+#include <SFGUI/RendererTransform.hpp>
+#include <SFGUI/Renderer.hpp>
+
+namespace sfg {
+
+RendererTransform::RendererTransform() {
+}
+
+void RendererTransform::SetOffset( const sf::Vector2f& offset ) {
+	if( offset == m_offset ) {
+		return;
+	}
+
+	m_offset = offset;
+
+	Renderer::Get().Invalidate( sfg::Renderer::INVALIDATE_TRANSFORM );
+}
+
+const sf::Vector2f& RendererTransform::GetOffset() const {
+	return m_offset;
+}
+
+}
@@ -1,4 +1,5 @@
 #include <SFGUI/RendererViewport.hpp>
+#include <SFGUI/RendererTransform.hpp>
 #include <SFGUI/Renderer.hpp>
 
 namespace {
@@ -34,6 +35,28 @@ const sf::Vector2f& RendererViewport::GetDestinationOrigin() const {
 	return m_destination_origin;
 }
 
+void RendererViewport::SetTransform( std::shared_ptr<RendererTransform> transform ) {
+	if( transform == m_transform ) {
+		return;
+	}
+
+	m_transform = transform;
+
+	Renderer::Get().Invalidate( sfg::Renderer::INVALIDATE_ALL );
+}
+
+std::shared_ptr<RendererTransform> RendererViewport::GetTransform() const {
+	return m_transform;
+}
+
+sf::Vector2f RendererViewport::GetAbsoluteDestinationOrigin() const {
+	if( !m_transform ) {
+		return m_destination_origin;
+	}
+
+	return m_destination_origin + m_transform->GetOffset();
+}
+
 void RendererViewport::SetSize( const sf::Vector2f& size ) {
 	m_size = size;
 
@@ -45,11 +68,11 @@ const sf::Vector2f& RendererViewport::GetSize() const {
 }
 
 bool RendererViewport::operator==( const RendererViewport& other ) const {
-	return ( m_source_origin == other.m_source_origin ) && ( m_destination_origin == other.m_destination_origin ) && ( m_size == other.m_size );
+	return ( m_source_origin == other.m_source_origin ) && ( m_destination_origin == other.m_destination_origin ) && ( m_size == other.m_size ) && ( m_transform == other.m_transform );
 }
 
 bool RendererViewport::operator!=( const RendererViewport& other ) const {
-	return ( m_source_origin != other.m_source_origin ) || ( m_destination_origin != other.m_destination_origin ) || ( m_size != other.m_size );
+	return ( m_source_origin != other.m_source_origin ) || ( m_destination_origin != other.m_destination_origin ) || ( m_size != other.m_size ) || ( m_transform != other.m_transform );
 }
 
 }
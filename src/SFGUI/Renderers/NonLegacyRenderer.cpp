@@ -8,18 +8,27 @@
 #undef None
 
 #include <SFGUI/Renderers/NonLegacyRenderer.hpp>
-#include <SFGUI/RendererBatch.hpp>
+#include <SFGUI/RendererBatchBuilder.hpp>
+#include <SFGUI/CompactVertex.hpp>
+#include <SFGUI/RendererInstance.hpp>
+#include <SFGUI/RendererImageUpload.hpp>
 #include <SFGUI/RendererViewport.hpp>
+#include <SFGUI/RendererTransform.hpp>
 #include <SFGUI/Signal.hpp>
 #include <SFGUI/Primitive.hpp>
 #include <SFGUI/PrimitiveVertex.hpp>
+#include <SFGUI/PrimitiveInstance.hpp>
+#include <SFGUI/Widget.hpp>
 #include <SFGUI/GLCheck.hpp>
+#include <SFGUI/ProfilerScope.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/Context.hpp>
 #include <SFML/System/Vector3.hpp>
 #include <sstream>
+#include <unordered_map>
+#include <algorithm>
 #include <cstddef>
 #include <cassert>
 
@@ -30,12 +39,14 @@
 #define GLEXT_GL_ELEMENT_ARRAY_BUFFER GL_ELEMENT_ARRAY_BUFFER_ARB
 #define GLEXT_GL_DYNAMIC_DRAW GL_DYNAMIC_DRAW_ARB
 #define GLEXT_GL_STATIC_DRAW GL_STATIC_DRAW_ARB
+#define GLEXT_GL_STREAM_DRAW GL_STREAM_DRAW_ARB
 
 #define GLEXT_glBindBuffer glBindBufferARB
 #define GLEXT_glDeleteBuffers glDeleteBuffersARB
 #define GLEXT_glGenBuffers glGenBuffersARB
 #define GLEXT_glBufferData glBufferDataARB
 #define GLEXT_glBufferSubData glBufferSubDataARB
+#define GLEXT_glUnmapBuffer glUnmapBufferARB
 
 // ARB_multitexture
 #define GLEXT_GL_TEXTURE0 GL_TEXTURE0_ARB
@@ -81,7 +92,10 @@
 #define GLEXT_glLinkProgram glLinkProgramARB
 #define GLEXT_glGetUniformLocation glGetUniformLocationARB
 #define GLEXT_glUniform1i glUniform1iARB
+#define GLEXT_glUniform1f glUniform1fARB
 #define GLEXT_glUniform2f glUniform2fARB
+#define GLEXT_glUniform2fv glUniform2fvARB
+#define GLEXT_glUniform4fv glUniform4fvARB
 
 // ARB_vertex_array_object
 #define GLEXT_vertex_array_object sfgogl_ext_ARB_vertex_array_object
@@ -104,6 +118,76 @@
 #define GLEXT_glFramebufferTexture2D glFramebufferTexture2DEXT
 #define GLEXT_glCheckFramebufferStatus glCheckFramebufferStatusEXT
 
+// ARB_map_buffer_range
+#define GLEXT_map_buffer_range sfgogl_ext_ARB_map_buffer_range
+
+#define GLEXT_GL_MAP_WRITE_BIT GL_MAP_WRITE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_RANGE_BIT GL_MAP_INVALIDATE_RANGE_BIT
+#define GLEXT_GL_MAP_INVALIDATE_BUFFER_BIT GL_MAP_INVALIDATE_BUFFER_BIT
+#define GLEXT_GL_MAP_UNSYNCHRONIZED_BIT GL_MAP_UNSYNCHRONIZED_BIT
+
+#define GLEXT_glMapBufferRange glMapBufferRange
+
+// ARB_sync
+#define GLEXT_sync sfgogl_ext_ARB_sync
+
+#define GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT GL_SYNC_FLUSH_COMMANDS_BIT
+#define GLEXT_GL_TIMEOUT_EXPIRED GL_TIMEOUT_EXPIRED
+
+#define GLEXT_glFenceSync glFenceSync
+#define GLEXT_glClientWaitSync glClientWaitSync
+#define GLEXT_glDeleteSync glDeleteSync
+
+// ARB_buffer_storage
+#define GLEXT_buffer_storage sfgogl_ext_ARB_buffer_storage
+
+#define GLEXT_GL_MAP_PERSISTENT_BIT GL_MAP_PERSISTENT_BIT
+#define GLEXT_GL_MAP_COHERENT_BIT GL_MAP_COHERENT_BIT
+
+#define GLEXT_glBufferStorage glBufferStorage
+
+// ARB_draw_elements_base_vertex
+#define GLEXT_draw_elements_base_vertex sfgogl_ext_ARB_draw_elements_base_vertex
+
+#define GLEXT_glDrawRangeElementsBaseVertex glDrawRangeElementsBaseVertex
+
+// ARB_instanced_arrays
+#define GLEXT_instanced_arrays sfgogl_ext_ARB_instanced_arrays
+
+#define GLEXT_glVertexAttribDivisor glVertexAttribDivisorARB
+
+// ARB_draw_instanced
+#define GLEXT_draw_instanced sfgogl_ext_ARB_draw_instanced
+
+#define GLEXT_glDrawArraysInstanced glDrawArraysInstancedARB
+
+// EXT_texture_array
+#define GLEXT_texture_array sfgogl_ext_EXT_texture_array
+
+#define GLEXT_GL_TEXTURE_2D_ARRAY GL_TEXTURE_2D_ARRAY_EXT
+#define GLEXT_GL_TEXTURE_BINDING_2D_ARRAY GL_TEXTURE_BINDING_2D_ARRAY_EXT
+#define GLEXT_GL_MAX_ARRAY_TEXTURE_LAYERS GL_MAX_ARRAY_TEXTURE_LAYERS_EXT
+#define GLEXT_GL_FRAMEBUFFER_BINDING GL_FRAMEBUFFER_BINDING_EXT
+
+// ARB_occlusion_query
+#define GLEXT_occlusion_query sfgogl_ext_ARB_occlusion_query
+
+#define GLEXT_GL_SAMPLES_PASSED GL_SAMPLES_PASSED_ARB
+#define GLEXT_GL_QUERY_RESULT GL_QUERY_RESULT_ARB
+#define GLEXT_GL_QUERY_RESULT_AVAILABLE GL_QUERY_RESULT_AVAILABLE_ARB
+
+#define GLEXT_glGenQueries glGenQueriesARB
+#define GLEXT_glDeleteQueries glDeleteQueriesARB
+#define GLEXT_glBeginQuery glBeginQueryARB
+#define GLEXT_glEndQuery glEndQueryARB
+#define GLEXT_glGetQueryObjectuiv glGetQueryObjectuivARB
+
+// ARB_pixel_buffer_object
+#define GLEXT_pixel_buffer_object sfgogl_ext_ARB_pixel_buffer_object
+
+#define GLEXT_GL_PIXEL_UNPACK_BUFFER GL_PIXEL_UNPACK_BUFFER_ARB
+
 #if defined( __APPLE__ )
 
     #define CastToGlHandle( x ) reinterpret_cast<GLEXT_GLhandle>( static_cast<std::ptrdiff_t>( x ) )
@@ -125,6 +209,75 @@ bool vao_supported = false;
 bool vap_supported = false;
 bool shader_supported = false;
 bool fbo_supported = false;
+bool map_buffer_range_supported = false;
+bool sync_supported = false;
+bool buffer_storage_supported = false;
+bool base_vertex_supported = false;
+bool instancing_supported = false;
+bool texture_array_supported = false;
+bool occlusion_query_supported = false;
+bool pixel_buffer_supported = false;
+
+// Must match the size of the transforms array in the shader.
+const std::size_t max_transforms = 128;
+
+// Must match the size of the clip_rects and clip_offsets arrays in the shader.
+const std::size_t max_clip_rects = 32;
+
+// Transform slot, atlas layer, clip slot and depth of each vertex.
+const std::size_t slot_components = 4;
+
+// gl_ClipDistance planes bounding the clip rect. GL_CLIP_DISTANCEi
+// shares its value with the legacy GL_CLIP_PLANEi.
+const GLenum clip_planes[] = { GL_CLIP_PLANE0, GL_CLIP_PLANE1, GL_CLIP_PLANE2, GL_CLIP_PLANE3 };
+
+// Number of buffer regions streamed into in turn. The region written
+// during a refresh was last drawn from two refreshes ago, by which
+// time the GPU should be done with it.
+const std::size_t stream_segments = 3;
+
+// Number of pixel unpack buffers image updates are streamed through in turn.
+const std::size_t pixel_buffer_count = 3;
+
+// Smallest number of vertices a streaming buffer region can hold.
+const std::size_t min_stream_vertices = 1024;
+
+// Smallest number of instances a streaming buffer region can hold.
+const std::size_t min_stream_instances = 256;
+
+// Order of the streamed buffers in the mapping table.
+enum StreamBuffer {
+	STREAM_VERTEX = 0,
+	STREAM_COLOR,
+	STREAM_TEXTURE,
+	STREAM_SLOT,
+	STREAM_INDEX,
+	STREAM_INSTANCE,
+	STREAM_BUFFER_COUNT
+};
+
+// Compact texture coordinates are normalized unsigned shorts.
+const float texture_coordinate_scale = 65535.f;
+
+// Size of an element of a streamed buffer. In the compact format the
+// vertex buffer holds the interleaved vertices and the color and
+// texture coordinate buffers are unused.
+std::size_t GetStreamElementSize( std::size_t buffer, bool compact ) {
+	switch( buffer ) {
+		case STREAM_VERTEX:
+			return compact ? sizeof( sfg::priv::CompactVertex ) : sizeof( sf::Vector2f );
+		case STREAM_COLOR:
+			return compact ? 0 : sizeof( sf::Color );
+		case STREAM_TEXTURE:
+			return compact ? 0 : sizeof( sf::Vector2f );
+		case STREAM_SLOT:
+			return slot_components * sizeof( GLfloat );
+		case STREAM_INSTANCE:
+			return sizeof( sfg::priv::RendererInstance );
+		default:
+			return sizeof( GLuint );
+	}
+}
 
 unsigned int GetAttributeLocation( unsigned int shader, std::string name ) {
 	auto location = CheckGLError( GLEXT_glGetAttribLocation( CastToGlHandle( shader ), name.c_str() ) );
@@ -223,8 +376,11 @@ NonLegacyRenderer::NonLegacyRenderer() :
 	m_previous_window_size( -1, -1 ),
 	m_last_vertex_count( 0 ),
 	m_last_index_count( 0 ),
+	m_last_instance_count( 0 ),
 	m_vbo_sync_type( INVALIDATE_ALL ),
 	m_vbo_synced( false ),
+	m_transforms_synced( false ),
+	m_transform_overflow( false ),
 	m_cull( false ),
 	m_use_fbo( false ) {
 	if( IsAvailable() ) {
@@ -233,11 +389,30 @@ NonLegacyRenderer::NonLegacyRenderer() :
 		m_shader = CreateShader(
 			"#version 130\n"
 			"uniform vec2 viewport_parameters;\n"
+			"uniform float position_scale;\n"
+			"uniform vec2 transforms[128];\n"
+			"uniform vec4 clip_rects[32];\n"
+			"uniform vec2 clip_offsets[32];\n"
+			"uniform bool instanced;\n"
 			"in vec2 vertex;\n"
 			"in vec4 color;\n"
 			"in vec2 texture_coordinate;\n"
+			"in vec4 slot;\n"
+			"in vec4 instance_rect;\n"
+			"in vec4 instance_texture_rect;\n"
+			"in vec4 instance_light_border_color;\n"
+			"in vec4 instance_dark_border_color;\n"
+			"in float instance_border_width;\n"
+			"in float instance_distance_field;\n"
 			"out vec4 vertex_color;\n"
 			"out vec2 vertex_texture_coordinate;\n"
+			"out vec4 vertex_light_border_color;\n"
+			"out vec4 vertex_dark_border_color;\n"
+			"out vec4 vertex_border_distance;\n"
+			"out float vertex_border_width;\n"
+			"out float vertex_distance_field;\n"
+			"flat out float vertex_layer;\n"
+			"out float gl_ClipDistance[4];\n"
 			"void main() {\n"
 			"\tmat4 mvp_matrix = mat4(1.f);\n"
 			"\tmvp_matrix[3][0] = -1.f;\n"
@@ -245,17 +420,68 @@ NonLegacyRenderer::NonLegacyRenderer() :
 			"\tmvp_matrix[0][0] = viewport_parameters.x;\n"
 			"\tmvp_matrix[1][1] = viewport_parameters.y;\n"
 			"\tmvp_matrix[2][2] = -1.f;\n"
-			"\tgl_Position = mvp_matrix * vec4(vertex.xy, 1.f, 1.f);\n"
-			"\tvertex_color = color;\n"
+			"\tvec2 position = vertex * position_scale;\n"
 			"\tvertex_texture_coordinate = texture_coordinate;\n"
+			"\tvertex_border_distance = vec4(0.f);\n"
+			"\tvertex_border_width = 0.f;\n"
+			"\tvertex_distance_field = 0.f;\n"
+			"\tif(instanced) {\n"
+			"\t\tvec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+			"\t\tposition = instance_rect.xy + corner * instance_rect.zw;\n"
+			"\t\tvertex_texture_coordinate = instance_texture_rect.xy + corner * instance_texture_rect.zw;\n"
+			"\t\tvertex_border_distance = vec4(corner * instance_rect.zw, (vec2(1.f) - corner) * instance_rect.zw);\n"
+			"\t\tvertex_border_width = instance_border_width;\n"
+			"\t\tvertex_distance_field = instance_distance_field;\n"
+			"\t}\n"
+			"\tposition += transforms[int(slot.x)] + clip_offsets[int(slot.z)];\n"
+			"\tvec4 clip_rect = clip_rects[int(slot.z)];\n"
+			"\tgl_ClipDistance[0] = position.x - clip_rect.x;\n"
+			"\tgl_ClipDistance[1] = clip_rect.x + clip_rect.z - position.x;\n"
+			"\tgl_ClipDistance[2] = position.y - clip_rect.y;\n"
+			"\tgl_ClipDistance[3] = clip_rect.y + clip_rect.w - position.y;\n"
+			"\tgl_Position = mvp_matrix * vec4(position, 1.f - 2.f * slot.w, 1.f);\n"
+			"\tvertex_layer = slot.y;\n"
+			"\tvertex_color = color;\n"
+			"\tvertex_light_border_color = instance_light_border_color;\n"
+			"\tvertex_dark_border_color = instance_dark_border_color;\n"
 			"}\n",
 			"#version 130\n"
 			"uniform sampler2D texture0;\n"
+			"uniform sampler2DArray texture_array;\n"
+			"uniform bool layered;\n"
 			"in vec4 vertex_color;\n"
 			"in vec2 vertex_texture_coordinate;\n"
+			"in vec4 vertex_light_border_color;\n"
+			"in vec4 vertex_dark_border_color;\n"
+			"in vec4 vertex_border_distance;\n"
+			"in float vertex_border_width;\n"
+			"in float vertex_distance_field;\n"
+			"flat in float vertex_layer;\n"
 			"out vec4 fragment_color;\n"
+			"vec4 fetch(ivec2 position) {\n"
+			"\treturn layered ? texelFetch(texture_array, ivec3(position, int(vertex_layer)), 0) : texelFetch(texture0, position, 0);\n"
+			"}\n"
 			"void main() {\n"
-			"\tfragment_color = vertex_color * texture(texture0, vertex_texture_coordinate);\n"
+			"\tvec4 color = vertex_color;\n"
+			"\tif(vertex_border_width > 0.f) {\n"
+			"\t\tif(vertex_border_distance.x < vertex_border_width) color = vertex_light_border_color;\n"
+			"\t\telse if(vertex_border_distance.w < vertex_border_width) color = vertex_dark_border_color;\n"
+			"\t\telse if(vertex_border_distance.z < vertex_border_width) color = vertex_dark_border_color;\n"
+			"\t\telse if(vertex_border_distance.y < vertex_border_width) color = vertex_light_border_color;\n"
+			"\t}\n"
+			"\tvec4 texel = layered ? texture(texture_array, vec3(vertex_texture_coordinate, vertex_layer)) : texture(texture0, vertex_texture_coordinate);\n"
+			"\tif(vertex_distance_field > 0.f) {\n"
+			"\t\tvec2 texture_size = layered ? vec2(textureSize(texture_array, 0).xy) : vec2(textureSize(texture0, 0));\n"
+			"\t\tvec2 texel_position = vertex_texture_coordinate * texture_size - vec2(.5f);\n"
+			"\t\tivec2 base = clamp(ivec2(floor(texel_position)), ivec2(0), ivec2(texture_size) - ivec2(2));\n"
+			"\t\tvec2 fraction = clamp(texel_position - vec2(base), vec2(0.f), vec2(1.f));\n"
+			"\t\tfloat top = mix(fetch(base).a, fetch(base + ivec2(1, 0)).a, fraction.x);\n"
+			"\t\tfloat bottom = mix(fetch(base + ivec2(0, 1)).a, fetch(base + ivec2(1, 1)).a, fraction.x);\n"
+			"\t\tfloat distance = mix(top, bottom, fraction.y);\n"
+			"\t\tfloat width = max(.7071f * length(vec2(dFdx(distance), dFdy(distance))), .001f);\n"
+			"\t\ttexel = vec4(1.f, 1.f, 1.f, smoothstep(.5f - width, .5f + width, distance));\n"
+			"\t}\n"
+			"\tfragment_color = color * texel;\n"
 			"}\n"
 		);
 
@@ -281,21 +507,52 @@ NonLegacyRenderer::NonLegacyRenderer() :
 			return;
 
 		CheckGLError( m_viewport_parameters_location = GLEXT_glGetUniformLocation( CastToGlHandle( m_shader ), "viewport_parameters" ) );
+		CheckGLError( m_position_scale_location = GLEXT_glGetUniformLocation( CastToGlHandle( m_shader ), "position_scale" ) );
 		CheckGLError( m_texture_location = GLEXT_glGetUniformLocation( CastToGlHandle( m_shader ), "texture0" ) );
+		CheckGLError( m_transforms_location = GLEXT_glGetUniformLocation( CastToGlHandle( m_shader ), "transforms" ) );
+		CheckGLError( m_clip_rects_location = GLEXT_glGetUniformLocation( CastToGlHandle( m_shader ), "clip_rects" ) );
+		CheckGLError( m_clip_offsets_location = GLEXT_glGetUniformLocation( CastToGlHandle( m_shader ), "clip_offsets" ) );
 
 		CheckGLError( m_vertex_location = GetAttributeLocation( m_shader, "vertex" ) );
 		CheckGLError( m_color_location = GetAttributeLocation( m_shader, "color" ) );
 		CheckGLError( m_texture_coordinate_location = GetAttributeLocation( m_shader, "texture_coordinate" ) );
+		CheckGLError( m_slot_location = GetAttributeLocation( m_shader, "slot" ) );
+
+		CheckGLError( m_instanced_location = GLEXT_glGetUniformLocation( CastToGlHandle( m_shader ), "instanced" ) );
+		CheckGLError( m_layered_location = GLEXT_glGetUniformLocation( CastToGlHandle( m_shader ), "layered" ) );
+		CheckGLError( m_texture_array_location = GLEXT_glGetUniformLocation( CastToGlHandle( m_shader ), "texture_array" ) );
+
+		CheckGLError( m_instance_rect_location = GetAttributeLocation( m_shader, "instance_rect" ) );
+		CheckGLError( m_instance_texture_rect_location = GetAttributeLocation( m_shader, "instance_texture_rect" ) );
+		CheckGLError( m_instance_light_border_color_location = GetAttributeLocation( m_shader, "instance_light_border_color" ) );
+		CheckGLError( m_instance_dark_border_color_location = GetAttributeLocation( m_shader, "instance_dark_border_color" ) );
+		CheckGLError( m_instance_border_width_location = GetAttributeLocation( m_shader, "instance_border_width" ) );
+		CheckGLError( m_instance_distance_field_location = GetAttributeLocation( m_shader, "instance_distance_field" ) );
 
 		CheckGLError( m_fbo_texture_location = GLEXT_glGetUniformLocation( CastToGlHandle( m_fbo_shader ), "texture0" ) );
 
 		CheckGLError( m_fbo_vertex_location = GetAttributeLocation( m_fbo_shader, "vertex" ) );
 		CheckGLError( m_fbo_texture_coordinate_location = GetAttributeLocation( m_fbo_shader, "texture_coordinate" ) );
 
-		CheckGLError( GLEXT_glGenBuffers( 1, &m_vertex_vbo ) );
-		CheckGLError( GLEXT_glGenBuffers( 1, &m_color_vbo ) );
-		CheckGLError( GLEXT_glGenBuffers( 1, &m_texture_vbo ) );
-		CheckGLError( GLEXT_glGenBuffers( 1, &m_index_vbo ) );
+		CreateBuffers();
+
+		if( instancing_supported ) {
+			m_use_instancing = true;
+		}
+
+		if( texture_array_supported ) {
+			CheckGLError( glGetIntegerv( GLEXT_GL_MAX_ARRAY_TEXTURE_LAYERS, &m_max_texture_array_layers ) );
+
+			m_use_texture_array = true;
+		}
+
+		m_use_image_streaming = pixel_buffer_supported;
+
+		GLint max_viewport_dimensions[2] = { 0, 0 };
+		CheckGLError( glGetIntegerv( GL_MAX_VIEWPORT_DIMS, max_viewport_dimensions ) );
+
+		m_compact = priv::CompactPositionsFit( std::max( max_viewport_dimensions[0], max_viewport_dimensions[1] ) ) &&
+		            priv::CompactTextureCoordinatesFit( GetMaxTextureSize(), texture_coordinate_scale );
 	}
 	else {
 #if defined( SFGUI_DEBUG )
@@ -309,11 +566,21 @@ NonLegacyRenderer::~NonLegacyRenderer() {
 
 	DestroyFBO();
 
-	CheckGLError( GLEXT_glDeleteBuffers( 1, &m_index_vbo ) );
-	CheckGLError( GLEXT_glDeleteBuffers( 1, &m_texture_vbo ) );
-	CheckGLError( GLEXT_glDeleteBuffers( 1, &m_color_vbo ) );
-	CheckGLError( GLEXT_glDeleteBuffers( 1, &m_vertex_vbo ) );
+	DestroyStreaming();
+
+	DestroyBuffers();
+
+	DestroyTextureArray();
+
+	if( !m_pixel_buffers.empty() ) {
+		CheckGLError( GLEXT_glDeleteBuffers( static_cast<GLsizei>( m_pixel_buffers.size() ), m_pixel_buffers.data() ) );
+	}
+
+	if( m_fragment_query ) {
+		CheckGLError( GLEXT_glDeleteQueries( 1, &m_fragment_query ) );
+	}
 
+	CheckGLError( GLEXT_glDeleteVertexArrays( 1, &m_instance_vao ) );
 	CheckGLError( GLEXT_glDeleteVertexArrays( 1, &m_vao ) );
 
 	CheckGLError( GLEXT_glDeletePrograms( 1, &m_fbo_shader ) );
@@ -329,6 +596,30 @@ const std::string& NonLegacyRenderer::GetName() const {
 	return name;
 }
 
+bool NonLegacyRenderer::UsesCompactVertices() const {
+	return m_compact;
+}
+
+bool NonLegacyRenderer::UsesInstancing() const {
+	return m_use_instancing;
+}
+
+bool NonLegacyRenderer::UsesTextureArray() const {
+	return m_layered;
+}
+
+bool NonLegacyRenderer::UsesDepthPrePass() const {
+	return m_depth_pre_pass;
+}
+
+bool NonLegacyRenderer::UsesShaderClipping() const {
+	return m_use_shader_clipping;
+}
+
+bool NonLegacyRenderer::UsesDistanceFieldText() const {
+	return m_use_distance_field_text && m_use_instancing;
+}
+
 bool NonLegacyRenderer::IsAvailable() {
 	static bool checked = false;
 
@@ -380,6 +671,39 @@ bool NonLegacyRenderer::IsAvailable() {
 			fbo_supported = true;
 		}
 
+		if( GLEXT_map_buffer_range ) {
+			map_buffer_range_supported = true;
+		}
+
+		if( GLEXT_sync ) {
+			sync_supported = true;
+		}
+
+		if( GLEXT_buffer_storage ) {
+			buffer_storage_supported = true;
+		}
+
+		if( GLEXT_draw_elements_base_vertex ) {
+			base_vertex_supported = true;
+		}
+
+		if( GLEXT_instanced_arrays && GLEXT_draw_instanced ) {
+			instancing_supported = true;
+		}
+
+		// Atlas pages are copied into the array through a framebuffer.
+		if( GLEXT_texture_array && GLEXT_framebuffer_object ) {
+			texture_array_supported = true;
+		}
+
+		if( GLEXT_occlusion_query ) {
+			occlusion_query_supported = true;
+		}
+
+		if( GLEXT_pixel_buffer_object && GLEXT_vertex_buffer_object ) {
+			pixel_buffer_supported = true;
+		}
+
 		checked = true;
 	}
 
@@ -442,6 +766,41 @@ void NonLegacyRenderer::DisplayImpl() const {
 		return;
 	}
 
+	SFGUI_PROFILE_SCOPE( DISPLAY );
+
+#if defined( SFGUI_PROFILER )
+	// The result of an earlier frame is only read once it is available so we
+	// never wait for the GPU. Frames drawn while it isn't aren't sampled.
+	auto count_fragments = occlusion_query_supported && Profiler::IsEnabled();
+
+	if( !count_fragments ) {
+		m_fragment_query_pending = false;
+	}
+	else if( !m_fragment_query ) {
+		CheckGLError( GLEXT_glGenQueries( 1, &m_fragment_query ) );
+	}
+	else if( m_fragment_query_pending ) {
+		GLuint available = 0;
+		CheckGLError( GLEXT_glGetQueryObjectuiv( m_fragment_query, GLEXT_GL_QUERY_RESULT_AVAILABLE, &available ) );
+
+		if( available ) {
+			GLuint fragments = 0;
+			CheckGLError( GLEXT_glGetQueryObjectuiv( m_fragment_query, GLEXT_GL_QUERY_RESULT, &fragments ) );
+
+			SFGUI_PROFILE_COUNT( DRAWN_FRAGMENTS, fragments );
+
+			m_fragment_query_pending = false;
+		}
+	}
+
+	// A new query is only begun once the pending one has been read.
+	auto begin_fragment_query = count_fragments && !m_fragment_query_pending;
+
+	if( begin_fragment_query ) {
+		CheckGLError( GLEXT_glBeginQuery( GLEXT_GL_SAMPLES_PASSED, m_fragment_query ) );
+	}
+#endif
+
 	auto previous_program = CheckGLError( GLEXT_glGetHandle( GLEXT_GL_PROGRAM_OBJECT ) );
 
 	if( m_last_window_size != m_window_size ) {
@@ -459,6 +818,37 @@ void NonLegacyRenderer::DisplayImpl() const {
 		}
 	}
 
+	// The depth pre-pass needs a depth buffer to draw into.
+	// Cached frames are drawn without it.
+	auto depth_pre_pass = false;
+
+	if( m_use_depth_pre_pass && !m_use_fbo ) {
+		// The depth buffer of a context doesn't change, only query it for new contexts.
+		const auto context_id = sf::Context::getActiveContextId();
+
+		if( context_id != m_depth_bits_context_id ) {
+			m_depth_bits_context_id = context_id;
+			m_depth_bits = 0;
+
+			CheckGLError( glGetIntegerv( GL_DEPTH_BITS, &m_depth_bits ) );
+		}
+
+		depth_pre_pass = ( m_depth_bits > 0 );
+	}
+
+	// Primitives are emitted in a different order with the pre-pass.
+	if( depth_pre_pass != m_depth_pre_pass ) {
+		m_depth_pre_pass = depth_pre_pass;
+
+		const_cast<NonLegacyRenderer*>( this )->InvalidateVBO( INVALIDATE_ALL );
+	}
+
+	// Queued image updates have to reach the atlas before it is
+	// copied into the texture array, which the refresh might do.
+	if( !m_image_uploads.empty() ) {
+		const_cast<NonLegacyRenderer*>( this )->FlushImageUploads();
+	}
+
 	if( !m_vbo_synced ) {
 		// Disclaimer:
 		// const_cast IS safe to use in ANY non-static method of
@@ -479,6 +869,10 @@ void NonLegacyRenderer::DisplayImpl() const {
 		const_cast<NonLegacyRenderer*>( this )->SetupVAO();
 	}
 
+	if( m_last_instance_count && !GLEXT_glIsVertexArray( m_instance_vao ) ) {
+		const_cast<NonLegacyRenderer*>( this )->SetupInstanceVAO();
+	}
+
 	CheckGLError( GLEXT_glActiveTexture( GLEXT_GL_TEXTURE0 + 1 ) );
 	auto texture_binding = 0;
 	CheckGLError( glGetIntegerv( GL_TEXTURE_BINDING_2D, &texture_binding) );
@@ -499,22 +893,82 @@ void NonLegacyRenderer::DisplayImpl() const {
 
 		CheckGLError( GLEXT_glUseProgramObject( CastToGlHandle( m_shader ) ) );
 		CheckGLError( GLEXT_glUniform1i( m_texture_location, 1 ) );
+		CheckGLError( GLEXT_glUniform1i( m_instanced_location, 0 ) );
+		CheckGLError( GLEXT_glUniform1f( m_position_scale_location, 1.f / m_position_scale ) );
+
+		if( !m_transforms_synced ) {
+			const_cast<NonLegacyRenderer*>( this )->RefreshTransforms();
+			const_cast<NonLegacyRenderer*>( this )->RefreshClipRects();
+		}
 
 		CheckGLError( GLEXT_glActiveTexture( GLEXT_GL_TEXTURE0 + 1 ) );
 		sf::Texture::bind( m_texture_atlas[0].get() );
 		CheckGLError( GLEXT_glActiveTexture( GLEXT_GL_TEXTURE0 ) );
 
+		// With the texture array all pages are bound at once and
+		// the layer is selected per vertex.
+		if( m_layered ) {
+			const_cast<NonLegacyRenderer*>( this )->CopyTextureArrayPages();
+		}
+
+		// Samplers of different types can't share a texture unit
+		// even if one of them is unused.
+		CheckGLError( GLEXT_glUniform1i( m_texture_array_location, 2 ) );
+		CheckGLError( GLEXT_glUniform1i( m_layered_location, m_layered ? 1 : 0 ) );
+
+		if( m_layered ) {
+			CheckGLError( GLEXT_glActiveTexture( GLEXT_GL_TEXTURE0 + 2 ) );
+			CheckGLError( glBindTexture( GLEXT_GL_TEXTURE_2D_ARRAY, m_texture_array ) );
+			CheckGLError( GLEXT_glActiveTexture( GLEXT_GL_TEXTURE0 ) );
+		}
+
 		CheckGLError( GLEXT_glBindVertexArray( m_vao ) );
 
+		// State changed by the depth pre-pass.
+		GLboolean depth_test_enabled = GL_FALSE;
+		GLboolean depth_mask = GL_TRUE;
+		GLboolean blend_enabled = GL_TRUE;
+		GLint depth_function = GL_LESS;
+		GLfloat clear_depth = 1.f;
+
+		auto drawing_opaque = false;
+
+		if( m_depth_pre_pass ) {
+			depth_test_enabled = CheckGLError( glIsEnabled( GL_DEPTH_TEST ) );
+			blend_enabled = CheckGLError( glIsEnabled( GL_BLEND ) );
+			CheckGLError( glGetBooleanv( GL_DEPTH_WRITEMASK, &depth_mask ) );
+			CheckGLError( glGetIntegerv( GL_DEPTH_FUNC, &depth_function ) );
+			CheckGLError( glGetFloatv( GL_DEPTH_CLEAR_VALUE, &clear_depth ) );
+
+			// Later primitives are nearer, primitives hide
+			// themselves only where they overlap their own depth.
+			CheckGLError( glEnable( GL_DEPTH_TEST ) );
+			CheckGLError( glDepthFunc( GL_LEQUAL ) );
+			CheckGLError( glDepthMask( GL_TRUE ) );
+			CheckGLError( glClearDepth( 1. ) );
+			CheckGLError( glClear( GL_DEPTH_BUFFER_BIT ) );
+			CheckGLError( glDepthMask( GL_FALSE ) );
+		}
+
 		CheckGLError( glEnable( GL_SCISSOR_TEST ) );
 
+		if( m_use_shader_clipping ) {
+			for( auto plane : clip_planes ) {
+				CheckGLError( glEnable( plane ) );
+			}
+		}
+
 		auto current_atlas_page = 0;
+		auto current_base_vertex = 0;
+		auto drawing_instances = false;
+
+		SFGUI_PROFILE_COUNT( BATCHES, m_batches.size() );
 
 		for( const auto& batch : m_batches ) {
 			auto viewport = batch.viewport;
 
 			if( batch.custom_draw ) {
-				auto destination = static_cast<sf::Vector2i>( viewport->GetDestinationOrigin() );
+				auto destination = static_cast<sf::Vector2i>( viewport->GetAbsoluteDestinationOrigin() );
 				auto size = static_cast<sf::Vector2i>( viewport->GetSize() );
 
 				CheckGLError( GLEXT_glBindVertexArray( 0 ) );
@@ -528,9 +982,47 @@ void NonLegacyRenderer::DisplayImpl() const {
 
 				CheckGLError( glViewport( destination.x, m_window_size.y - destination.y - size.y, size.x, size.y ) );
 
+				if( m_use_shader_clipping ) {
+					for( auto plane : clip_planes ) {
+						CheckGLError( glDisable( plane ) );
+					}
+				}
+
+				if( m_depth_pre_pass ) {
+					CheckGLError( glDisable( GL_DEPTH_TEST ) );
+
+					if( drawing_opaque ) {
+						drawing_opaque = false;
+
+						CheckGLError( glDepthMask( GL_FALSE ) );
+
+						if( blend_enabled ) {
+							CheckGLError( glEnable( GL_BLEND ) );
+						}
+					}
+				}
+
 				// Draw canvas.
 				( *batch.custom_draw_callback )();
 
+				if( m_use_shader_clipping ) {
+					for( auto plane : clip_planes ) {
+						CheckGLError( glEnable( plane ) );
+					}
+				}
+
+				// Everything drawn so far is behind the following
+				// primitives, start over with a cleared depth buffer.
+				if( m_depth_pre_pass ) {
+					CheckGLError( glEnable( GL_DEPTH_TEST ) );
+					CheckGLError( glDepthFunc( GL_LEQUAL ) );
+					CheckGLError( glDepthMask( GL_TRUE ) );
+					CheckGLError( glDisable( GL_SCISSOR_TEST ) );
+					CheckGLError( glClear( GL_DEPTH_BUFFER_BIT ) );
+					CheckGLError( glEnable( GL_SCISSOR_TEST ) );
+					CheckGLError( glDepthMask( GL_FALSE ) );
+				}
+
 				CheckGLError( glViewport( 0, 0, m_window_size.x, m_window_size.y ) );
 
 				CheckGLError( GLEXT_glActiveTexture( GLEXT_GL_TEXTURE0 + 1 ) );
@@ -539,10 +1031,16 @@ void NonLegacyRenderer::DisplayImpl() const {
 
 				CheckGLError( GLEXT_glUseProgramObject( CastToGlHandle( m_shader ) ) );
 				CheckGLError( GLEXT_glBindVertexArray( m_vao ) );
+
+				if( drawing_instances ) {
+					drawing_instances = false;
+
+					CheckGLError( GLEXT_glUniform1i( m_instanced_location, 0 ) );
+				}
 			}
 			else {
 				if( viewport && ( ( *viewport ) != ( *m_default_viewport ) ) ) {
-					auto destination_origin = viewport->GetDestinationOrigin();
+					auto destination_origin = viewport->GetAbsoluteDestinationOrigin();
 					auto size = viewport->GetSize();
 
 					CheckGLError( glScissor(
@@ -556,7 +1054,22 @@ void NonLegacyRenderer::DisplayImpl() const {
 					CheckGLError( glScissor( 0, 0, m_window_size.x, m_window_size.y ) );
 				}
 
-				if( batch.index_count ) {
+				if( batch.index_count || batch.instance_count ) {
+					// Opaque batches write depth and need no blending,
+					// translucent batches are only tested against them.
+					if( m_depth_pre_pass && ( batch.opaque != drawing_opaque ) ) {
+						drawing_opaque = batch.opaque;
+
+						CheckGLError( glDepthMask( drawing_opaque ? GL_TRUE : GL_FALSE ) );
+
+						if( drawing_opaque ) {
+							CheckGLError( glDisable( GL_BLEND ) );
+						}
+						else if( blend_enabled ) {
+							CheckGLError( glEnable( GL_BLEND ) );
+						}
+					}
+
 					if( batch.atlas_page != current_atlas_page ) {
 						current_atlas_page = batch.atlas_page;
 
@@ -567,20 +1080,104 @@ void NonLegacyRenderer::DisplayImpl() const {
 						CheckGLError( GLEXT_glActiveTexture( GLEXT_GL_TEXTURE0 ) );
 					}
 
-					CheckGLError( glDrawRangeElements(
-						GL_TRIANGLES,
-						static_cast<unsigned int>( batch.min_index ),
-						static_cast<unsigned int>( batch.max_index ),
-						batch.index_count,
-						GL_UNSIGNED_INT,
-						reinterpret_cast<const GLvoid*>( static_cast<std::size_t>( batch.start_index ) * sizeof( GLuint ) )
-					) );
+					// The instance vertex array object and the instanced
+					// shader path are only switched to when needed.
+					if( drawing_instances != ( batch.instance_count != 0 ) ) {
+						drawing_instances = ( batch.instance_count != 0 );
+
+						CheckGLError( GLEXT_glUniform1i( m_instanced_location, drawing_instances ? 1 : 0 ) );
+						CheckGLError( GLEXT_glBindVertexArray( drawing_instances ? m_instance_vao : m_vao ) );
+					}
+
+					if( batch.instance_count ) {
+						const_cast<NonLegacyRenderer*>( this )->SetupInstanceAttributes( static_cast<std::size_t>( batch.start_instance ) );
+
+						CheckGLError( GLEXT_glDrawArraysInstanced( GL_TRIANGLE_STRIP, 0, 4, batch.instance_count ) );
+					}
+					else if( !m_short_indices ) {
+						CheckGLError( glDrawRangeElements(
+							GL_TRIANGLES,
+							static_cast<unsigned int>( batch.min_index ),
+							static_cast<unsigned int>( batch.max_index ),
+							batch.index_count,
+							GL_UNSIGNED_INT,
+							reinterpret_cast<const GLvoid*>( ( m_stream_index_base + static_cast<std::size_t>( batch.start_index ) ) * sizeof( GLuint ) )
+						) );
+					}
+					else {
+						// The index segment is sized in 32-bit elements.
+						const auto index_offset = m_stream_index_base * sizeof( GLuint ) + static_cast<std::size_t>( batch.start_index ) * sizeof( GLushort );
+
+						if( base_vertex_supported ) {
+							CheckGLError( GLEXT_glDrawRangeElementsBaseVertex(
+								GL_TRIANGLES,
+								0,
+								static_cast<unsigned int>( batch.max_index - batch.base_vertex ),
+								batch.index_count,
+								GL_UNSIGNED_SHORT,
+								reinterpret_cast<const GLvoid*>( index_offset ),
+								batch.base_vertex
+							) );
+						}
+						else {
+							// Without base vertex support the attributes
+							// have to be moved to the start of the batch.
+							if( batch.base_vertex != current_base_vertex ) {
+								current_base_vertex = batch.base_vertex;
+
+								const_cast<NonLegacyRenderer*>( this )->SetupAttributes( static_cast<std::size_t>( current_base_vertex ) );
+							}
+
+							CheckGLError( glDrawRangeElements(
+								GL_TRIANGLES,
+								0,
+								static_cast<unsigned int>( batch.max_index - batch.base_vertex ),
+								batch.index_count,
+								GL_UNSIGNED_SHORT,
+								reinterpret_cast<const GLvoid*>( index_offset )
+							) );
+						}
+					}
+
+					SFGUI_PROFILE_COUNT( DRAW_CALLS, 1 );
 				}
 			}
 		}
 
 		CheckGLError( glDisable( GL_SCISSOR_TEST ) );
 
+		if( m_use_shader_clipping ) {
+			for( auto plane : clip_planes ) {
+				CheckGLError( glDisable( plane ) );
+			}
+		}
+
+		if( m_depth_pre_pass ) {
+			CheckGLError( glDepthMask( depth_mask ) );
+			CheckGLError( glDepthFunc( static_cast<GLenum>( depth_function ) ) );
+			CheckGLError( glClearDepth( static_cast<GLdouble>( clear_depth ) ) );
+
+			if( !depth_test_enabled ) {
+				CheckGLError( glDisable( GL_DEPTH_TEST ) );
+			}
+
+			if( blend_enabled ) {
+				CheckGLError( glEnable( GL_BLEND ) );
+			}
+		}
+
+		if( m_layered ) {
+			CheckGLError( GLEXT_glActiveTexture( GLEXT_GL_TEXTURE0 + 2 ) );
+			CheckGLError( glBindTexture( GLEXT_GL_TEXTURE_2D_ARRAY, 0 ) );
+			CheckGLError( GLEXT_glActiveTexture( GLEXT_GL_TEXTURE0 ) );
+		}
+
+		// Leave the vertex array object pointing at the first vertex.
+		if( current_base_vertex ) {
+			CheckGLError( GLEXT_glBindVertexArray( m_vao ) );
+			const_cast<NonLegacyRenderer*>( this )->SetupAttributes( 0 );
+		}
+
 		m_force_redraw = false;
 
 		if( m_use_fbo ) {
@@ -604,6 +1201,8 @@ void NonLegacyRenderer::DisplayImpl() const {
 			assert( m_fbo_vao != 0 );
 
 			CheckGLError( glDrawArrays( GL_TRIANGLE_STRIP, 0, 4 ) );
+
+			SFGUI_PROFILE_COUNT( DRAW_CALLS, 1 );
 		}
 	}
 	else {
@@ -625,6 +1224,8 @@ void NonLegacyRenderer::DisplayImpl() const {
 		assert( m_fbo_vao != 0 );
 
 		CheckGLError( glDrawArrays( GL_TRIANGLE_STRIP, 0, 4 ) );
+
+		SFGUI_PROFILE_COUNT( DRAW_CALLS, 1 );
 	}
 
 	// Needed otherwise SFML will blow up...
@@ -636,238 +1237,714 @@ void NonLegacyRenderer::DisplayImpl() const {
 	CheckGLError( glBindTexture( GL_TEXTURE_2D, static_cast<unsigned int>( texture_binding ) ) );
 	CheckGLError( GLEXT_glActiveTexture( GLEXT_GL_TEXTURE0 ) );
 
+#if defined( SFGUI_PROFILER )
+	if( begin_fragment_query ) {
+		CheckGLError( GLEXT_glEndQuery( GLEXT_GL_SAMPLES_PASSED ) );
+
+		m_fragment_query_pending = true;
+	}
+#endif
+
 	m_vbo_synced = true;
 }
 
 void NonLegacyRenderer::RefreshVBO() {
-	SortPrimitives();
+	SFGUI_PROFILE_SCOPE( REFRESH_VBO );
 
-	m_vertex_data.clear();
-	m_color_data.clear();
-	m_texture_data.clear();
-	m_index_data.clear();
-
-	m_vertex_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
-	m_color_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
-	m_texture_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
-	m_index_data.reserve( static_cast<std::size_t>( m_index_count ) );
-
-	m_batches.clear();
+	SortPrimitives();
 
-	m_last_vertex_count = 0;
-	m_last_index_count = 0;
+	// Compact positions are as fine as the window size allows.
+	m_position_scale = m_compact ? priv::CompactPositionScale( m_window_size ) : 1.f;
 
-	// Default viewport
-	priv::RendererBatch current_batch;
-	current_batch.viewport = m_default_viewport;
-	current_batch.atlas_page = 0;
-	current_batch.start_index = 0;
-	current_batch.index_count = 0;
-	current_batch.min_index = 0;
-	current_batch.max_index = m_vertex_count - 1;
-	current_batch.custom_draw = false;
+	// Streaming was toggled since the last refresh.
+	if( m_streaming && !m_use_streaming ) {
+		DestroyStreaming();
+	}
 
-	sf::FloatRect window_viewport( { 0.f, 0.f }, sf::Vector2f( m_window_size ) );
+	// The buffers are written to directly, so their exact size has
+	// to be known up front. Culled primitives only make it smaller.
+	auto vertex_total = std::size_t( 0 );
+	auto index_total = std::size_t( 0 );
+	auto instance_total = std::size_t( 0 );
 
-	const auto max_texture_size = GetMaxTextureSize();
-	const auto default_texture_size = m_texture_atlas[0]->getSize();
+	// 16-bit indices can be used as long as every primitive fits into a batch.
+	m_short_indices = true;
 
-	for( const auto& primitive_ptr : m_primitives ) {
-		auto primitive = primitive_ptr.get();
+	for( const auto& primitive : m_primitives ) {
+		// Instances left over from before instancing was disabled.
+		if( !m_use_instancing && !primitive->GetInstances().empty() ) {
+			const auto previous_vertex_count = primitive->GetVertices().size();
+			const auto previous_index_count = primitive->GetIndices().size();
 
-		primitive->SetSynced();
+			primitive->ExpandInstances();
 
-		if( !primitive->IsVisible() ) {
-			continue;
+			m_vertex_count += static_cast<int>( primitive->GetVertices().size() - previous_vertex_count );
+			m_index_count += static_cast<int>( primitive->GetIndices().size() - previous_index_count );
 		}
 
-		auto position_transform = primitive->GetPosition();
-
-		auto viewport = primitive->GetViewport();
-
-		auto viewport_rect = window_viewport;
+		// Invalidated primitives might have changed since they were classified.
+		if( !primitive->IsSynced() ) {
+			ClassifyOpacity( *primitive );
+		}
 
-		// Check if primitive needs to be rendered in a custom viewport.
-		if( viewport && ( ( *viewport ) != ( *m_default_viewport ) ) ) {
-			auto destination_origin = viewport->GetDestinationOrigin();
-			auto size = viewport->GetSize();
+		if( primitive->IsVisible() && !primitive->GetCustomDrawCallback() ) {
+			const auto primitive_vertices = primitive->GetVertices().size();
 
-			position_transform += ( destination_origin - viewport->GetSourceOrigin() );
+			vertex_total += primitive_vertices;
+			index_total += primitive->GetIndices().size();
+			instance_total += primitive->GetInstances().size();
 
-			if( m_cull ) {
-				viewport_rect = { destination_origin, size };
+			if( primitive_vertices > static_cast<std::size_t>( priv::max_short_index_vertices ) ) {
+				m_short_indices = false;
 			}
 		}
+	}
 
-		const auto& custom_draw_callback = primitive->GetCustomDrawCallback();
-
-		if( custom_draw_callback ) {
-			// Start a new batch.
-			current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-			m_batches.push_back( current_batch );
-
-			// Mark current_batch custom draw batch.
-			current_batch.viewport = viewport;
-			current_batch.start_index = 0;
-			current_batch.index_count = 0;
-			current_batch.min_index = 0;
-			current_batch.max_index = 0;
-			current_batch.custom_draw = true;
-			current_batch.custom_draw_callback = custom_draw_callback;
+	if( m_use_streaming && ( !m_streaming || ( vertex_total > m_stream_vertex_capacity ) || ( index_total > m_stream_index_capacity ) || ( instance_total > m_stream_instance_capacity ) ) ) {
+		// Instances are expanded into vertices if instancing isn't used.
+		const auto instance_capacity = m_use_instancing ? std::max( instance_total + instance_total / 2, min_stream_instances ) : std::size_t( 0 );
 
-			// Start a new batch.
-			m_batches.push_back( current_batch );
+		SetupStreaming( std::max( vertex_total + vertex_total / 2, min_stream_vertices ), std::max( index_total + index_total / 2, min_stream_vertices * 3 / 2 ), instance_capacity );
+	}
 
-			// Reset current_batch to defaults.
-			current_batch.viewport = m_default_viewport;
-			current_batch.start_index = m_last_index_count;
-			current_batch.index_count = 0;
-			current_batch.min_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-			current_batch.custom_draw = false;
+	priv::CompactVertex* compact_data = nullptr;
+	sf::Vector2f* vertex_data = nullptr;
+	sf::Color* color_data = nullptr;
+	sf::Vector2f* texture_data = nullptr;
+	GLfloat* slot_data = nullptr;
+	GLuint* index_data = nullptr;
+	GLushort* short_index_data = nullptr;
+	priv::RendererInstance* instance_data = nullptr;
+
+	if( m_streaming ) {
+		// Fence the segment the previous frames were drawn from
+		// and move on to the next one once the GPU is done with it.
+		if( m_stream_fences[m_stream_segment] ) {
+			CheckGLError( GLEXT_glDeleteSync( static_cast<GLsync>( m_stream_fences[m_stream_segment] ) ) );
 		}
-		else {
-			// Process primitive's vertices and indices
-			const std::vector<PrimitiveVertex>& vertices( primitive->GetVertices() );
-			const std::vector<GLuint>& indices( primitive->GetIndices() );
 
-			sf::Vector2f position( 0.f, 0.f );
+		m_stream_fences[m_stream_segment] = CheckGLError( GLEXT_glFenceSync( GLEXT_GL_SYNC_GPU_COMMANDS_COMPLETE, 0 ) );
 
-			sf::FloatRect bounding_rect( { 0.f, 0.f }, { 0.f, 0.f } );
+		m_stream_segment = ( m_stream_segment + 1 ) % stream_segments;
 
-			auto atlas_page = 0;
+		if( m_stream_fences[m_stream_segment] ) {
+			auto fence = static_cast<GLsync>( m_stream_fences[m_stream_segment] );
 
-			const auto vertices_size = vertices.size();
-			sf::Vector2f normalizer;
+			auto status = static_cast<GLenum>( GLEXT_GL_TIMEOUT_EXPIRED );
 
-			for( std::size_t index = 0; index < vertices_size; ++index ) {
-				const auto vertex = vertices[index];
-				position.x = vertex.position.x + position_transform.x;
-				position.y = vertex.position.y + position_transform.y;
-
-				m_vertex_data.push_back( position );
-				m_color_data.push_back( vertex.color );
+			while( status == GLEXT_GL_TIMEOUT_EXPIRED ) {
+				status = CheckGLError( GLEXT_glClientWaitSync( fence, GLEXT_GL_SYNC_FLUSH_COMMANDS_BIT, 1000000 ) );
+			}
 
-				// The bound texture can only change between triangles.
-				if( index % 3 == 0 ) {
-					atlas_page = static_cast<int>( vertex.texture_coordinate.y ) / max_texture_size;
-					auto texture_size = ( vertex.texture_coordinate.y <= 1.f ) ? default_texture_size : m_texture_atlas[static_cast<std::size_t>( atlas_page )]->getSize();
+			CheckGLError( GLEXT_glDeleteSync( fence ) );
+			m_stream_fences[m_stream_segment] = nullptr;
+		}
 
-					// Used to normalize texture coordinates.
-					normalizer.x = 1.f / static_cast<float>( texture_size.x );
-					normalizer.y = 1.f / static_cast<float>( texture_size.y );
-				}
+		m_stream_vertex_base = m_stream_segment * m_stream_vertex_capacity;
+		m_stream_index_base = m_stream_segment * m_stream_index_capacity;
+		m_stream_instance_base = m_stream_segment * m_stream_instance_capacity;
 
-				// Normalize SFML's pixel texture coordinates.
-				m_texture_data.emplace_back( vertex.texture_coordinate.x * normalizer.x, static_cast<float>( static_cast<int>( vertex.texture_coordinate.y ) % max_texture_size ) * normalizer.y );
+		const unsigned int buffers[] = { m_vertex_vbo, m_color_vbo, m_texture_vbo, m_slot_vbo, m_index_vbo, m_instance_vbo };
+		const std::size_t bases[] = { m_stream_vertex_base, m_stream_vertex_base, m_stream_vertex_base, m_stream_vertex_base, m_stream_index_base, m_stream_instance_base };
+		const std::size_t capacities[] = { m_stream_vertex_capacity, m_stream_vertex_capacity, m_stream_vertex_capacity, m_stream_vertex_capacity, m_stream_index_capacity, m_stream_instance_capacity };
+		void* maps[STREAM_BUFFER_COUNT] = {};
 
-				// Update the bounding rect.
-				if( m_cull ) {
-					if( position.x < bounding_rect.position.x ) {
-						bounding_rect.size.x += bounding_rect.position.x - position.x;
-						bounding_rect.position.x = position.x;
-					}
-					else if( position.x > bounding_rect.position.x + bounding_rect.size.x ) {
-						bounding_rect.size.x = position.x - bounding_rect.position.x;
-					}
+		for( std::size_t buffer = 0; buffer < STREAM_BUFFER_COUNT; ++buffer ) {
+			const auto element_size = GetStreamElementSize( buffer, m_compact );
+			const auto base = bases[buffer];
+			const auto capacity = capacities[buffer];
 
-					if( position.y < bounding_rect.position.y ) {
-						bounding_rect.size.y += bounding_rect.position.y - position.y;
-						bounding_rect.position.y = position.y;
-					}
-					else if( position.y > bounding_rect.position.y + bounding_rect.size.y ) {
-						bounding_rect.size.y = position.y - bounding_rect.position.y;
-					}
-				}
+			if( !element_size || !capacity ) {
+				continue;
 			}
 
-			if( m_cull && !viewport_rect.findIntersection( bounding_rect ) ) {
-				m_vertex_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
-				m_color_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
-				m_texture_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+			if( m_persistent ) {
+				maps[buffer] = m_stream_maps[buffer] ? ( static_cast<char*>( m_stream_maps[buffer] ) + base * element_size ) : nullptr;
 			}
 			else {
-				for( const auto& index : indices ) {
-					m_index_data.push_back( static_cast<unsigned int>( m_last_vertex_count ) + index );
-				}
+				// The fence guarantees the GPU isn't reading from this
+				// segment anymore so there is no need to synchronize.
+				CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, buffers[buffer] ) );
+				maps[buffer] = CheckGLError( GLEXT_glMapBufferRange(
+					GLEXT_GL_ARRAY_BUFFER,
+					static_cast<GLintptr>( base * element_size ),
+					static_cast<GLsizeiptr>( capacity * element_size ),
+					GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_RANGE_BIT | GLEXT_GL_MAP_UNSYNCHRONIZED_BIT
+				) );
+			}
+		}
 
-				// Check if we need to start a new batch.
-				if( ( ( *viewport ) != ( *current_batch.viewport ) ) || ( atlas_page != current_batch.atlas_page ) ) {
-					current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-					m_batches.push_back( current_batch );
-
-					// Reset current_batch to defaults.
-					current_batch.viewport = viewport;
-					current_batch.atlas_page = atlas_page;
-					current_batch.start_index = m_last_index_count;
-					current_batch.index_count = 0;
-					current_batch.min_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-					current_batch.custom_draw = false;
-				}
+		if( m_compact ) {
+			compact_data = static_cast<priv::CompactVertex*>( maps[STREAM_VERTEX] );
+		}
+		else {
+			vertex_data = static_cast<sf::Vector2f*>( maps[STREAM_VERTEX] );
+			color_data = static_cast<sf::Color*>( maps[STREAM_COLOR] );
+			texture_data = static_cast<sf::Vector2f*>( maps[STREAM_TEXTURE] );
+		}
+
+		slot_data = static_cast<GLfloat*>( maps[STREAM_SLOT] );
+		instance_data = static_cast<priv::RendererInstance*>( maps[STREAM_INSTANCE] );
 
-				current_batch.index_count += static_cast<int>( indices.size() );
+		if( m_short_indices ) {
+			short_index_data = static_cast<GLushort*>( maps[STREAM_INDEX] );
+		}
+		else {
+			index_data = static_cast<GLuint*>( maps[STREAM_INDEX] );
+		}
+
+		if( !( compact_data || ( vertex_data && color_data && texture_data ) ) || !slot_data || !( index_data || short_index_data ) || ( m_stream_instance_capacity && !instance_data ) ) {
+#if defined( SFGUI_DEBUG )
+			std::cerr << "SFGUI warning: Failed to map streaming vertex buffers, disabling streaming.\n";
+#endif
 
-				m_last_vertex_count += static_cast<GLsizei>( vertices.size() );
-				m_last_index_count += static_cast<GLsizei>( indices.size() );
+			if( !m_persistent ) {
+				UnmapStreamSegment();
 			}
+
+			DestroyStreaming();
+
+			m_use_streaming = false;
+			m_vbo_sync_type = INVALIDATE_ALL;
+
+			index_data = nullptr;
+			short_index_data = nullptr;
+			instance_data = nullptr;
 		}
 	}
 
-	current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-	m_batches.push_back( current_batch );
+	// Immutable storage is released when streaming is disabled.
+	if( !m_vertex_vbo ) {
+		CreateBuffers();
+	}
 
-	if( !m_vertex_data.empty() && !m_color_data.empty() && !m_texture_data.empty() ) {
-		if( m_vbo_sync_type & INVALIDATE_VERTEX ) {
-			// Sync vertex data
-			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
-			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_vertex_data.size() * sizeof( sf::Vector3f ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+	if( !m_streaming ) {
+		if( m_compact ) {
+			m_compact_data.resize( vertex_total );
 
-			if( m_vertex_data.size() > 0 ) {
-				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_vertex_data.size() * sizeof( sf::Vector2f ) ), m_vertex_data.data() ) );
-			}
+			compact_data = m_compact_data.data();
 		}
+		else {
+			m_vertex_data.resize( vertex_total );
+			m_color_data.resize( vertex_total );
+			m_texture_data.resize( vertex_total );
 
-		if( m_vbo_sync_type & INVALIDATE_COLOR ) {
-			// Sync color data
-			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_color_vbo ) );
-			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_color_data.size() * sizeof( sf::Color ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
-
-			if( m_color_data.size() > 0 ) {
-				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_color_data.size() * sizeof( sf::Color ) ), m_color_data.data() ) );
-			}
+			vertex_data = m_vertex_data.data();
+			color_data = m_color_data.data();
+			texture_data = m_texture_data.data();
 		}
 
-		if( m_vbo_sync_type & INVALIDATE_TEXTURE ) {
-			// Sync texture coord data
-			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_texture_vbo ) );
-			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_texture_data.size() * sizeof( sf::Vector2f ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+		m_slot_data.resize( vertex_total * slot_components );
+		slot_data = m_slot_data.data();
 
-			if( m_texture_data.size() > 0 ) {
-				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_texture_data.size() * sizeof( sf::Vector2f ) ), m_texture_data.data() ) );
-			}
-		}
+		m_instance_data.resize( instance_total );
+		instance_data = m_instance_data.data();
 
-		if( m_vbo_sync_type & INVALIDATE_INDEX ) {
-			// Sync index data
-			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_index_vbo ) );
-			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, static_cast<int>( m_index_data.size() * sizeof( GLuint ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+		if( m_short_indices ) {
+			m_index_data.clear();
+			m_short_index_data.resize( index_total );
 
-			if( m_index_data.size() > 0 ) {
-				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<int>( m_index_data.size() * sizeof( GLuint ) ), m_index_data.data() ) );
-			}
+			short_index_data = m_short_index_data.data();
+		}
+		else {
+			m_short_index_data.clear();
+			m_index_data.resize( index_total );
 
-			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0 ) );
+			index_data = m_index_data.data();
 		}
 	}
 
-	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, 0 ) );
+	m_batches.clear();
 
-	m_vbo_sync_type = 0;
-}
+	// Slot 0 is always occupied by the default transform.
+	m_transforms.clear();
+	m_transforms.push_back( m_default_transform );
+	m_transforms_synced = false;
+	m_transform_overflow = false;
 
-void NonLegacyRenderer::InvalidateVBO( unsigned char datasets ) {
-	m_vbo_sync_type |= datasets;
-	m_vbo_synced = false;
-}
+	std::unordered_map<const RendererTransform*, std::size_t> transform_slots;
+	transform_slots[m_default_transform.get()] = 0;
+
+	// Clip slot 0 is the whole window.
+	m_clip_viewports.clear();
+	m_clip_viewports.push_back( m_default_viewport );
+
+	std::unordered_map<const RendererViewport*, std::size_t> clip_slots;
+
+	// Pages are mirrored into layers of a common size, texture
+	// coordinates are normalized by the layer size and atlas page
+	// changes no longer split batches.
+	if( m_use_texture_array ) {
+		RefreshTextureArray();
+	}
+	else if( m_texture_array ) {
+		DestroyTextureArray();
+	}
+
+	// With the depth pre-pass the opaque primitives between two custom
+	// draw callbacks are emitted first and front to back, followed by
+	// the translucent ones back to front. The depth of a primitive is
+	// given by its position in the sorted primitives, front being 0.
+	std::vector<std::pair<Primitive*, GLfloat>> draw_order;
+	draw_order.reserve( m_primitives.size() );
+
+	if( m_depth_pre_pass ) {
+		const auto depth_step = 1.f / static_cast<GLfloat>( m_primitives.size() + 1 );
+		auto segment_begin = std::size_t( 0 );
+
+		for( std::size_t index = 0; index <= m_primitives.size(); ++index ) {
+			if( ( index < m_primitives.size() ) && !m_primitives[index]->GetCustomDrawCallback() ) {
+				continue;
+			}
+
+			for( auto position = index; position > segment_begin; --position ) {
+				if( m_primitives[position - 1]->IsOpaque() ) {
+					draw_order.emplace_back( m_primitives[position - 1].get(), 1.f - static_cast<GLfloat>( position ) * depth_step );
+				}
+			}
+
+			for( auto position = segment_begin; position < index; ++position ) {
+				if( !m_primitives[position]->IsOpaque() ) {
+					draw_order.emplace_back( m_primitives[position].get(), 1.f - static_cast<GLfloat>( position + 1 ) * depth_step );
+				}
+			}
+
+			if( index < m_primitives.size() ) {
+				draw_order.emplace_back( m_primitives[index].get(), 0.f );
+			}
+
+			segment_begin = index + 1;
+		}
+	}
+	else {
+		for( const auto& primitive : m_primitives ) {
+			draw_order.emplace_back( primitive.get(), 0.f );
+		}
+	}
+
+	struct Writer : priv::RendererBatchWriter {
+		void WriteVertex( std::size_t offset, const sf::Vector2f& position, const sf::Vector2f& texture_coordinate, const sf::Color& color, int layer ) {
+			slot_data[offset * slot_components] = transform_slot;
+			slot_data[offset * slot_components + 1] = static_cast<GLfloat>( layer );
+			slot_data[offset * slot_components + 2] = clip_slot;
+			slot_data[offset * slot_components + 3] = depth;
+
+			if( compact_data ) {
+				compact_data[offset] = priv::MakeCompactVertex( position, texture_coordinate, color, texture_coordinate_scale, position_scale );
+			}
+			else {
+				vertex_data[offset] = position;
+				color_data[offset] = color;
+				texture_data[offset] = texture_coordinate;
+			}
+		}
+
+		void WriteIndex( std::size_t offset, unsigned int index ) {
+			if( short_index_data ) {
+				short_index_data[offset] = static_cast<GLushort>( index );
+			}
+			else {
+				index_data[offset] = index;
+			}
+		}
+
+		void WriteInstance( std::size_t offset, const PrimitiveInstance& instance, const sf::FloatRect& rect, const sf::FloatRect& texture_rect, int layer ) {
+			auto& record = instance_data[offset];
+
+			record.rect[0] = rect.position.x;
+			record.rect[1] = rect.position.y;
+			record.rect[2] = rect.size.x;
+			record.rect[3] = rect.size.y;
+			record.texture_rect[0] = texture_rect.position.x;
+			record.texture_rect[1] = texture_rect.position.y;
+			record.texture_rect[2] = texture_rect.size.x;
+			record.texture_rect[3] = texture_rect.size.y;
+			record.color = instance.color;
+			record.light_border_color = instance.light_border_color;
+			record.dark_border_color = instance.dark_border_color;
+			record.border_width = instance.border_width;
+			record.transform_slot = transform_slot;
+			record.layer = static_cast<GLfloat>( layer );
+			record.clip_slot = clip_slot;
+			record.depth = depth;
+			record.distance_field = instance.distance_field ? 1.f : 0.f;
+		}
+
+		priv::CompactVertex* compact_data;
+		sf::Vector2f* vertex_data;
+		sf::Color* color_data;
+		sf::Vector2f* texture_data;
+		GLfloat* slot_data;
+		GLuint* index_data;
+		GLushort* short_index_data;
+		priv::RendererInstance* instance_data;
+		float position_scale;
+
+		// Slots of the primitive being added.
+		GLfloat transform_slot;
+		GLfloat clip_slot;
+		GLfloat depth;
+	} writer;
+
+	writer.compact_data = compact_data;
+	writer.vertex_data = vertex_data;
+	writer.color_data = color_data;
+	writer.texture_data = texture_data;
+	writer.slot_data = slot_data;
+	writer.index_data = index_data;
+	writer.short_index_data = short_index_data;
+	writer.instance_data = instance_data;
+	writer.position_scale = m_position_scale;
+
+	priv::RendererBatchBuilder builder( m_batches, m_texture_atlas, GetMaxTextureSize(), m_default_viewport, m_window_size );
+	builder.SetCull( m_cull );
+	builder.SetShortIndices( m_short_indices );
+
+	if( m_layered ) {
+		builder.SetLayerSize( m_texture_array_size );
+	}
+
+	const sf::FloatRect window_viewport( { 0.f, 0.f }, sf::Vector2f( m_window_size ) );
+
+	for( const auto& entry : draw_order ) {
+		auto primitive = entry.first;
+		const auto depth = entry.second;
+		const auto opaque = m_depth_pre_pass && primitive->IsOpaque();
+
+		primitive->SetSynced();
+
+		if( !primitive->IsVisible() ) {
+			continue;
+		}
+
+		auto position_transform = primitive->GetPosition();
+
+		auto viewport = primitive->GetViewport();
+
+		// Look up the slot of the primitive's transform. If we run out of
+		// slots the offset is baked into the vertices instead.
+		const auto& transform = primitive->GetTransform();
+		auto transform_slot = std::size_t( 0 );
+		sf::Vector2f transform_offset( 0.f, 0.f );
+
+		if( transform && ( transform != m_default_transform ) ) {
+			transform_offset = transform->GetOffset();
+
+			auto slot_iter = transform_slots.find( transform.get() );
+
+			if( slot_iter != transform_slots.end() ) {
+				transform_slot = slot_iter->second;
+			}
+			else if( m_transforms.size() < max_transforms ) {
+				transform_slot = m_transforms.size();
+				transform_slots[transform.get()] = transform_slot;
+				m_transforms.push_back( transform );
+			}
+			else {
+				m_transform_overflow = true;
+			}
+		}
+
+		auto viewport_rect = window_viewport;
+
+		// Primitives clipped in the shader are batched as if they
+		// were in the default viewport.
+		auto batch_viewport = viewport;
+		auto clip_slot = std::size_t( 0 );
+		sf::Vector2f clip_offset( 0.f, 0.f );
+
+		// Check if primitive needs to be rendered in a custom viewport.
+		if( viewport && ( ( *viewport ) != ( *m_default_viewport ) ) ) {
+			auto destination_origin = viewport->GetAbsoluteDestinationOrigin();
+			auto size = viewport->GetSize();
+
+			clip_offset = destination_origin - viewport->GetSourceOrigin();
+
+			// Look up the clip slot of the viewport. If we run out of
+			// slots the primitive is clipped with the scissor test instead.
+			if( m_use_shader_clipping ) {
+				auto slot_iter = clip_slots.find( viewport.get() );
+
+				if( slot_iter != clip_slots.end() ) {
+					clip_slot = slot_iter->second;
+				}
+				else if( m_clip_viewports.size() < max_clip_rects ) {
+					clip_slot = m_clip_viewports.size();
+					clip_slots[viewport.get()] = clip_slot;
+					m_clip_viewports.push_back( viewport );
+				}
+			}
+
+			// Vertices of primitives that got a clip slot stay in
+			// source coordinates, the shader adds the offset.
+			if( clip_slot ) {
+				batch_viewport = m_default_viewport;
+
+				if( m_cull ) {
+					viewport_rect = { viewport->GetSourceOrigin(), size };
+				}
+			}
+			else {
+				position_transform += clip_offset;
+
+				if( m_cull ) {
+					viewport_rect = { destination_origin, size };
+				}
+			}
+		}
+		else {
+			position_transform += transform_offset;
+		}
+
+		// Vertices of primitives that got a slot are stored relative
+		// to their transform, the shader adds the offset back.
+		if( transform_slot ) {
+			position_transform -= transform_offset;
+			viewport_rect.position -= transform_offset;
+
+			// Compact positions are clamped, which is only harmless in
+			// target coordinates. Bake the offset if they don't fit.
+			if( m_compact && !priv::CompactPositionsFit( primitive->GetVertices(), position_transform, m_position_scale ) ) {
+				position_transform += transform_offset;
+				viewport_rect.position += transform_offset;
+				transform_slot = 0;
+				m_transform_overflow = true;
+			}
+		}
+
+		if( clip_slot && m_compact && !priv::CompactPositionsFit( primitive->GetVertices(), position_transform, m_position_scale ) ) {
+			position_transform += clip_offset;
+			viewport_rect.position += clip_offset;
+			batch_viewport = viewport;
+			clip_slot = 0;
+		}
+
+		if( primitive->GetCustomDrawCallback() ) {
+			builder.AddCustomDraw( *primitive );
+			continue;
+		}
+
+		priv::RendererBatchPlacement placement;
+		placement.viewport = batch_viewport;
+		placement.offset = position_transform;
+		placement.cull_rect = viewport_rect;
+		placement.opaque = opaque;
+
+		writer.transform_slot = static_cast<GLfloat>( transform_slot );
+		writer.clip_slot = static_cast<GLfloat>( clip_slot );
+		writer.depth = depth;
+
+		builder.Add( *primitive, placement, writer );
+	}
+
+	builder.Finish();
+
+	m_last_vertex_count = builder.GetVertexCount();
+	m_last_index_count = builder.GetIndexCount();
+	m_last_instance_count = builder.GetInstanceCount();
+
+	if( !m_streaming ) {
+		// Drop the instances of culled primitives.
+		m_instance_data.resize( static_cast<std::size_t>( m_last_instance_count ) );
+	}
+	else {
+		m_instance_data.clear();
+	}
+
+	if( !m_instance_data.empty() ) {
+		// Sync instance data
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_instance_vbo ) );
+		CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_instance_data.size() * sizeof( priv::RendererInstance ) ), m_instance_data.data(), GLEXT_GL_DYNAMIC_DRAW ) );
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, 0 ) );
+
+		SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_instance_data.size() * sizeof( priv::RendererInstance ) );
+	}
+
+	if( m_streaming ) {
+		if( !m_persistent ) {
+			UnmapStreamSegment();
+		}
+
+		// Point the attributes at the freshly written segment.
+		if( GLEXT_glIsVertexArray( m_vao ) ) {
+			CheckGLError( GLEXT_glBindVertexArray( m_vao ) );
+			SetupAttributes( 0 );
+			CheckGLError( GLEXT_glBindVertexArray( 0 ) );
+		}
+
+		SFGUI_PROFILE_COUNT( UPLOADED_BYTES, static_cast<std::size_t>( m_last_vertex_count ) * ( GetStreamElementSize( STREAM_VERTEX, m_compact ) + GetStreamElementSize( STREAM_COLOR, m_compact ) + GetStreamElementSize( STREAM_TEXTURE, m_compact ) + GetStreamElementSize( STREAM_SLOT, m_compact ) ) + static_cast<std::size_t>( m_last_index_count ) * ( m_short_indices ? sizeof( GLushort ) : sizeof( GLuint ) ) + static_cast<std::size_t>( m_last_instance_count ) * sizeof( priv::RendererInstance ) );
+		SFGUI_PROFILE_COUNT( UPLOADED_VERTICES, static_cast<std::size_t>( m_last_vertex_count ) );
+
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, 0 ) );
+
+		m_vbo_sync_type = 0;
+
+		return;
+	}
+
+	if( m_compact ) {
+		m_compact_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+	}
+	else {
+		m_vertex_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+		m_color_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+		m_texture_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+	}
+
+	m_slot_data.resize( static_cast<std::size_t>( m_last_vertex_count ) * slot_components );
+
+	if( m_short_indices ) {
+		m_short_index_data.resize( static_cast<std::size_t>( m_last_index_count ) );
+	}
+	else {
+		m_index_data.resize( static_cast<std::size_t>( m_last_index_count ) );
+	}
+
+	if( !m_compact_data.empty() || ( !m_vertex_data.empty() && !m_color_data.empty() && !m_texture_data.empty() ) ) {
+		if( m_compact && ( m_vbo_sync_type & ( INVALIDATE_VERTEX | INVALIDATE_COLOR | INVALIDATE_TEXTURE ) ) ) {
+			// Sync interleaved vertex data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_compact_data.size() * sizeof( priv::CompactVertex ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+			CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_compact_data.size() * sizeof( priv::CompactVertex ) ), m_compact_data.data() ) );
+
+			SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_compact_data.size() * sizeof( priv::CompactVertex ) );
+			SFGUI_PROFILE_COUNT( UPLOADED_VERTICES, m_compact_data.size() );
+		}
+
+		if( !m_compact && ( m_vbo_sync_type & INVALIDATE_VERTEX ) ) {
+			// Sync vertex data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_vertex_data.size() * sizeof( sf::Vector3f ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_vertex_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_vertex_data.size() * sizeof( sf::Vector2f ) ), m_vertex_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_vertex_data.size() * sizeof( sf::Vector2f ) );
+				SFGUI_PROFILE_COUNT( UPLOADED_VERTICES, m_vertex_data.size() );
+			}
+		}
+
+		if( m_vbo_sync_type & ( INVALIDATE_VERTEX | INVALIDATE_TEXTURE ) ) {
+			// Sync transform slot and layer data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_slot_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_slot_data.size() * sizeof( GLfloat ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_slot_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_slot_data.size() * sizeof( GLfloat ) ), m_slot_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_slot_data.size() * sizeof( GLfloat ) );
+			}
+		}
+
+		if( !m_compact && ( m_vbo_sync_type & INVALIDATE_COLOR ) ) {
+			// Sync color data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_color_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_color_data.size() * sizeof( sf::Color ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_color_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_color_data.size() * sizeof( sf::Color ) ), m_color_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_color_data.size() * sizeof( sf::Color ) );
+			}
+		}
+
+		if( !m_compact && ( m_vbo_sync_type & INVALIDATE_TEXTURE ) ) {
+			// Sync texture coord data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_texture_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_texture_data.size() * sizeof( sf::Vector2f ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_texture_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_texture_data.size() * sizeof( sf::Vector2f ) ), m_texture_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_texture_data.size() * sizeof( sf::Vector2f ) );
+			}
+		}
+
+		if( m_short_indices && ( m_vbo_sync_type & INVALIDATE_INDEX ) ) {
+			// Sync 16-bit index data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_index_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, static_cast<int>( m_short_index_data.size() * sizeof( GLushort ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_short_index_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<int>( m_short_index_data.size() * sizeof( GLushort ) ), m_short_index_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_short_index_data.size() * sizeof( GLushort ) );
+			}
+
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0 ) );
+		}
+
+		if( !m_short_indices && ( m_vbo_sync_type & INVALIDATE_INDEX ) ) {
+			// Sync index data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_index_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, static_cast<int>( m_index_data.size() * sizeof( GLuint ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_index_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<int>( m_index_data.size() * sizeof( GLuint ) ), m_index_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_index_data.size() * sizeof( GLuint ) );
+			}
+
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0 ) );
+		}
+	}
+
+	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, 0 ) );
+
+	m_vbo_sync_type = 0;
+}
+
+void NonLegacyRenderer::InvalidateVBO( unsigned char datasets ) {
+	m_vbo_sync_type |= datasets;
+	m_vbo_synced = false;
+}
+
+void NonLegacyRenderer::RefreshTransforms() {
+	std::vector<GLfloat> offsets;
+	offsets.reserve( m_transforms.size() * 2 );
+
+	for( const auto& transform : m_transforms ) {
+		offsets.push_back( transform->GetOffset().x );
+		offsets.push_back( transform->GetOffset().y );
+	}
+
+	CheckGLError( GLEXT_glUniform2fv( m_transforms_location, static_cast<GLsizei>( m_transforms.size() ), offsets.data() ) );
+
+	m_transforms_synced = true;
+}
+
+void NonLegacyRenderer::RefreshClipRects() {
+	// Viewport destinations can be relative to a transform so
+	// the clip rects are refreshed together with the transforms.
+	std::vector<GLfloat> rects;
+	std::vector<GLfloat> offsets;
+	rects.reserve( m_clip_viewports.size() * 4 );
+	offsets.reserve( m_clip_viewports.size() * 2 );
+
+	// Slot 0 doesn't clip anything the window wouldn't.
+	rects.push_back( 0.f );
+	rects.push_back( 0.f );
+	rects.push_back( static_cast<GLfloat>( m_window_size.x ) );
+	rects.push_back( static_cast<GLfloat>( m_window_size.y ) );
+	offsets.push_back( 0.f );
+	offsets.push_back( 0.f );
+
+	for( std::size_t slot = 1; slot < m_clip_viewports.size(); ++slot ) {
+		const auto& viewport = m_clip_viewports[slot];
+		const auto destination_origin = viewport->GetAbsoluteDestinationOrigin();
+		const auto offset = destination_origin - viewport->GetSourceOrigin();
+
+		rects.push_back( destination_origin.x );
+		rects.push_back( destination_origin.y );
+		rects.push_back( viewport->GetSize().x );
+		rects.push_back( viewport->GetSize().y );
+		offsets.push_back( offset.x );
+		offsets.push_back( offset.y );
+	}
+
+	CheckGLError( GLEXT_glUniform4fv( m_clip_rects_location, static_cast<GLsizei>( m_clip_viewports.size() ), rects.data() ) );
+	CheckGLError( GLEXT_glUniform2fv( m_clip_offsets_location, static_cast<GLsizei>( m_clip_viewports.size() ), offsets.data() ) );
+}
 
 void NonLegacyRenderer::SetupFBO( int width, int height ) {
 	if( !m_use_fbo || !width || !height ) {
@@ -953,6 +2030,327 @@ void NonLegacyRenderer::DestroyFBO() {
 	}
 }
 
+void NonLegacyRenderer::RefreshTextureArray() {
+	sf::Vector2u layer_size( 0u, 0u );
+
+	for( const auto& page : m_texture_atlas ) {
+		layer_size.x = std::max( layer_size.x, page->getSize().x );
+		layer_size.y = std::max( layer_size.y, page->getSize().y );
+	}
+
+	const auto layers = m_texture_atlas.size();
+
+	if( layers > static_cast<std::size_t>( m_max_texture_array_layers ) ) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "SFGUI warning: Atlas has more pages than texture array layers, binding pages separately.\n";
+#endif
+
+		m_layered = false;
+
+		return;
+	}
+
+	if( !m_texture_array || ( layer_size != m_texture_array_size ) || ( layers != m_texture_array_revisions.size() ) ) {
+		auto previous_texture = 0;
+		CheckGLError( glGetIntegerv( GLEXT_GL_TEXTURE_BINDING_2D_ARRAY, &previous_texture ) );
+
+		if( !m_texture_array ) {
+			CheckGLError( glGenTextures( 1, &m_texture_array ) );
+			CheckGLError( GLEXT_glGenFramebuffers( 1, &m_texture_array_frame_buffer ) );
+		}
+
+		CheckGLError( glBindTexture( GLEXT_GL_TEXTURE_2D_ARRAY, m_texture_array ) );
+		CheckGLError( glTexImage3D( GLEXT_GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, static_cast<GLsizei>( layer_size.x ), static_cast<GLsizei>( layer_size.y ), static_cast<GLsizei>( layers ), 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr ) );
+		CheckGLError( glTexParameteri( GLEXT_GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE ) );
+		CheckGLError( glTexParameteri( GLEXT_GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE ) );
+		CheckGLError( glTexParameteri( GLEXT_GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST ) );
+		CheckGLError( glTexParameteri( GLEXT_GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST ) );
+		CheckGLError( glBindTexture( GLEXT_GL_TEXTURE_2D_ARRAY, static_cast<unsigned int>( previous_texture ) ) );
+
+		m_texture_array_size = layer_size;
+
+		// Reallocating discards the contents, copy every page again.
+		m_texture_array_revisions.resize( layers );
+
+		for( std::size_t page = 0; page < layers; ++page ) {
+			m_texture_array_revisions[page] = m_atlas_page_revisions[page] + 1;
+		}
+	}
+
+	m_layered = true;
+
+	CopyTextureArrayPages();
+}
+
+void NonLegacyRenderer::CopyTextureArrayPages() {
+	auto previous_frame_buffer = 0;
+	auto previous_texture = 0;
+	auto bound = false;
+
+	for( std::size_t page = 0; page < m_texture_array_revisions.size(); ++page ) {
+		if( m_texture_array_revisions[page] == m_atlas_page_revisions[page] ) {
+			continue;
+		}
+
+		if( !bound ) {
+			CheckGLError( glGetIntegerv( GLEXT_GL_FRAMEBUFFER_BINDING, &previous_frame_buffer ) );
+			CheckGLError( glGetIntegerv( GLEXT_GL_TEXTURE_BINDING_2D_ARRAY, &previous_texture ) );
+
+			CheckGLError( GLEXT_glBindFramebuffer( GLEXT_GL_FRAMEBUFFER, m_texture_array_frame_buffer ) );
+			CheckGLError( glBindTexture( GLEXT_GL_TEXTURE_2D_ARRAY, m_texture_array ) );
+
+			bound = true;
+		}
+
+		// Copy the page on the GPU, no need to download it first.
+		const auto& texture = m_texture_atlas[page];
+
+		CheckGLError( GLEXT_glFramebufferTexture2D( GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture->getNativeHandle(), 0 ) );
+
+		auto status = CheckGLError( GLEXT_glCheckFramebufferStatus( GLEXT_GL_FRAMEBUFFER ) );
+
+		if( status != GLEXT_GL_FRAMEBUFFER_COMPLETE ) {
+#if defined( SFGUI_DEBUG )
+			std::cerr << "GLEXT_glCheckFramebufferStatus() returned error " << status << ", disabling texture array.\n";
+#endif
+
+			m_use_texture_array = false;
+			m_layered = false;
+
+			Invalidate( INVALIDATE_TEXTURE );
+
+			break;
+		}
+
+		CheckGLError( glCopyTexSubImage3D( GLEXT_GL_TEXTURE_2D_ARRAY, 0, 0, 0, static_cast<GLint>( page ), 0, 0, static_cast<GLsizei>( texture->getSize().x ), static_cast<GLsizei>( texture->getSize().y ) ) );
+
+		m_texture_array_revisions[page] = m_atlas_page_revisions[page];
+	}
+
+	if( bound ) {
+		CheckGLError( GLEXT_glFramebufferTexture2D( GLEXT_GL_FRAMEBUFFER, GLEXT_GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0 ) );
+		CheckGLError( GLEXT_glBindFramebuffer( GLEXT_GL_FRAMEBUFFER, static_cast<unsigned int>( previous_frame_buffer ) ) );
+		CheckGLError( glBindTexture( GLEXT_GL_TEXTURE_2D_ARRAY, static_cast<unsigned int>( previous_texture ) ) );
+	}
+}
+
+void NonLegacyRenderer::FlushImageUploads() {
+	if( m_pixel_buffers.empty() ) {
+		m_pixel_buffers.resize( pixel_buffer_count, 0 );
+		CheckGLError( GLEXT_glGenBuffers( static_cast<GLsizei>( pixel_buffer_count ), m_pixel_buffers.data() ) );
+	}
+
+	auto previous_texture = 0;
+	CheckGLError( glGetIntegerv( GL_TEXTURE_BINDING_2D, &previous_texture ) );
+
+	for( const auto& upload : m_image_uploads ) {
+		const auto& size = upload.image.getSize();
+		const auto bytes = static_cast<std::size_t>( size.x ) * size.y * 4;
+
+		// Consecutive uploads go through different buffers so one
+		// the driver is still transferring from isn't written to.
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_PIXEL_UNPACK_BUFFER, m_pixel_buffers[m_pixel_buffer_index] ) );
+
+		m_pixel_buffer_index = ( m_pixel_buffer_index + 1 ) % pixel_buffer_count;
+
+		// Orphan the previous storage, if the driver is still reading
+		// from it we get fresh memory instead of having to wait.
+		CheckGLError( GLEXT_glBufferData( GLEXT_GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>( bytes ), 0, GLEXT_GL_STREAM_DRAW ) );
+
+		auto written = false;
+
+		if( map_buffer_range_supported ) {
+			auto map = CheckGLError( GLEXT_glMapBufferRange(
+				GLEXT_GL_PIXEL_UNPACK_BUFFER,
+				0,
+				static_cast<GLsizeiptr>( bytes ),
+				GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_INVALIDATE_BUFFER_BIT | GLEXT_GL_MAP_UNSYNCHRONIZED_BIT
+			) );
+
+			if( map ) {
+				std::copy( upload.image.getPixelsPtr(), upload.image.getPixelsPtr() + bytes, static_cast<std::uint8_t*>( map ) );
+
+				written = CheckGLError( GLEXT_glUnmapBuffer( GLEXT_GL_PIXEL_UNPACK_BUFFER ) );
+			}
+		}
+
+		if( !written ) {
+			CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>( bytes ), upload.image.getPixelsPtr() ) );
+		}
+
+		// Sourced from the bound buffer, the call returns before the transfer is done.
+		CheckGLError( glBindTexture( GL_TEXTURE_2D, m_texture_atlas[upload.page]->getNativeHandle() ) );
+		CheckGLError( glTexSubImage2D( GL_TEXTURE_2D, 0, static_cast<GLint>( upload.position.x ), static_cast<GLint>( upload.position.y ), static_cast<GLsizei>( size.x ), static_cast<GLsizei>( size.y ), GL_RGBA, GL_UNSIGNED_BYTE, 0 ) );
+
+		// The page was marked as written when the update was queued,
+		// mark it again in case it was copied in the meantime.
+		++m_atlas_page_revisions[upload.page];
+
+		SFGUI_PROFILE_COUNT( UPLOADED_BYTES, bytes );
+	}
+
+	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_PIXEL_UNPACK_BUFFER, 0 ) );
+	CheckGLError( glBindTexture( GL_TEXTURE_2D, static_cast<unsigned int>( previous_texture ) ) );
+
+	m_image_uploads.clear();
+}
+
+void NonLegacyRenderer::DestroyTextureArray() {
+	if( m_texture_array_frame_buffer ) {
+		CheckGLError( GLEXT_glDeleteFramebuffers( 1, &m_texture_array_frame_buffer ) );
+		m_texture_array_frame_buffer = 0;
+	}
+
+	if( m_texture_array ) {
+		CheckGLError( glDeleteTextures( 1, &m_texture_array ) );
+		m_texture_array = 0;
+	}
+
+	m_texture_array_revisions.clear();
+	m_texture_array_size = sf::Vector2u( 0u, 0u );
+	m_layered = false;
+}
+
+void NonLegacyRenderer::CreateBuffers() {
+	CheckGLError( GLEXT_glGenBuffers( 1, &m_vertex_vbo ) );
+	CheckGLError( GLEXT_glGenBuffers( 1, &m_color_vbo ) );
+	CheckGLError( GLEXT_glGenBuffers( 1, &m_texture_vbo ) );
+	CheckGLError( GLEXT_glGenBuffers( 1, &m_slot_vbo ) );
+	CheckGLError( GLEXT_glGenBuffers( 1, &m_index_vbo ) );
+
+	if( instancing_supported ) {
+		CheckGLError( GLEXT_glGenBuffers( 1, &m_instance_vbo ) );
+	}
+}
+
+void NonLegacyRenderer::DestroyBuffers() {
+	CheckGLError( GLEXT_glDeleteBuffers( 1, &m_instance_vbo ) );
+	CheckGLError( GLEXT_glDeleteBuffers( 1, &m_index_vbo ) );
+	CheckGLError( GLEXT_glDeleteBuffers( 1, &m_slot_vbo ) );
+	CheckGLError( GLEXT_glDeleteBuffers( 1, &m_texture_vbo ) );
+	CheckGLError( GLEXT_glDeleteBuffers( 1, &m_color_vbo ) );
+	CheckGLError( GLEXT_glDeleteBuffers( 1, &m_vertex_vbo ) );
+
+	m_instance_vbo = 0;
+	m_index_vbo = 0;
+	m_slot_vbo = 0;
+	m_texture_vbo = 0;
+	m_color_vbo = 0;
+	m_vertex_vbo = 0;
+}
+
+void NonLegacyRenderer::SetupStreaming( std::size_t vertex_capacity, std::size_t index_capacity, std::size_t instance_capacity ) {
+	DestroyStreaming();
+
+	if( !m_vertex_vbo ) {
+		CreateBuffers();
+	}
+
+	m_persistent = buffer_storage_supported;
+
+	const unsigned int buffers[] = { m_vertex_vbo, m_color_vbo, m_texture_vbo, m_slot_vbo, m_index_vbo, m_instance_vbo };
+	const std::size_t capacities[] = { vertex_capacity, vertex_capacity, vertex_capacity, vertex_capacity, index_capacity, instance_capacity };
+
+	for( std::size_t buffer = 0; buffer < STREAM_BUFFER_COUNT; ++buffer ) {
+		const auto size = static_cast<GLsizeiptr>( stream_segments * capacities[buffer] * GetStreamElementSize( buffer, m_compact ) );
+
+		// Keep the table indexed by buffer even for unused buffers.
+		if( !size ) {
+			m_stream_maps.push_back( nullptr );
+			continue;
+		}
+
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, buffers[buffer] ) );
+
+		if( m_persistent ) {
+			const GLbitfield flags = GLEXT_GL_MAP_WRITE_BIT | GLEXT_GL_MAP_PERSISTENT_BIT | GLEXT_GL_MAP_COHERENT_BIT;
+
+			CheckGLError( GLEXT_glBufferStorage( GLEXT_GL_ARRAY_BUFFER, size, nullptr, flags ) );
+			auto map = CheckGLError( GLEXT_glMapBufferRange( GLEXT_GL_ARRAY_BUFFER, 0, size, flags ) );
+			m_stream_maps.push_back( map );
+		}
+		else {
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, size, 0, GLEXT_GL_DYNAMIC_DRAW ) );
+		}
+	}
+
+	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, 0 ) );
+
+	m_stream_fences.assign( stream_segments, nullptr );
+	m_stream_vertex_capacity = vertex_capacity;
+	m_stream_index_capacity = index_capacity;
+	m_stream_instance_capacity = instance_capacity;
+	m_stream_segment = 0;
+	m_streaming = true;
+}
+
+void NonLegacyRenderer::DestroyStreaming() {
+	if( !m_streaming ) {
+		return;
+	}
+
+	for( auto fence : m_stream_fences ) {
+		if( fence ) {
+			CheckGLError( GLEXT_glDeleteSync( static_cast<GLsync>( fence ) ) );
+		}
+	}
+
+	m_stream_fences.clear();
+
+	// Buffers with immutable storage can't be respecified,
+	// they are recreated before they are used again.
+	if( m_persistent ) {
+		UnmapStreamSegment();
+		DestroyBuffers();
+	}
+
+	m_stream_maps.clear();
+
+	// The vertex array objects still point into the old segment.
+	if( m_vao ) {
+		CheckGLError( GLEXT_glDeleteVertexArrays( 1, &m_vao ) );
+		m_vao = 0;
+	}
+
+	if( m_instance_vao ) {
+		CheckGLError( GLEXT_glDeleteVertexArrays( 1, &m_instance_vao ) );
+		m_instance_vao = 0;
+	}
+
+	m_stream_vertex_capacity = 0;
+	m_stream_index_capacity = 0;
+	m_stream_instance_capacity = 0;
+	m_stream_segment = 0;
+	m_stream_vertex_base = 0;
+	m_stream_index_base = 0;
+	m_stream_instance_base = 0;
+	m_streaming = false;
+	m_persistent = false;
+}
+
+void NonLegacyRenderer::UnmapStreamSegment() {
+	const unsigned int buffers[] = { m_vertex_vbo, m_color_vbo, m_texture_vbo, m_slot_vbo, m_index_vbo, m_instance_vbo };
+
+	for( std::size_t buffer = 0; buffer < STREAM_BUFFER_COUNT; ++buffer ) {
+		// Instances only have a segment if instancing was in use.
+		if( !GetStreamElementSize( buffer, m_compact ) || ( ( buffer == STREAM_INSTANCE ) && !m_stream_instance_capacity ) ) {
+			continue;
+		}
+
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, buffers[buffer] ) );
+
+		auto unmapped = CheckGLError( GLEXT_glUnmapBuffer( GLEXT_GL_ARRAY_BUFFER ) );
+
+		if( !unmapped ) {
+#if defined( SFGUI_DEBUG )
+			std::cerr << "SFGUI warning: Streaming vertex buffer contents were lost.\n";
+#endif
+		}
+	}
+
+	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, 0 ) );
+}
+
 void NonLegacyRenderer::TuneCull( bool enable ) {
 	m_cull = enable;
 }
@@ -974,10 +2372,140 @@ void NonLegacyRenderer::TuneUseFBO( bool enable ) {
 	}
 }
 
+void NonLegacyRenderer::TuneStreaming( bool enable ) {
+	if( !( map_buffer_range_supported && sync_supported ) && enable ) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "Buffer mapping or sync extension unavailable.\n";
+#endif
+	}
+
+	m_use_streaming = enable && map_buffer_range_supported && sync_supported;
+
+	// The buffers are switched over during the next refresh
+	// when we are sure to have an active context.
+	Invalidate( INVALIDATE_ALL );
+}
+
+void NonLegacyRenderer::TuneInstancing( bool enable ) {
+	if( !instancing_supported && enable ) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "Instancing extensions unavailable.\n";
+#endif
+	}
+
+	auto distance_field_text = UsesDistanceFieldText();
+
+	m_use_instancing = enable && instancing_supported;
+
+	Invalidate( INVALIDATE_ALL );
+
+	// Distance field glyphs can't be expanded into plain quads,
+	// re-create all text with the glyphs of the new mode.
+	if( UsesDistanceFieldText() != distance_field_text ) {
+		Widget::RefreshAll();
+	}
+}
+
+void NonLegacyRenderer::TuneTextureArray( bool enable ) {
+	if( !texture_array_supported && enable ) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "Texture array extensions unavailable.\n";
+#endif
+	}
+
+	m_use_texture_array = enable && texture_array_supported;
+
+	Invalidate( INVALIDATE_ALL );
+}
+
+void NonLegacyRenderer::TuneDepthPrePass( bool enable ) {
+	m_use_depth_pre_pass = enable;
+}
+
+void NonLegacyRenderer::TuneShaderClipping( bool enable ) {
+	m_use_shader_clipping = enable;
+
+	Invalidate( INVALIDATE_ALL );
+}
+
+void NonLegacyRenderer::TuneImageStreaming( bool enable ) {
+	if( !pixel_buffer_supported && enable ) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "Pixel buffer extension unavailable.\n";
+#endif
+	}
+
+	// Updates that are already queued are still uploaded during the next display.
+	m_use_image_streaming = enable && pixel_buffer_supported;
+}
+
+void NonLegacyRenderer::TuneDistanceFieldText( bool enable ) {
+	if( !m_use_instancing && enable ) {
+#if defined( SFGUI_DEBUG )
+		std::cerr << "Distance field text requires instancing.\n";
+#endif
+	}
+
+	auto distance_field_text = UsesDistanceFieldText();
+
+	m_use_distance_field_text = enable;
+
+	if( UsesDistanceFieldText() != distance_field_text ) {
+		Widget::RefreshAll();
+	}
+}
+
 void NonLegacyRenderer::InvalidateImpl( unsigned char datasets ) {
+	if( datasets & INVALIDATE_TRANSFORM ) {
+		// Transform offsets are applied in the shader so moving a
+		// hierarchy only requires a redraw. Primitives that didn't
+		// get a slot and culled primitives still need a full refresh.
+		m_transforms_synced = false;
+		m_force_redraw = true;
+
+		if( m_transform_overflow || m_cull ) {
+			datasets |= INVALIDATE_VERTEX;
+		}
+
+		datasets &= static_cast<unsigned char>( ~INVALIDATE_TRANSFORM );
+
+		if( !datasets ) {
+			return;
+		}
+	}
+
 	InvalidateVBO( datasets );
 }
 
+void NonLegacyRenderer::UpdateAtlasPage( std::size_t page, const sf::Vector2u& position, const sf::Image& data ) {
+	// Cached frames and texture array layers have to be refreshed either way.
+	m_force_redraw = true;
+
+	if( !m_use_image_streaming ) {
+		// Don't let an older queued update overwrite this one.
+		DiscardAtlasPageUpdates( page, position );
+
+		Renderer::UpdateAtlasPage( page, position, data );
+		return;
+	}
+
+	// Images updated faster than we display only upload their latest data.
+	for( auto& upload : m_image_uploads ) {
+		if( ( upload.page == page ) && ( upload.position == position ) ) {
+			upload.image = data;
+			return;
+		}
+	}
+
+	m_image_uploads.push_back( { page, position, data } );
+}
+
+void NonLegacyRenderer::DiscardAtlasPageUpdates( std::size_t page, const sf::Vector2u& position ) {
+	m_image_uploads.erase( std::remove_if( m_image_uploads.begin(), m_image_uploads.end(), [&]( const priv::RendererImageUpload& upload ) {
+		return ( upload.page == page ) && ( upload.position == position );
+	} ), m_image_uploads.end() );
+}
+
 void NonLegacyRenderer::SetupVAO() {
 	CheckGLError( GLEXT_glGenVertexArrays( 1, &m_vao ) );
 	CheckGLError( GLEXT_glBindVertexArray( m_vao ) );
@@ -985,25 +2513,20 @@ void NonLegacyRenderer::SetupVAO() {
 	assert( m_vertex_vbo != 0 );
 	assert( m_color_vbo != 0 );
 	assert( m_texture_vbo != 0 );
+	assert( m_slot_vbo != 0 );
 	assert( m_index_vbo != 0 );
 	assert( m_vao != 0 );
 
-	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
 	CheckGLError( GLEXT_glEnableVertexAttribArray( m_vertex_location ) );
-	CheckGLError( GLEXT_glVertexAttribPointer( m_vertex_location, 2, GL_FLOAT, GL_FALSE, 0, 0 ) );
-
-	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_color_vbo ) );
 	CheckGLError( GLEXT_glEnableVertexAttribArray( m_color_location ) );
-	CheckGLError( GLEXT_glVertexAttribPointer( m_color_location, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0 ) );
-
-	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_texture_vbo ) );
 	CheckGLError( GLEXT_glEnableVertexAttribArray( m_texture_coordinate_location ) );
-	CheckGLError( GLEXT_glVertexAttribPointer( m_texture_coordinate_location, 2, GL_FLOAT, GL_FALSE, 0, 0 ) );
+	CheckGLError( GLEXT_glEnableVertexAttribArray( m_slot_location ) );
 
-	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_index_vbo ) );
+	SetupAttributes( 0 );
 
 	CheckGLError( GLEXT_glBindVertexArray( 0 ) );
 
+	CheckGLError( GLEXT_glDisableVertexAttribArray( m_slot_location ) );
 	CheckGLError( GLEXT_glDisableVertexAttribArray( m_texture_coordinate_location ) );
 	CheckGLError( GLEXT_glDisableVertexAttribArray( m_color_location ) );
 	CheckGLError( GLEXT_glDisableVertexAttribArray( m_vertex_location ) );
@@ -1012,6 +2535,91 @@ void NonLegacyRenderer::SetupVAO() {
 	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, 0 ) );
 }
 
+void NonLegacyRenderer::SetupAttributes( std::size_t base_vertex ) {
+	// When streaming, the attributes start at the current segment.
+	auto offset = [&]( std::size_t element_size ) {
+		return reinterpret_cast<const GLvoid*>( ( m_stream_vertex_base + base_vertex ) * element_size );
+	};
+
+	if( m_compact ) {
+		const auto stride = static_cast<GLsizei>( sizeof( priv::CompactVertex ) );
+		const auto base = static_cast<const char*>( offset( sizeof( priv::CompactVertex ) ) );
+
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
+		CheckGLError( GLEXT_glVertexAttribPointer( m_vertex_location, 2, GL_SHORT, GL_FALSE, stride, base + offsetof( priv::CompactVertex, x ) ) );
+		CheckGLError( GLEXT_glVertexAttribPointer( m_color_location, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, base + offsetof( priv::CompactVertex, color ) ) );
+		CheckGLError( GLEXT_glVertexAttribPointer( m_texture_coordinate_location, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride, base + offsetof( priv::CompactVertex, u ) ) );
+	}
+	else {
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
+		CheckGLError( GLEXT_glVertexAttribPointer( m_vertex_location, 2, GL_FLOAT, GL_FALSE, 0, offset( sizeof( sf::Vector2f ) ) ) );
+
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_color_vbo ) );
+		CheckGLError( GLEXT_glVertexAttribPointer( m_color_location, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, offset( sizeof( sf::Color ) ) ) );
+
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_texture_vbo ) );
+		CheckGLError( GLEXT_glVertexAttribPointer( m_texture_coordinate_location, 2, GL_FLOAT, GL_FALSE, 0, offset( sizeof( sf::Vector2f ) ) ) );
+	}
+
+	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_slot_vbo ) );
+	CheckGLError( GLEXT_glVertexAttribPointer( m_slot_location, static_cast<GLint>( slot_components ), GL_FLOAT, GL_FALSE, 0, offset( slot_components * sizeof( GLfloat ) ) ) );
+
+	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_index_vbo ) );
+}
+
+void NonLegacyRenderer::SetupInstanceVAO() {
+	CheckGLError( GLEXT_glGenVertexArrays( 1, &m_instance_vao ) );
+	CheckGLError( GLEXT_glBindVertexArray( m_instance_vao ) );
+
+	assert( m_instance_vbo != 0 );
+	assert( m_instance_vao != 0 );
+
+	// The per-vertex position and texture coordinate are computed
+	// from the instance, all other attributes advance per instance.
+	const unsigned int locations[] = {
+		m_color_location,
+		m_slot_location,
+		m_instance_rect_location,
+		m_instance_texture_rect_location,
+		m_instance_light_border_color_location,
+		m_instance_dark_border_color_location,
+		m_instance_border_width_location,
+		m_instance_distance_field_location
+	};
+
+	for( auto location : locations ) {
+		CheckGLError( GLEXT_glEnableVertexAttribArray( location ) );
+		CheckGLError( GLEXT_glVertexAttribDivisor( location, 1 ) );
+	}
+
+	SetupInstanceAttributes( 0 );
+
+	CheckGLError( GLEXT_glBindVertexArray( 0 ) );
+
+	for( auto location : locations ) {
+		CheckGLError( GLEXT_glDisableVertexAttribArray( location ) );
+	}
+
+	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, 0 ) );
+}
+
+void NonLegacyRenderer::SetupInstanceAttributes( std::size_t first_instance ) {
+	// Without base instance support the attributes are moved to the first
+	// instance of the batch. When streaming, they start at the current segment.
+	const auto stride = static_cast<GLsizei>( sizeof( priv::RendererInstance ) );
+	const auto base = reinterpret_cast<const char*>( ( m_stream_instance_base + first_instance ) * sizeof( priv::RendererInstance ) );
+
+	CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_instance_vbo ) );
+	CheckGLError( GLEXT_glVertexAttribPointer( m_instance_rect_location, 4, GL_FLOAT, GL_FALSE, stride, base + offsetof( priv::RendererInstance, rect ) ) );
+	CheckGLError( GLEXT_glVertexAttribPointer( m_instance_texture_rect_location, 4, GL_FLOAT, GL_FALSE, stride, base + offsetof( priv::RendererInstance, texture_rect ) ) );
+	CheckGLError( GLEXT_glVertexAttribPointer( m_color_location, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, base + offsetof( priv::RendererInstance, color ) ) );
+	CheckGLError( GLEXT_glVertexAttribPointer( m_instance_light_border_color_location, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, base + offsetof( priv::RendererInstance, light_border_color ) ) );
+	CheckGLError( GLEXT_glVertexAttribPointer( m_instance_dark_border_color_location, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, base + offsetof( priv::RendererInstance, dark_border_color ) ) );
+	CheckGLError( GLEXT_glVertexAttribPointer( m_instance_border_width_location, 1, GL_FLOAT, GL_FALSE, stride, base + offsetof( priv::RendererInstance, border_width ) ) );
+	CheckGLError( GLEXT_glVertexAttribPointer( m_slot_location, static_cast<GLint>( slot_components ), GL_FLOAT, GL_FALSE, stride, base + offsetof( priv::RendererInstance, transform_slot ) ) );
+	CheckGLError( GLEXT_glVertexAttribPointer( m_instance_distance_field_location, 1, GL_FLOAT, GL_FALSE, stride, base + offsetof( priv::RendererInstance, distance_field ) ) );
+}
+
 void NonLegacyRenderer::SetupFBOVAO() {
 	if( !m_fbo_vbo ) {
 		return;
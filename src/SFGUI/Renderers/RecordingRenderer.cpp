@@ -0,0 +1,203 @@
+#include <SFGUI/Renderers/RecordingRenderer.hpp>
+#include <SFGUI/RendererBatchBuilder.hpp>
+#include <SFGUI/RendererViewport.hpp>
+#include <SFGUI/Primitive.hpp>
+#include <SFGUI/PrimitiveVertex.hpp>
+#include <SFGUI/ProfilerScope.hpp>
+
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+
+namespace {
+
+sf::IntRect GetScissor( const sfg::RendererViewport& viewport ) {
+	auto destination_origin = viewport.GetAbsoluteDestinationOrigin();
+	auto size = viewport.GetSize();
+
+	return sf::IntRect(
+		{ static_cast<int>( destination_origin.x ), static_cast<int>( destination_origin.y ) },
+		{ static_cast<int>( size.x ), static_cast<int>( size.y ) }
+	);
+}
+
+}
+
+namespace sfg {
+
+RecordingRenderer::RecordingRenderer() {
+}
+
+RecordingRenderer::Ptr RecordingRenderer::Create() {
+	return Ptr( new RecordingRenderer );
+}
+
+const std::string& RecordingRenderer::GetName() const {
+	static const std::string name( "Recording Renderer" );
+	return name;
+}
+
+void RecordingRenderer::Display( sf::Window& target ) const {
+	Record( target.getSize() );
+}
+
+void RecordingRenderer::Display( sf::RenderWindow& target ) const {
+	Record( target.getSize() );
+}
+
+void RecordingRenderer::Display( sf::RenderTexture& target ) const {
+	Record( target.getSize() );
+}
+
+void RecordingRenderer::Record( const sf::Vector2u& size ) const {
+	m_window_size = static_cast<sf::Vector2i>( size );
+
+	DisplayImpl();
+}
+
+void RecordingRenderer::DisplayImpl() const {
+	SFGUI_PROFILE_SCOPE( DISPLAY );
+
+	if( m_last_window_size != m_window_size ) {
+		m_last_window_size = m_window_size;
+
+		if( m_window_size.x && m_window_size.y ) {
+			const_cast<RecordingRenderer*>( this )->Invalidate( INVALIDATE_VERTEX | INVALIDATE_TEXTURE );
+		}
+	}
+
+	// See the VertexBufferRenderer on why const_cast is fine here.
+	if( !m_synced ) {
+		const_cast<RecordingRenderer*>( this )->RefreshData();
+	}
+
+	SFGUI_PROFILE_COUNT( BATCHES, m_batches.size() );
+	SFGUI_PROFILE_COUNT( DRAW_CALLS, m_draw_call_count );
+
+	m_force_redraw = false;
+	m_synced = true;
+}
+
+void RecordingRenderer::RefreshData() {
+	SFGUI_PROFILE_SCOPE( REFRESH_VBO );
+
+	SortPrimitives();
+
+	std::size_t vertex_count = 0;
+	std::size_t index_count = 0;
+
+	priv::RendererBatchBuilder::Count( m_primitives, vertex_count, index_count );
+
+	m_vertex_data.resize( vertex_count );
+	m_color_data.resize( vertex_count );
+	m_texture_data.resize( vertex_count );
+	m_index_data.resize( index_count );
+
+	struct Writer : priv::RendererBatchWriter {
+		void WriteVertex( std::size_t offset, const sf::Vector2f& position, const sf::Vector2f& texture_coordinate, const sf::Color& color, int /*layer*/ ) {
+			renderer->m_vertex_data[offset] = position;
+			renderer->m_color_data[offset] = color;
+			renderer->m_texture_data[offset] = texture_coordinate;
+		}
+
+		void WriteIndex( std::size_t offset, unsigned int index ) {
+			renderer->m_index_data[offset] = index;
+		}
+
+		RecordingRenderer* renderer;
+	} writer;
+
+	writer.renderer = this;
+
+	// Batch exactly like the GL renderers do.
+	std::vector<priv::RendererBatch> batches;
+
+	priv::RendererBatchBuilder builder( batches, m_texture_atlas, GetMaxTextureSize(), m_default_viewport, m_window_size );
+	builder.SetCull( m_cull );
+	builder.AddAll( m_primitives, writer );
+	builder.Finish();
+
+	// Drop the vertices of culled primitives.
+	m_vertex_data.resize( static_cast<std::size_t>( builder.GetVertexCount() ) );
+	m_color_data.resize( static_cast<std::size_t>( builder.GetVertexCount() ) );
+	m_texture_data.resize( static_cast<std::size_t>( builder.GetVertexCount() ) );
+	m_index_data.resize( static_cast<std::size_t>( builder.GetIndexCount() ) );
+
+	const sf::IntRect window_scissor( { 0, 0 }, m_window_size );
+
+	m_batches.clear();
+	m_batches.reserve( batches.size() );
+
+	for( const auto& batch : batches ) {
+		const auto& viewport = batch.viewport;
+
+		// Custom draw batches are clipped to their viewport even if it is the default one.
+		const auto clipped = viewport && ( batch.custom_draw || ( ( *viewport ) != ( *m_default_viewport ) ) );
+
+		Batch recorded_batch;
+		recorded_batch.viewport = viewport;
+		recorded_batch.scissor = clipped ? GetScissor( *viewport ) : window_scissor;
+		recorded_batch.atlas_page = batch.atlas_page;
+		recorded_batch.start_index = batch.start_index;
+		recorded_batch.index_count = batch.index_count;
+		recorded_batch.min_index = batch.min_index;
+		recorded_batch.max_index = batch.max_index;
+		recorded_batch.custom_draw = batch.custom_draw;
+
+		m_batches.push_back( recorded_batch );
+	}
+
+	m_draw_call_count = 0;
+
+	for( const auto& batch : m_batches ) {
+		if( !batch.custom_draw && batch.index_count ) {
+			++m_draw_call_count;
+		}
+	}
+
+	++m_rebuild_count;
+}
+
+void RecordingRenderer::TuneCull( bool enable ) {
+	m_cull = enable;
+
+	Invalidate( INVALIDATE_VERTEX );
+}
+
+const std::vector<sf::Vector2f>& RecordingRenderer::GetVertexData() const {
+	return m_vertex_data;
+}
+
+const std::vector<sf::Color>& RecordingRenderer::GetColorData() const {
+	return m_color_data;
+}
+
+const std::vector<sf::Vector2f>& RecordingRenderer::GetTextureData() const {
+	return m_texture_data;
+}
+
+const std::vector<unsigned int>& RecordingRenderer::GetIndexData() const {
+	return m_index_data;
+}
+
+const std::vector<RecordingRenderer::Batch>& RecordingRenderer::GetBatches() const {
+	return m_batches;
+}
+
+std::size_t RecordingRenderer::GetDrawCallCount() const {
+	return m_draw_call_count;
+}
+
+std::size_t RecordingRenderer::GetRebuildCount() const {
+	return m_rebuild_count;
+}
+
+void RecordingRenderer::InvalidateImpl( unsigned char datasets ) {
+	// Transform offsets are baked into the vertex data,
+	// all data is assembled at once anyway.
+	if( datasets ) {
+		m_synced = false;
+	}
+}
+
+}
@@ -0,0 +1,464 @@
+#include <SFGUI/Renderers/SoftwareRenderer.hpp>
+#include <SFGUI/Context.hpp>
+#include <SFGUI/ThreadPool.hpp>
+#include <SFGUI/ProfilerScope.hpp>
+
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+const int tile_size = 64;
+
+std::uint32_t Pack( std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a ) {
+	const std::uint8_t bytes[4] = { r, g, b, a };
+	std::uint32_t pixel;
+	std::memcpy( &pixel, bytes, 4 );
+	return pixel;
+}
+
+float Orient( const sf::Vector2f& a, const sf::Vector2f& b, const sf::Vector2f& p ) {
+	return ( b.x - a.x ) * ( p.y - a.y ) - ( b.y - a.y ) * ( p.x - a.x );
+}
+
+// Pixels exactly on an edge shared by two triangles are only
+// drawn by one of them so they aren't blended twice.
+bool IsTopLeft( const sf::Vector2f& a, const sf::Vector2f& b ) {
+	return ( b.y < a.y ) || ( ( b.y == a.y ) && ( b.x > a.x ) );
+}
+
+// Divides the two 16-bit halves of a word by 255, exact for values up to 65534.
+std::uint32_t DivideBy255( std::uint32_t value ) {
+	return ( ( value + 0x00010001u + ( ( value >> 8 ) & 0x00ff00ffu ) ) >> 8 ) & 0x00ff00ffu;
+}
+
+// Blends a span with a constant color. Whole pixels are blended, two
+// channels at a time in the 16-bit halves of a word, with SSE2 four pixels
+// at a time. Both produce exactly the same result as BlendPixel.
+void BlendSpan( std::uint32_t* destination, std::size_t count, const std::uint8_t* color ) {
+	const std::uint32_t alpha = color[3];
+	const std::uint32_t inverse_alpha = 255u - alpha;
+
+	std::size_t index = 0;
+
+#if defined( __SSE2__ ) || defined( _M_X64 )
+	const auto zero = _mm_setzero_si128();
+	const auto one = _mm_set1_epi16( 1 );
+	const auto inverse = _mm_set1_epi16( static_cast<short>( inverse_alpha ) );
+
+	// Premultiplied channels in memory order, including the rounding term.
+	const short premultiplied_channels[4] = {
+		static_cast<short>( color[0] * alpha + 127u ),
+		static_cast<short>( color[1] * alpha + 127u ),
+		static_cast<short>( color[2] * alpha + 127u ),
+		static_cast<short>( alpha * alpha + 127u )
+	};
+
+	const auto premultiplied = _mm_set_epi16(
+		premultiplied_channels[3], premultiplied_channels[2], premultiplied_channels[1], premultiplied_channels[0],
+		premultiplied_channels[3], premultiplied_channels[2], premultiplied_channels[1], premultiplied_channels[0]
+	);
+
+	for( ; index + 4 <= count; index += 4 ) {
+		const auto pixels = _mm_loadu_si128( reinterpret_cast<const __m128i*>( destination + index ) );
+
+		// Products wrap as signed values but their 16 bits are correct.
+		auto low = _mm_add_epi16( _mm_mullo_epi16( _mm_unpacklo_epi8( pixels, zero ), inverse ), premultiplied );
+		auto high = _mm_add_epi16( _mm_mullo_epi16( _mm_unpackhi_epi8( pixels, zero ), inverse ), premultiplied );
+
+		low = _mm_srli_epi16( _mm_add_epi16( _mm_add_epi16( low, one ), _mm_srli_epi16( low, 8 ) ), 8 );
+		high = _mm_srli_epi16( _mm_add_epi16( _mm_add_epi16( high, one ), _mm_srli_epi16( high, 8 ) ), 8 );
+
+		_mm_storeu_si128( reinterpret_cast<__m128i*>( destination + index ), _mm_packus_epi16( low, high ) );
+	}
+#endif
+
+	// Channels of the even and odd bytes of the pixel, premultiplied and including the rounding term.
+	const auto pixel = Pack( color[0], color[1], color[2], color[3] );
+	const auto even = ( pixel & 0x00ff00ffu ) * alpha + 0x007f007fu;
+	const auto odd = ( ( pixel >> 8 ) & 0x00ff00ffu ) * alpha + 0x007f007fu;
+
+	for( ; index < count; ++index ) {
+		const auto destination_pixel = destination[index];
+
+		const auto blended_even = DivideBy255( even + ( destination_pixel & 0x00ff00ffu ) * inverse_alpha );
+		const auto blended_odd = DivideBy255( odd + ( ( destination_pixel >> 8 ) & 0x00ff00ffu ) * inverse_alpha );
+
+		destination[index] = blended_even | ( blended_odd << 8 );
+	}
+}
+
+void BlendPixel( std::uint8_t* destination, unsigned int r, unsigned int g, unsigned int b, unsigned int a ) {
+	const auto inverse_alpha = 255u - a;
+
+	destination[0] = static_cast<std::uint8_t>( ( r * a + destination[0] * inverse_alpha + 127u ) / 255u );
+	destination[1] = static_cast<std::uint8_t>( ( g * a + destination[1] * inverse_alpha + 127u ) / 255u );
+	destination[2] = static_cast<std::uint8_t>( ( b * a + destination[2] * inverse_alpha + 127u ) / 255u );
+	destination[3] = static_cast<std::uint8_t>( ( a * a + destination[3] * inverse_alpha + 127u ) / 255u );
+}
+
+}
+
+namespace sfg {
+
+SoftwareRenderer::SoftwareRenderer() :
+	m_size( 0, 0 ),
+	m_tile_count( 0, 0 ),
+	m_clear_color( sf::Color::Transparent )
+{
+	// Textures are sampled from the CPU-side copies of the atlas.
+	KeepAtlasImages();
+}
+
+SoftwareRenderer::~SoftwareRenderer() {
+}
+
+SoftwareRenderer::Ptr SoftwareRenderer::Create() {
+	return Ptr( new SoftwareRenderer );
+}
+
+const std::string& SoftwareRenderer::GetName() const {
+	static const std::string name( "Software Renderer" );
+	return name;
+}
+
+void SoftwareRenderer::Display( sf::Window& target ) const {
+	Record( target.getSize() );
+}
+
+void SoftwareRenderer::Display( sf::RenderWindow& target ) const {
+	Record( target.getSize() );
+
+	DrawToTarget( target );
+}
+
+void SoftwareRenderer::Display( sf::RenderTexture& target ) const {
+	Record( target.getSize() );
+
+	DrawToTarget( target );
+}
+
+void SoftwareRenderer::DisplayImpl() const {
+	RecordingRenderer::DisplayImpl();
+
+	// See the VertexBufferRenderer on why const_cast is fine here.
+	const_cast<SoftwareRenderer*>( this )->Rasterize();
+}
+
+void SoftwareRenderer::Rasterize() {
+	SFGUI_PROFILE_SCOPE( DISPLAY );
+
+	m_size = static_cast<sf::Vector2u>( m_window_size );
+	m_pixels.resize( static_cast<std::size_t>( m_size.x ) * static_cast<std::size_t>( m_size.y ) );
+
+	m_tile_count.x = ( m_size.x + tile_size - 1 ) / tile_size;
+	m_tile_count.y = ( m_size.y + tile_size - 1 ) / tile_size;
+
+	m_tiles.resize( static_cast<std::size_t>( m_tile_count.x ) * static_cast<std::size_t>( m_tile_count.y ) );
+
+	for( auto& tile : m_tiles ) {
+		tile.clear();
+	}
+
+	// Sort the triangles into the tiles they touch. Triangles keep
+	// their draw order within every tile so blending stays correct.
+	const auto& vertices = GetVertexData();
+	const auto& indices = GetIndexData();
+	const auto& batches = GetBatches();
+
+	const sf::IntRect target_rect( { 0, 0 }, static_cast<sf::Vector2i>( m_size ) );
+
+	for( std::size_t batch_index = 0; batch_index < batches.size(); ++batch_index ) {
+		const auto& batch = batches[batch_index];
+
+		if( batch.custom_draw || !batch.index_count ) {
+			continue;
+		}
+
+		auto clip = batch.scissor.findIntersection( target_rect );
+
+		if( !clip ) {
+			continue;
+		}
+
+		auto end_index = batch.start_index + batch.index_count;
+
+		for( auto index = batch.start_index; index + 2 < end_index; index += 3 ) {
+			const auto& vertex0 = vertices[indices[static_cast<std::size_t>( index )]];
+			const auto& vertex1 = vertices[indices[static_cast<std::size_t>( index ) + 1]];
+			const auto& vertex2 = vertices[indices[static_cast<std::size_t>( index ) + 2]];
+
+			auto left = std::max( clip->position.x, static_cast<int>( std::floor( std::min( { vertex0.x, vertex1.x, vertex2.x } ) ) ) );
+			auto top = std::max( clip->position.y, static_cast<int>( std::floor( std::min( { vertex0.y, vertex1.y, vertex2.y } ) ) ) );
+			auto right = std::min( clip->position.x + clip->size.x, static_cast<int>( std::ceil( std::max( { vertex0.x, vertex1.x, vertex2.x } ) ) ) );
+			auto bottom = std::min( clip->position.y + clip->size.y, static_cast<int>( std::ceil( std::max( { vertex0.y, vertex1.y, vertex2.y } ) ) ) );
+
+			if( ( left >= right ) || ( top >= bottom ) ) {
+				continue;
+			}
+
+			for( auto tile_y = top / tile_size; tile_y <= ( bottom - 1 ) / tile_size; ++tile_y ) {
+				for( auto tile_x = left / tile_size; tile_x <= ( right - 1 ) / tile_size; ++tile_x ) {
+					m_tiles[static_cast<std::size_t>( tile_y ) * m_tile_count.x + static_cast<std::size_t>( tile_x )].push_back( { static_cast<std::uint32_t>( index ), static_cast<std::uint32_t>( batch_index ) } );
+				}
+			}
+		}
+	}
+
+	auto thread_pool = Context::Get().GetThreadPool();
+
+	if( thread_pool && ( m_tiles.size() > 1 ) ) {
+		thread_pool->Run( m_tiles.size(), [this]( std::size_t tile ) {
+			RasterizeTile( tile );
+		} );
+	}
+	else {
+		for( std::size_t tile = 0; tile < m_tiles.size(); ++tile ) {
+			RasterizeTile( tile );
+		}
+	}
+}
+
+void SoftwareRenderer::RasterizeTile( std::size_t tile ) {
+	const auto tile_left = static_cast<int>( tile % m_tile_count.x ) * tile_size;
+	const auto tile_top = static_cast<int>( tile / m_tile_count.x ) * tile_size;
+	const auto tile_right = std::min( tile_left + tile_size, static_cast<int>( m_size.x ) );
+	const auto tile_bottom = std::min( tile_top + tile_size, static_cast<int>( m_size.y ) );
+
+	const auto clear_pixel = Pack( m_clear_color.r, m_clear_color.g, m_clear_color.b, m_clear_color.a );
+
+	for( auto y = tile_top; y < tile_bottom; ++y ) {
+		std::fill_n( m_pixels.data() + static_cast<std::size_t>( y ) * m_size.x + static_cast<std::size_t>( tile_left ), tile_right - tile_left, clear_pixel );
+	}
+
+	const auto& vertices = GetVertexData();
+	const auto& colors = GetColorData();
+	const auto& texture_coordinates = GetTextureData();
+	const auto& indices = GetIndexData();
+	const auto& batches = GetBatches();
+
+	for( const auto& triangle : m_tiles[tile] ) {
+		const auto& batch = batches[triangle.batch];
+
+		// Clip to the batch's scissor rect and the tile.
+		const auto clip_left = std::max( tile_left, batch.scissor.position.x );
+		const auto clip_top = std::max( tile_top, batch.scissor.position.y );
+		const auto clip_right = std::min( tile_right, batch.scissor.position.x + batch.scissor.size.x );
+		const auto clip_bottom = std::min( tile_bottom, batch.scissor.position.y + batch.scissor.size.y );
+
+		std::size_t corner_indices[3] = {
+			indices[triangle.first_index],
+			indices[triangle.first_index + 1],
+			indices[triangle.first_index + 2]
+		};
+
+		auto area = Orient( vertices[corner_indices[0]], vertices[corner_indices[1]], vertices[corner_indices[2]] );
+
+		if( area == 0.f ) {
+			continue;
+		}
+
+		// Make all triangles wind the same way.
+		if( area < 0.f ) {
+			std::swap( corner_indices[1], corner_indices[2] );
+			area = -area;
+		}
+
+		const auto& a = vertices[corner_indices[0]];
+		const auto& b = vertices[corner_indices[1]];
+		const auto& c = vertices[corner_indices[2]];
+
+		const auto left = std::max( clip_left, static_cast<int>( std::floor( std::min( { a.x, b.x, c.x } ) ) ) );
+		const auto top = std::max( clip_top, static_cast<int>( std::floor( std::min( { a.y, b.y, c.y } ) ) ) );
+		const auto right = std::min( clip_right, static_cast<int>( std::ceil( std::max( { a.x, b.x, c.x } ) ) ) );
+		const auto bottom = std::min( clip_bottom, static_cast<int>( std::ceil( std::max( { a.y, b.y, c.y } ) ) ) );
+
+		if( ( left >= right ) || ( top >= bottom ) ) {
+			continue;
+		}
+
+		const auto& atlas_image = m_atlas_images[static_cast<std::size_t>( batch.atlas_page )];
+		const auto atlas_size = atlas_image.getSize();
+		const auto atlas_pixels = atlas_image.getPixelsPtr();
+
+		const sf::Color* corner_colors[3] = { &colors[corner_indices[0]], &colors[corner_indices[1]], &colors[corner_indices[2]] };
+		const sf::Vector2f* corner_coordinates[3] = { &texture_coordinates[corner_indices[0]], &texture_coordinates[corner_indices[1]], &texture_coordinates[corner_indices[2]] };
+
+		// Untextured triangles sample the white pseudo texture in the
+		// top left corner of the first page. If they also have a single
+		// color, all their pixels have the same color.
+		auto solid = ( *corner_colors[0] == *corner_colors[1] ) && ( *corner_colors[0] == *corner_colors[2] ) && ( batch.atlas_page == 0 );
+
+		for( const auto coordinate : corner_coordinates ) {
+			solid = solid && ( coordinate->x * static_cast<float>( atlas_size.x ) < 2.f ) && ( coordinate->y * static_cast<float>( atlas_size.y ) < 2.f );
+		}
+
+		const std::uint8_t solid_color[4] = { corner_colors[0]->r, corner_colors[0]->g, corner_colors[0]->b, corner_colors[0]->a };
+
+		if( solid && !solid_color[3] ) {
+			continue;
+		}
+
+		// Edge functions and their steps in x and y.
+		const sf::Vector2f edges[3][2] = { { b, c }, { c, a }, { a, b } };
+
+		float step_x[3];
+		float step_y[3];
+		float bias[3];
+
+		for( int edge = 0; edge < 3; ++edge ) {
+			step_x[edge] = -( edges[edge][1].y - edges[edge][0].y );
+			step_y[edge] = edges[edge][1].x - edges[edge][0].x;
+			bias[edge] = IsTopLeft( edges[edge][0], edges[edge][1] ) ? 0.f : -1e-4f;
+		}
+
+		const sf::Vector2f origin( static_cast<float>( left ) + .5f, static_cast<float>( top ) + .5f );
+
+		float row_weights[3] = {
+			Orient( b, c, origin ),
+			Orient( c, a, origin ),
+			Orient( a, b, origin )
+		};
+
+		const auto inverse_area = 1.f / area;
+
+		for( auto y = top; y < bottom; ++y ) {
+			auto row = reinterpret_cast<std::uint8_t*>( m_pixels.data() + static_cast<std::size_t>( y ) * m_size.x );
+
+			float weights[3] = { row_weights[0], row_weights[1], row_weights[2] };
+
+			auto span_begin = -1;
+			auto span_end = -1;
+
+			for( auto x = left; x < right; ++x ) {
+				auto inside = ( weights[0] + bias[0] >= 0.f ) && ( weights[1] + bias[1] >= 0.f ) && ( weights[2] + bias[2] >= 0.f );
+
+				if( inside ) {
+					if( span_begin < 0 ) {
+						span_begin = x;
+					}
+
+					span_end = x + 1;
+
+					if( !solid ) {
+						const auto weight0 = weights[0] * inverse_area;
+						const auto weight1 = weights[1] * inverse_area;
+						const auto weight2 = weights[2] * inverse_area;
+
+						auto u = weight0 * corner_coordinates[0]->x + weight1 * corner_coordinates[1]->x + weight2 * corner_coordinates[2]->x;
+						auto v = weight0 * corner_coordinates[0]->y + weight1 * corner_coordinates[1]->y + weight2 * corner_coordinates[2]->y;
+
+						auto texel_x = std::min( static_cast<unsigned int>( std::max( 0.f, u * static_cast<float>( atlas_size.x ) ) ), atlas_size.x - 1 );
+						auto texel_y = std::min( static_cast<unsigned int>( std::max( 0.f, v * static_cast<float>( atlas_size.y ) ) ), atlas_size.y - 1 );
+
+						auto texel = atlas_pixels + ( static_cast<std::size_t>( texel_y ) * atlas_size.x + texel_x ) * 4;
+
+						auto color_r = weight0 * corner_colors[0]->r + weight1 * corner_colors[1]->r + weight2 * corner_colors[2]->r;
+						auto color_g = weight0 * corner_colors[0]->g + weight1 * corner_colors[1]->g + weight2 * corner_colors[2]->g;
+						auto color_b = weight0 * corner_colors[0]->b + weight1 * corner_colors[1]->b + weight2 * corner_colors[2]->b;
+						auto color_a = weight0 * corner_colors[0]->a + weight1 * corner_colors[1]->a + weight2 * corner_colors[2]->a;
+
+						// Modulate the texel with the vertex color.
+						auto alpha = static_cast<unsigned int>( static_cast<float>( texel[3] ) * color_a / 255.f + .5f );
+
+						if( alpha ) {
+							BlendPixel(
+								row + static_cast<std::size_t>( x ) * 4,
+								static_cast<unsigned int>( static_cast<float>( texel[0] ) * color_r / 255.f + .5f ),
+								static_cast<unsigned int>( static_cast<float>( texel[1] ) * color_g / 255.f + .5f ),
+								static_cast<unsigned int>( static_cast<float>( texel[2] ) * color_b / 255.f + .5f ),
+								std::min( alpha, 255u )
+							);
+						}
+					}
+				}
+				else if( span_begin >= 0 ) {
+					// Triangles are convex, the span is over.
+					break;
+				}
+
+				weights[0] += step_x[0];
+				weights[1] += step_x[1];
+				weights[2] += step_x[2];
+			}
+
+			if( solid && ( span_begin >= 0 ) ) {
+				auto count = static_cast<std::size_t>( span_end - span_begin );
+
+				if( solid_color[3] == 255 ) {
+					std::fill_n( m_pixels.data() + static_cast<std::size_t>( y ) * m_size.x + static_cast<std::size_t>( span_begin ), count, Pack( solid_color[0], solid_color[1], solid_color[2], solid_color[3] ) );
+				}
+				else {
+					BlendSpan( m_pixels.data() + static_cast<std::size_t>( y ) * m_size.x + static_cast<std::size_t>( span_begin ), count, solid_color );
+				}
+			}
+
+			row_weights[0] += step_y[0];
+			row_weights[1] += step_y[1];
+			row_weights[2] += step_y[2];
+		}
+	}
+}
+
+void SoftwareRenderer::DrawToTarget( sf::RenderTarget& target ) const {
+	if( !m_size.x || !m_size.y ) {
+		return;
+	}
+
+	if( !m_texture ) {
+		m_texture.reset( new sf::Texture );
+	}
+
+	if( m_texture->getSize() != m_size ) {
+		if( !m_texture->resize( m_size ) ) {
+#if defined( SFGUI_DEBUG )
+			std::cerr << "SFGUI warning: Failed to create texture for software rendered GUI.\n";
+#endif
+			return;
+		}
+	}
+
+	m_texture->update( GetPixels() );
+
+	// Draw in target pixel coordinates regardless of the target's view.
+	auto view = target.getView();
+	target.setView( target.getDefaultView() );
+	target.draw( sf::Sprite( *m_texture ) );
+	target.setView( view );
+}
+
+void SoftwareRenderer::SetClearColor( const sf::Color& color ) {
+	m_clear_color = color;
+}
+
+const sf::Color& SoftwareRenderer::GetClearColor() const {
+	return m_clear_color;
+}
+
+const sf::Vector2u& SoftwareRenderer::GetSize() const {
+	return m_size;
+}
+
+const std::uint8_t* SoftwareRenderer::GetPixels() const {
+	return reinterpret_cast<const std::uint8_t*>( m_pixels.data() );
+}
+
+sf::Image SoftwareRenderer::CopyToImage() const {
+	if( m_pixels.empty() ) {
+		return sf::Image();
+	}
+
+	return sf::Image( m_size, GetPixels() );
+}
+
+}
@@ -1,10 +1,11 @@
 #include <SFGUI/Renderers/VertexArrayRenderer.hpp>
-#include <SFGUI/RendererBatch.hpp>
+#include <SFGUI/RendererBatchBuilder.hpp>
 #include <SFGUI/RendererViewport.hpp>
 #include <SFGUI/Signal.hpp>
 #include <SFGUI/Primitive.hpp>
 #include <SFGUI/PrimitiveVertex.hpp>
 #include <SFGUI/GLCheck.hpp>
+#include <SFGUI/ProfilerScope.hpp>
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Texture.hpp>
@@ -77,6 +78,8 @@ void VertexArrayRenderer::Display( sf::RenderTexture& target ) const {
 }
 
 void VertexArrayRenderer::DisplayImpl() const {
+	SFGUI_PROFILE_SCOPE( DISPLAY );
+
 	CheckGLError( glMatrixMode( GL_MODELVIEW ) );
 	CheckGLError( glPushMatrix() );
 	CheckGLError( glLoadIdentity() );
@@ -143,11 +146,13 @@ void VertexArrayRenderer::DisplayImpl() const {
 
 	sf::Texture::bind( m_texture_atlas[0].get() );
 
+	SFGUI_PROFILE_COUNT( BATCHES, m_batches.size() );
+
 	for( const auto& batch : m_batches ) {
 		auto viewport = batch.viewport;
 
 		if( batch.custom_draw ) {
-			auto destination = static_cast<sf::Vector2i>( viewport->GetDestinationOrigin() );
+			auto destination = static_cast<sf::Vector2i>( viewport->GetAbsoluteDestinationOrigin() );
 			auto size = static_cast<sf::Vector2i>( viewport->GetSize() );
 
 			CheckGLError( glViewport( destination.x, m_window_size.y - destination.y - size.y, size.x, size.y ) );
@@ -161,7 +166,7 @@ void VertexArrayRenderer::DisplayImpl() const {
 		}
 		else {
 			if( viewport && ( ( *viewport ) != ( *m_default_viewport ) ) ) {
-				auto destination_origin = static_cast<sf::Vector2i>( viewport->GetDestinationOrigin() );
+				auto destination_origin = static_cast<sf::Vector2i>( viewport->GetAbsoluteDestinationOrigin() );
 				auto size = static_cast<sf::Vector2i>( viewport->GetSize() );
 
 				CheckGLError( glScissor(
@@ -188,6 +193,8 @@ void VertexArrayRenderer::DisplayImpl() const {
 					GL_UNSIGNED_INT,
 					reinterpret_cast<const char*>( &m_index_data[0] ) + static_cast<unsigned int>( batch.start_index * static_cast<int>( sizeof( GLuint ) ) )
 				) );
+
+				SFGUI_PROFILE_COUNT( DRAW_CALLS, 1 );
 			}
 		}
 	}
@@ -215,182 +222,49 @@ void VertexArrayRenderer::DisplayImpl() const {
 }
 
 void VertexArrayRenderer::RefreshArray() {
-	SortPrimitives();
-
-	m_vertex_data.clear();
-	m_color_data.clear();
-	m_texture_data.clear();
-	m_index_data.clear();
-
-	m_vertex_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
-	m_color_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
-	m_texture_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
-	m_index_data.reserve( static_cast<std::size_t>( m_index_count ) );
-
-	m_batches.clear();
-
-	m_last_vertex_count = 0;
-	m_last_index_count = 0;
-
-	auto primitives_size = m_primitives.size();
-
-	// Default viewport
-	priv::RendererBatch current_batch;
-	current_batch.viewport = m_default_viewport;
-	current_batch.atlas_page = 0;
-	current_batch.start_index = 0;
-	current_batch.index_count = 0;
-	current_batch.min_index = 0;
-	current_batch.max_index = m_vertex_count - 1;
-	current_batch.custom_draw = false;
+	SFGUI_PROFILE_SCOPE( REFRESH_VBO );
 
-	sf::FloatRect window_viewport( { 0.f, 0.f }, sf::Vector2f( m_window_size ) );
-
-	const auto max_texture_size = GetMaxTextureSize();
-	const auto default_texture_size = m_texture_atlas[0]->getSize();
-
-	for( std::size_t primitive_index = 1; primitive_index != primitives_size + 1; primitive_index += 1 ) {
-		Primitive* primitive = m_primitives[primitive_index - 1].get();
-
-		primitive->SetSynced();
-
-		if( !primitive->IsVisible() ) {
-			continue;
-		}
-
-		sf::Vector2f position_transform( primitive->GetPosition() );
-
-		auto viewport = primitive->GetViewport();
+	SortPrimitives();
 
-		auto viewport_rect = window_viewport;
+	std::size_t vertex_count = 0;
+	std::size_t index_count = 0;
 
-		// Check if primitive needs to be rendered in a custom viewport.
-		if( viewport && ( ( *viewport ) != ( *m_default_viewport ) ) ) {
-			sf::Vector2f destination_origin( viewport->GetDestinationOrigin() );
-			sf::Vector2f size( viewport->GetSize() );
+	priv::RendererBatchBuilder::Count( m_primitives, vertex_count, index_count );
 
-			position_transform += ( destination_origin - viewport->GetSourceOrigin() );
+	m_vertex_data.resize( vertex_count );
+	m_color_data.resize( vertex_count );
+	m_texture_data.resize( vertex_count );
+	m_index_data.resize( index_count );
 
-			if( m_cull ) {
-				viewport_rect = { destination_origin, size };
-			}
+	struct Writer : priv::RendererBatchWriter {
+		void WriteVertex( std::size_t offset, const sf::Vector2f& position, const sf::Vector2f& texture_coordinate, const sf::Color& color, int /*layer*/ ) {
+			renderer->m_vertex_data[offset] = position;
+			renderer->m_color_data[offset] = color;
+			renderer->m_texture_data[offset] = texture_coordinate;
 		}
 
-		const std::shared_ptr<Signal>& custom_draw_callback( primitive->GetCustomDrawCallback() );
-
-		if( custom_draw_callback ) {
-			// Start a new batch.
-			current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-			m_batches.push_back( current_batch );
-
-			// Mark current_batch custom draw batch.
-			current_batch.viewport = viewport;
-			current_batch.start_index = 0;
-			current_batch.index_count = 0;
-			current_batch.min_index = 0;
-			current_batch.max_index = 0;
-			current_batch.custom_draw = true;
-			current_batch.custom_draw_callback = custom_draw_callback;
-
-			// Start a new batch.
-			m_batches.push_back( current_batch );
-
-			// Reset current_batch to defaults.
-			current_batch.viewport = m_default_viewport;
-			current_batch.start_index = m_last_index_count;
-			current_batch.index_count = 0;
-			current_batch.min_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-			current_batch.custom_draw = false;
+		void WriteIndex( std::size_t offset, unsigned int index ) {
+			renderer->m_index_data[offset] = static_cast<int>( index );
 		}
-		else {
-			// Process primitive's vertices and indices
-			const std::vector<PrimitiveVertex>& vertices( primitive->GetVertices() );
-			const std::vector<GLuint>& indices( primitive->GetIndices() );
 
-			sf::Vector2f position( 0.f, 0.f );
+		VertexArrayRenderer* renderer;
+	} writer;
 
-			sf::FloatRect bounding_rect( { 0.f, 0.f }, { 0.f, 0.f } );
+	writer.renderer = this;
 
-			auto atlas_page = 0;
+	priv::RendererBatchBuilder builder( m_batches, m_texture_atlas, GetMaxTextureSize(), m_default_viewport, m_window_size );
+	builder.SetCull( m_cull );
+	builder.AddAll( m_primitives, writer );
+	builder.Finish();
 
-			const auto vertices_size = vertices.size();
-			sf::Vector2f normalizer;
-
-			for( std::size_t index = 0; index < vertices_size; ++index ) {
-				const auto vertex = vertices[index];
-				position.x = vertex.position.x + position_transform.x;
-				position.y = vertex.position.y + position_transform.y;
-
-				m_vertex_data.push_back( position );
-				m_color_data.push_back( vertex.color );
-
-				// The bound texture can only change between triangles.
-				if( index % 3 == 0 ) {
-					atlas_page = static_cast<int>( vertex.texture_coordinate.y ) / max_texture_size;
-					auto texture_size = ( vertex.texture_coordinate.y <= 1.f ) ? default_texture_size : m_texture_atlas[static_cast<std::size_t>( atlas_page )]->getSize();
-
-					// Used to normalize texture coordinates.
-					normalizer.x = 1.f / static_cast<float>( texture_size.x );
-					normalizer.y = 1.f / static_cast<float>( texture_size.y );
-				}
-
-				// Normalize SFML's pixel texture coordinates.
-				m_texture_data.emplace_back( vertex.texture_coordinate.x * normalizer.x, static_cast<float>( static_cast<int>( vertex.texture_coordinate.y ) % max_texture_size ) * normalizer.y );
-
-				// Update the bounding rect.
-				if( m_cull ) {
-					if( position.x < bounding_rect.position.x ) {
-						bounding_rect.size.x += bounding_rect.position.x - position.x;
-						bounding_rect.position.x = position.x;
-					}
-					else if( position.x > bounding_rect.position.x + bounding_rect.size.x ) {
-						bounding_rect.size.x = position.x - bounding_rect.position.x;
-					}
-
-					if( position.y < bounding_rect.position.y ) {
-						bounding_rect.size.y += bounding_rect.position.y - position.y;
-						bounding_rect.position.y = position.y;
-					}
-					else if( position.y > bounding_rect.position.y + bounding_rect.size.y ) {
-						bounding_rect.size.y = position.y - bounding_rect.position.y;
-					}
-				}
-			}
-
-			if( m_cull && !viewport_rect.findIntersection( bounding_rect ) ) {
-				m_vertex_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
-				m_color_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
-				m_texture_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
-			}
-			else {
-				for( const auto& index : indices ) {
-					m_index_data.push_back( m_last_vertex_count + static_cast<int>( index ) );
-				}
-
-				// Check if we need to start a new batch.
-				if( ( ( *viewport ) != ( *current_batch.viewport ) ) || ( atlas_page != current_batch.atlas_page ) ) {
-					current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-					m_batches.push_back( current_batch );
-
-					// Reset current_batch to defaults.
-					current_batch.viewport = viewport;
-					current_batch.atlas_page = atlas_page;
-					current_batch.start_index = m_last_index_count;
-					current_batch.index_count = 0;
-					current_batch.min_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-					current_batch.custom_draw = false;
-				}
-
-				current_batch.index_count += static_cast<int>( indices.size() );
-
-				m_last_vertex_count += static_cast<GLsizei>( vertices.size() );
-				m_last_index_count += static_cast<GLsizei>( indices.size() );
-			}
-		}
-	}
+	m_last_vertex_count = builder.GetVertexCount();
+	m_last_index_count = builder.GetIndexCount();
 
-	current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-	m_batches.push_back( current_batch );
+	// Drop the vertices of culled primitives.
+	m_vertex_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+	m_color_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+	m_texture_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+	m_index_data.resize( static_cast<std::size_t>( m_last_index_count ) );
 }
 
 void VertexArrayRenderer::TuneAlphaThreshold( float alpha_threshold ) {
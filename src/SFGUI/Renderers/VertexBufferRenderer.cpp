@@ -8,12 +8,14 @@
 #undef None
 
 #include <SFGUI/Renderers/VertexBufferRenderer.hpp>
-#include <SFGUI/RendererBatch.hpp>
+#include <SFGUI/RendererBatchBuilder.hpp>
+#include <SFGUI/CompactVertex.hpp>
 #include <SFGUI/RendererViewport.hpp>
 #include <SFGUI/Signal.hpp>
 #include <SFGUI/Primitive.hpp>
 #include <SFGUI/PrimitiveVertex.hpp>
 #include <SFGUI/GLCheck.hpp>
+#include <SFGUI/ProfilerScope.hpp>
 
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Texture.hpp>
@@ -21,6 +23,8 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Window/Context.hpp>
 #include <SFML/System/Vector3.hpp>
+#include <algorithm>
+#include <cstddef>
 
 #define GLEXT_framebuffer_object sfgogl_ext_EXT_framebuffer_object
 
@@ -46,10 +50,19 @@
 #define GLEXT_glBufferData glBufferDataARB
 #define GLEXT_glBufferSubData glBufferSubDataARB
 
+#define GLEXT_draw_elements_base_vertex sfgogl_ext_ARB_draw_elements_base_vertex
+
+#define GLEXT_glDrawRangeElementsBaseVertex glDrawRangeElementsBaseVertex
+
 namespace {
 
 bool gl_initialized = false;
 
+// Fixed function texture coordinates can't be unsigned or normalized.
+// Compact coordinates are stored as signed shorts and scaled back
+// by the texture matrix.
+const float texture_coordinate_scale = 32767.f;
+
 }
 
 namespace sfg {
@@ -61,12 +74,16 @@ VertexBufferRenderer::VertexBufferRenderer() :
 	m_last_vertex_count( 0 ),
 	m_last_index_count( 0 ),
 	m_alpha_threshold( 0.f ),
+	m_position_scale( 1.f ),
 	m_vbo_sync_type( INVALIDATE_ALL ),
 	m_vbo_synced( false ),
 	m_cull( false ),
 	m_use_fbo( false ),
 	m_vbo_supported( false ),
-	m_fbo_supported( false ) {
+	m_fbo_supported( false ),
+	m_compact( false ),
+	m_short_indices( false ),
+	m_base_vertex_supported( false ) {
 
 	// Make sure we have a valid GL context before messing around
 	// with GLLoader or else it will report missing extensions sometimes.
@@ -92,6 +109,12 @@ VertexBufferRenderer::VertexBufferRenderer() :
 		CheckGLError( GLEXT_glGenBuffers( 1, &m_color_vbo ) );
 		CheckGLError( GLEXT_glGenBuffers( 1, &m_texture_vbo ) );
 		CheckGLError( GLEXT_glGenBuffers( 1, &m_index_vbo ) );
+
+		GLint max_viewport_dimensions[2] = { 0, 0 };
+		CheckGLError( glGetIntegerv( GL_MAX_VIEWPORT_DIMS, max_viewport_dimensions ) );
+
+		m_compact = priv::CompactPositionsFit( std::max( max_viewport_dimensions[0], max_viewport_dimensions[1] ) ) &&
+		            priv::CompactTextureCoordinatesFit( GetMaxTextureSize(), texture_coordinate_scale );
 	}
 	else {
 #if defined( SFGUI_DEBUG )
@@ -102,6 +125,10 @@ VertexBufferRenderer::VertexBufferRenderer() :
 	if( GLEXT_framebuffer_object ) {
 		m_fbo_supported = true;
 	}
+
+	if( GLEXT_draw_elements_base_vertex ) {
+		m_base_vertex_supported = true;
+	}
 }
 
 VertexBufferRenderer::~VertexBufferRenderer() {
@@ -201,6 +228,8 @@ void VertexBufferRenderer::DisplayImpl() const {
 		return;
 	}
 
+	SFGUI_PROFILE_SCOPE( DISPLAY );
+
 	CheckGLError( glMatrixMode( GL_MODELVIEW ) );
 	CheckGLError( glPushMatrix() );
 	CheckGLError( glLoadIdentity() );
@@ -261,14 +290,9 @@ void VertexBufferRenderer::DisplayImpl() const {
 		// Further, we stick all referenced textures into our giant atlas
 		// so we don't have to rebind during the draw.
 
-		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
-		CheckGLError( glVertexPointer( 2, GL_FLOAT, 0, 0 ) );
-
-		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_color_vbo ) );
-		CheckGLError( glColorPointer( 4, GL_UNSIGNED_BYTE, 0, 0 ) );
+		SetupPointers( 0 );
 
-		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_texture_vbo ) );
-		CheckGLError( glTexCoordPointer( 2, GL_FLOAT, 0, 0 ) );
+		auto current_base_vertex = 0;
 
 		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_index_vbo ) );
 
@@ -289,25 +313,59 @@ void VertexBufferRenderer::DisplayImpl() const {
 
 		sf::Texture::bind( m_texture_atlas[0].get() );
 
+		SFGUI_PROFILE_COUNT( BATCHES, m_batches.size() );
+
+		// Compact texture coordinates are normalized by the texture matrix
+		// and positions are scaled back to pixels by the modelview matrix.
+		// They are only scaled while batches are drawn, custom draw
+		// callbacks and the FBO display list expect the identity.
+		if( m_compact ) {
+			CheckGLError( glMatrixMode( GL_MODELVIEW ) );
+			CheckGLError( glPushMatrix() );
+			CheckGLError( glScalef( 1.f / m_position_scale, 1.f / m_position_scale, 1.f ) );
+
+			CheckGLError( glMatrixMode( GL_TEXTURE ) );
+			CheckGLError( glPushMatrix() );
+			CheckGLError( glScalef( 1.f / texture_coordinate_scale, 1.f / texture_coordinate_scale, 1.f ) );
+		}
+
 		for( const auto& batch : m_batches ) {
 			auto viewport = batch.viewport;
 
 			if( batch.custom_draw ) {
-				auto destination = static_cast<sf::Vector2i>( viewport->GetDestinationOrigin() );
+				auto destination = static_cast<sf::Vector2i>( viewport->GetAbsoluteDestinationOrigin() );
 				auto size = static_cast<sf::Vector2i>( viewport->GetSize() );
 
 				CheckGLError( glViewport( destination.x, m_window_size.y - destination.y - size.y, size.x, size.y ) );
 
+				if( m_compact ) {
+					CheckGLError( glMatrixMode( GL_MODELVIEW ) );
+					CheckGLError( glPushMatrix() );
+					CheckGLError( glLoadIdentity() );
+
+					CheckGLError( glMatrixMode( GL_TEXTURE ) );
+					CheckGLError( glPushMatrix() );
+					CheckGLError( glLoadIdentity() );
+				}
+
 				// Draw canvas.
 				( *batch.custom_draw_callback )();
 
+				if( m_compact ) {
+					CheckGLError( glMatrixMode( GL_MODELVIEW ) );
+					CheckGLError( glPopMatrix() );
+
+					CheckGLError( glMatrixMode( GL_TEXTURE ) );
+					CheckGLError( glPopMatrix() );
+				}
+
 				CheckGLError( glViewport( 0, 0, m_window_size.x, m_window_size.y ) );
 
 				sf::Texture::bind( m_texture_atlas[static_cast<std::size_t>( current_atlas_page )].get() );
 			}
 			else {
 				if( viewport && ( ( *viewport ) != ( *m_default_viewport ) ) ) {
-					auto destination_origin = viewport->GetDestinationOrigin();
+					auto destination_origin = viewport->GetAbsoluteDestinationOrigin();
 					auto size = viewport->GetSize();
 
 					CheckGLError( glScissor(
@@ -328,18 +386,59 @@ void VertexBufferRenderer::DisplayImpl() const {
 						sf::Texture::bind( m_texture_atlas[static_cast<std::size_t>( current_atlas_page )].get() );
 					}
 
-					CheckGLError( glDrawRangeElements(
-						GL_TRIANGLES,
-						static_cast<unsigned int>( batch.min_index ),
-						static_cast<unsigned int>( batch.max_index ),
-						batch.index_count,
-						GL_UNSIGNED_INT,
-						reinterpret_cast<const GLvoid*>( static_cast<std::size_t>( batch.start_index ) * sizeof( GLuint ) )
-					) );
+					if( !m_short_indices ) {
+						CheckGLError( glDrawRangeElements(
+							GL_TRIANGLES,
+							static_cast<unsigned int>( batch.min_index ),
+							static_cast<unsigned int>( batch.max_index ),
+							batch.index_count,
+							GL_UNSIGNED_INT,
+							reinterpret_cast<const GLvoid*>( static_cast<std::size_t>( batch.start_index ) * sizeof( GLuint ) )
+						) );
+					}
+					else if( m_base_vertex_supported ) {
+						CheckGLError( GLEXT_glDrawRangeElementsBaseVertex(
+							GL_TRIANGLES,
+							0,
+							static_cast<unsigned int>( batch.max_index - batch.base_vertex ),
+							batch.index_count,
+							GL_UNSIGNED_SHORT,
+							reinterpret_cast<const GLvoid*>( static_cast<std::size_t>( batch.start_index ) * sizeof( GLushort ) ),
+							batch.base_vertex
+						) );
+					}
+					else {
+						// Without base vertex support the pointers
+						// have to be moved to the start of the batch.
+						if( batch.base_vertex != current_base_vertex ) {
+							current_base_vertex = batch.base_vertex;
+
+							SetupPointers( current_base_vertex );
+						}
+
+						CheckGLError( glDrawRangeElements(
+							GL_TRIANGLES,
+							0,
+							static_cast<unsigned int>( batch.max_index - batch.base_vertex ),
+							batch.index_count,
+							GL_UNSIGNED_SHORT,
+							reinterpret_cast<const GLvoid*>( static_cast<std::size_t>( batch.start_index ) * sizeof( GLushort ) )
+						) );
+					}
+
+					SFGUI_PROFILE_COUNT( DRAW_CALLS, 1 );
 				}
 			}
 		}
 
+		if( m_compact ) {
+			CheckGLError( glMatrixMode( GL_MODELVIEW ) );
+			CheckGLError( glPopMatrix() );
+
+			CheckGLError( glMatrixMode( GL_TEXTURE ) );
+			CheckGLError( glPopMatrix() );
+		}
+
 		CheckGLError( glDisable( GL_SCISSOR_TEST ) );
 
 
@@ -380,219 +479,165 @@ void VertexBufferRenderer::DisplayImpl() const {
 }
 
 void VertexBufferRenderer::RefreshVBO() {
+	SFGUI_PROFILE_SCOPE( REFRESH_VBO );
+
 	SortPrimitives();
 
+	// Compact positions are as fine as the window size allows.
+	m_position_scale = m_compact ? priv::CompactPositionScale( m_window_size ) : 1.f;
+
+	std::size_t vertex_count = 0;
+	std::size_t index_count = 0;
+
+	// 16-bit indices can be used as long as every primitive fits into a batch.
+	m_short_indices = priv::RendererBatchBuilder::Count( m_primitives, vertex_count, index_count );
+
 	m_vertex_data.clear();
 	m_color_data.clear();
 	m_texture_data.clear();
+	m_compact_data.clear();
 	m_index_data.clear();
+	m_short_index_data.clear();
 
-	m_vertex_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
-	m_color_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
-	m_texture_data.reserve( static_cast<std::size_t>( m_vertex_count ) );
-	m_index_data.reserve( static_cast<std::size_t>( m_index_count ) );
-
-	m_batches.clear();
-
-	m_last_vertex_count = 0;
-	m_last_index_count = 0;
-
-	// Default viewport
-	priv::RendererBatch current_batch;
-	current_batch.viewport = m_default_viewport;
-	current_batch.atlas_page = 0;
-	current_batch.start_index = 0;
-	current_batch.index_count = 0;
-	current_batch.min_index = 0;
-	current_batch.max_index = m_vertex_count - 1;
-	current_batch.custom_draw = false;
-
-	sf::FloatRect window_viewport( { 0.f, 0.f }, sf::Vector2f( m_window_size ) );
-
-	const auto max_texture_size = GetMaxTextureSize();
-	const auto default_texture_size = m_texture_atlas[0]->getSize();
-
-	for( const auto& primitive_ptr : m_primitives ) {
-		auto primitive = primitive_ptr.get();
-
-		primitive->SetSynced();
-
-		if( !primitive->IsVisible() ) {
-			continue;
-		}
-
-		auto position_transform = primitive->GetPosition();
-
-		auto viewport = primitive->GetViewport();
-
-		auto viewport_rect = window_viewport;
-
-		// Check if primitive needs to be rendered in a custom viewport.
-		if( viewport && ( ( *viewport ) != ( *m_default_viewport ) ) ) {
-			auto destination_origin = viewport->GetDestinationOrigin();
-			auto size = viewport->GetSize();
+	if( m_compact ) {
+		m_compact_data.resize( vertex_count );
+	}
+	else {
+		m_vertex_data.resize( vertex_count );
+		m_color_data.resize( vertex_count );
+		m_texture_data.resize( vertex_count );
+	}
 
-			position_transform += ( destination_origin - viewport->GetSourceOrigin() );
+	if( m_short_indices ) {
+		m_short_index_data.resize( index_count );
+	}
+	else {
+		m_index_data.resize( index_count );
+	}
 
-			if( m_cull ) {
-				viewport_rect = { destination_origin, size };
+	struct Writer : priv::RendererBatchWriter {
+		void WriteVertex( std::size_t offset, const sf::Vector2f& position, const sf::Vector2f& texture_coordinate, const sf::Color& color, int /*layer*/ ) {
+			if( renderer->m_compact ) {
+				renderer->m_compact_data[offset] = priv::MakeCompactVertex( position, texture_coordinate, color, texture_coordinate_scale, renderer->m_position_scale );
+			}
+			else {
+				renderer->m_vertex_data[offset] = position;
+				renderer->m_color_data[offset] = color;
+				renderer->m_texture_data[offset] = texture_coordinate;
 			}
 		}
 
-		const auto& custom_draw_callback = primitive->GetCustomDrawCallback();
-
-		if( custom_draw_callback ) {
-			// Start a new batch.
-			current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-			m_batches.push_back( current_batch );
-
-			// Mark current_batch custom draw batch.
-			current_batch.viewport = viewport;
-			current_batch.start_index = 0;
-			current_batch.index_count = 0;
-			current_batch.min_index = 0;
-			current_batch.max_index = 0;
-			current_batch.custom_draw = true;
-			current_batch.custom_draw_callback = custom_draw_callback;
-
-			// Start a new batch.
-			m_batches.push_back( current_batch );
-
-			// Reset current_batch to defaults.
-			current_batch.viewport = m_default_viewport;
-			current_batch.start_index = m_last_index_count;
-			current_batch.index_count = 0;
-			current_batch.min_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-			current_batch.custom_draw = false;
+		void WriteIndex( std::size_t offset, unsigned int index ) {
+			if( renderer->m_short_indices ) {
+				renderer->m_short_index_data[offset] = static_cast<std::uint16_t>( index );
+			}
+			else {
+				renderer->m_index_data[offset] = index;
+			}
 		}
-		else {
-			// Process primitive's vertices and indices
-			const std::vector<PrimitiveVertex>& vertices( primitive->GetVertices() );
-			const std::vector<GLuint>& indices( primitive->GetIndices() );
 
-			sf::Vector2f position( 0.f, 0.f );
+		VertexBufferRenderer* renderer;
+	} writer;
 
-			sf::FloatRect bounding_rect( { 0.f, 0.f }, { 0.f, 0.f } );
+	writer.renderer = this;
 
-			auto atlas_page = 0;
+	priv::RendererBatchBuilder builder( m_batches, m_texture_atlas, GetMaxTextureSize(), m_default_viewport, m_window_size );
+	builder.SetCull( m_cull );
+	builder.SetShortIndices( m_short_indices );
+	builder.AddAll( m_primitives, writer );
+	builder.Finish();
 
-			const auto vertices_size = vertices.size();
-			sf::Vector2f normalizer;
+	m_last_vertex_count = builder.GetVertexCount();
+	m_last_index_count = builder.GetIndexCount();
 
-			for( std::size_t index = 0; index < vertices_size; ++index ) {
-				const auto vertex = vertices[index];
-				position.x = vertex.position.x + position_transform.x;
-				position.y = vertex.position.y + position_transform.y;
-
-				m_vertex_data.push_back( position );
-				m_color_data.push_back( vertex.color );
-
-				// The bound texture can only change between triangles.
-				if( index % 3 == 0 ) {
-					atlas_page = static_cast<int>( vertex.texture_coordinate.y ) / max_texture_size;
-					auto texture_size = ( vertex.texture_coordinate.y <= 1.f ) ? default_texture_size : m_texture_atlas[static_cast<std::size_t>( atlas_page )]->getSize();
-
-					// Used to normalize texture coordinates.
-					normalizer.x = 1.f / static_cast<float>( texture_size.x );
-					normalizer.y = 1.f / static_cast<float>( texture_size.y );
-				}
-
-				// Normalize SFML's pixel texture coordinates.
-				m_texture_data.emplace_back( vertex.texture_coordinate.x * normalizer.x, static_cast<float>( static_cast<int>( vertex.texture_coordinate.y ) % max_texture_size ) * normalizer.y );
-
-				// Update the bounding rect.
-				if( m_cull ) {
-					if( position.x < bounding_rect.position.x ) {
-						bounding_rect.size.x += bounding_rect.position.x - position.x;
-						bounding_rect.position.x = position.x;
-					}
-					else if( position.x > bounding_rect.position.x + bounding_rect.size.x ) {
-						bounding_rect.size.x = position.x - bounding_rect.position.x;
-					}
-
-					if( position.y < bounding_rect.position.y ) {
-						bounding_rect.size.y += bounding_rect.position.y - position.y;
-						bounding_rect.position.y = position.y;
-					}
-					else if( position.y > bounding_rect.position.y + bounding_rect.size.y ) {
-						bounding_rect.size.y = position.y - bounding_rect.position.y;
-					}
-				}
-			}
-
-			if( m_cull && !viewport_rect.findIntersection( bounding_rect ) ) {
-				m_vertex_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
-				m_color_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
-				m_texture_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
-			}
-			else {
-				for( const auto& index : indices ) {
-					m_index_data.push_back( static_cast<unsigned int>( m_last_vertex_count ) + index );
-				}
+	// Drop the vertices of culled primitives.
+	if( m_compact ) {
+		m_compact_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+	}
+	else {
+		m_vertex_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+		m_color_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+		m_texture_data.resize( static_cast<std::size_t>( m_last_vertex_count ) );
+	}
 
-				// Check if we need to start a new batch.
-				if( ( ( *viewport ) != ( *current_batch.viewport ) ) || ( atlas_page != current_batch.atlas_page ) ) {
-					current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-					m_batches.push_back( current_batch );
-
-					// Reset current_batch to defaults.
-					current_batch.viewport = viewport;
-					current_batch.atlas_page = atlas_page;
-					current_batch.start_index = m_last_index_count;
-					current_batch.index_count = 0;
-					current_batch.min_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-					current_batch.custom_draw = false;
-				}
+	if( m_short_indices ) {
+		m_short_index_data.resize( static_cast<std::size_t>( m_last_index_count ) );
+	}
+	else {
+		m_index_data.resize( static_cast<std::size_t>( m_last_index_count ) );
+	}
 
-				current_batch.index_count += static_cast<int>( indices.size() );
+	if( !m_compact_data.empty() || ( !m_vertex_data.empty() && !m_color_data.empty() && !m_texture_data.empty() ) ) {
+		if( m_compact && ( m_vbo_sync_type & ( INVALIDATE_VERTEX | INVALIDATE_COLOR | INVALIDATE_TEXTURE ) ) ) {
+			// Sync interleaved vertex data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_compact_data.size() * sizeof( priv::CompactVertex ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+			CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_compact_data.size() * sizeof( priv::CompactVertex ) ), m_compact_data.data() ) );
 
-				m_last_vertex_count += static_cast<GLsizei>( vertices.size() );
-				m_last_index_count += static_cast<GLsizei>( indices.size() );
-			}
+			SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_compact_data.size() * sizeof( priv::CompactVertex ) );
+			SFGUI_PROFILE_COUNT( UPLOADED_VERTICES, m_compact_data.size() );
 		}
-	}
-
-	current_batch.max_index = m_last_vertex_count ? ( m_last_vertex_count - 1 ) : 0;
-	m_batches.push_back( current_batch );
 
-	if( !m_vertex_data.empty() && !m_color_data.empty() && !m_texture_data.empty() ) {
-		if( m_vbo_sync_type & INVALIDATE_VERTEX ) {
+		if( !m_compact && ( m_vbo_sync_type & INVALIDATE_VERTEX ) ) {
 			// Sync vertex data
 			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
 			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_vertex_data.size() * sizeof( sf::Vector3f ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
 
 			if( m_vertex_data.size() > 0 ) {
 				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_vertex_data.size() * sizeof( sf::Vector2f ) ), m_vertex_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_vertex_data.size() * sizeof( sf::Vector2f ) );
+				SFGUI_PROFILE_COUNT( UPLOADED_VERTICES, m_vertex_data.size() );
 			}
 		}
 
-		if( m_vbo_sync_type & INVALIDATE_COLOR ) {
+		if( !m_compact && ( m_vbo_sync_type & INVALIDATE_COLOR ) ) {
 			// Sync color data
 			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_color_vbo ) );
 			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_color_data.size() * sizeof( sf::Color ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
 
 			if( m_color_data.size() > 0 ) {
 				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_color_data.size() * sizeof( sf::Color ) ), m_color_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_color_data.size() * sizeof( sf::Color ) );
 			}
 		}
 
-		if( m_vbo_sync_type & INVALIDATE_TEXTURE ) {
+		if( !m_compact && ( m_vbo_sync_type & INVALIDATE_TEXTURE ) ) {
 			// Sync texture coord data
 			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_texture_vbo ) );
 			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ARRAY_BUFFER, static_cast<int>( m_texture_data.size() * sizeof( sf::Vector2f ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
 
 			if( m_texture_data.size() > 0 ) {
 				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ARRAY_BUFFER, 0, static_cast<int>( m_texture_data.size() * sizeof( sf::Vector2f ) ), m_texture_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_texture_data.size() * sizeof( sf::Vector2f ) );
+			}
+		}
+
+		if( m_short_indices && ( m_vbo_sync_type & INVALIDATE_INDEX ) ) {
+			// Sync 16-bit index data
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_index_vbo ) );
+			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, static_cast<int>( m_short_index_data.size() * sizeof( GLushort ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
+
+			if( m_short_index_data.size() > 0 ) {
+				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<int>( m_short_index_data.size() * sizeof( GLushort ) ), m_short_index_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_short_index_data.size() * sizeof( GLushort ) );
 			}
+
+			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0 ) );
 		}
 
-		if( m_vbo_sync_type & INVALIDATE_INDEX ) {
+		if( !m_short_indices && ( m_vbo_sync_type & INVALIDATE_INDEX ) ) {
 			// Sync index data
 			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, m_index_vbo ) );
 			CheckGLError( GLEXT_glBufferData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, static_cast<int>( m_index_data.size() * sizeof( GLuint ) ), 0, GLEXT_GL_DYNAMIC_DRAW ) );
 
 			if( m_index_data.size() > 0 ) {
 				CheckGLError( GLEXT_glBufferSubData( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0, static_cast<int>( m_index_data.size() * sizeof( GLuint ) ), m_index_data.data() ) );
+
+				SFGUI_PROFILE_COUNT( UPLOADED_BYTES, m_index_data.size() * sizeof( GLuint ) );
 			}
 
 			CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ELEMENT_ARRAY_BUFFER, 0 ) );
@@ -604,6 +649,33 @@ void VertexBufferRenderer::RefreshVBO() {
 	m_vbo_sync_type = 0;
 }
 
+void VertexBufferRenderer::SetupPointers( int base_vertex ) const {
+	const auto first_vertex = static_cast<std::size_t>( base_vertex );
+
+	if( m_compact ) {
+		const auto base = reinterpret_cast<const char*>( first_vertex * sizeof( priv::CompactVertex ) );
+
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
+		CheckGLError( glVertexPointer( 2, GL_SHORT, sizeof( priv::CompactVertex ), base + offsetof( priv::CompactVertex, x ) ) );
+		CheckGLError( glTexCoordPointer( 2, GL_SHORT, sizeof( priv::CompactVertex ), base + offsetof( priv::CompactVertex, u ) ) );
+		CheckGLError( glColorPointer( 4, GL_UNSIGNED_BYTE, sizeof( priv::CompactVertex ), base + offsetof( priv::CompactVertex, color ) ) );
+	}
+	else {
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_vertex_vbo ) );
+		CheckGLError( glVertexPointer( 2, GL_FLOAT, 0, reinterpret_cast<const GLvoid*>( first_vertex * sizeof( sf::Vector2f ) ) ) );
+
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_color_vbo ) );
+		CheckGLError( glColorPointer( 4, GL_UNSIGNED_BYTE, 0, reinterpret_cast<const GLvoid*>( first_vertex * sizeof( sf::Color ) ) ) );
+
+		CheckGLError( GLEXT_glBindBuffer( GLEXT_GL_ARRAY_BUFFER, m_texture_vbo ) );
+		CheckGLError( glTexCoordPointer( 2, GL_FLOAT, 0, reinterpret_cast<const GLvoid*>( first_vertex * sizeof( sf::Vector2f ) ) ) );
+	}
+}
+
+bool VertexBufferRenderer::UsesCompactVertices() const {
+	return m_compact;
+}
+
 void VertexBufferRenderer::InvalidateVBO( unsigned char datasets ) {
 	m_vbo_sync_type |= datasets;
 	m_vbo_synced = false;
@@ -736,6 +808,11 @@ void VertexBufferRenderer::TuneUseFBO( bool enable ) {
 }
 
 void VertexBufferRenderer::InvalidateImpl( unsigned char datasets ) {
+	// Transform offsets are baked into the vertex data.
+	if( datasets & INVALIDATE_TRANSFORM ) {
+		datasets |= INVALIDATE_VERTEX;
+	}
+
 	InvalidateVBO( datasets );
 }
 
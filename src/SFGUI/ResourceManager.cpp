@@ -1,5 +1,6 @@
 #include <SFGUI/ResourceManager.hpp>
 #include <SFGUI/FileResourceLoader.hpp>
+#include <SFGUI/Engine.hpp>
 
 #if defined( SFGUI_INCLUDE_FONT )
 #include <SFGUI/DejaVuSansFont.hpp>
@@ -16,12 +17,18 @@ ResourceManager::ResourceManager( bool use_default_font ) :
 	CreateLoader<FileResourceLoader>();
 }
 
+ResourceManager::~ResourceManager() {
+	ReleaseFonts();
+}
+
 std::shared_ptr<const ResourceLoader> ResourceManager::GetLoader( const std::string& id ) {
 	auto loader_iter = m_loaders.find( id );
 	return loader_iter == m_loaders.end() ? std::shared_ptr<const ResourceLoader>() : loader_iter->second;
 }
 
 std::shared_ptr<const sf::Font> ResourceManager::GetFont( const std::string& path ) {
+	std::lock_guard<std::recursive_mutex> lock( m_mutex );
+
 	{
 		auto font_iter = m_fonts.find( path );
 
@@ -77,6 +84,8 @@ std::shared_ptr<const sf::Font> ResourceManager::GetFont( const std::string& pat
 }
 
 std::shared_ptr<const sf::Image> ResourceManager::GetImage( const std::string& path ) {
+	std::lock_guard<std::recursive_mutex> lock( m_mutex );
+
 	auto image_iter = m_images.find( path );
 
 	if( image_iter != m_images.end() ) {
@@ -129,11 +138,22 @@ std::shared_ptr<const ResourceLoader> ResourceManager::GetMatchingLoader( const
 }
 
 void ResourceManager::Clear() {
+	ReleaseFonts();
+
 	m_loaders.clear();
 	m_fonts.clear();
 	m_images.clear();
 }
 
+void ResourceManager::ReleaseFonts() {
+	// Released fonts might be destroyed and their address reused by another font.
+	for( const auto& font : m_fonts ) {
+		if( font.second ) {
+			Engine::ForgetFontMetrics( *font.second );
+		}
+	}
+}
+
 std::string ResourceManager::GetFilename( const std::string& path, const ResourceLoader& loader ) {
 	auto ident = loader.GetIdentifier() + ":";
 	auto ident_pos = path.find( ident );
@@ -146,6 +166,13 @@ std::string ResourceManager::GetFilename( const std::string& path, const Resourc
 }
 
 void ResourceManager::AddFont( const std::string& path, std::shared_ptr<const sf::Font> font ) {
+	auto font_iter = m_fonts.find( path );
+
+	// The replaced font might be destroyed and its address reused by another font.
+	if( ( font_iter != m_fonts.end() ) && font_iter->second && ( font_iter->second != font ) ) {
+		Engine::ForgetFontMetrics( *font_iter->second );
+	}
+
 	m_fonts[path] = font;
 }
 
@@ -2,6 +2,7 @@
 #include <SFGUI/Renderer.hpp>
 #include <SFGUI/Context.hpp>
 #include <SFGUI/Engine.hpp>
+#include <SFGUI/ProfilerScope.hpp>
 
 namespace {
 
@@ -26,14 +27,20 @@ SFGUI::~SFGUI() {
 
 void SFGUI::Display( sf::Window& target ) {
 	Renderer::Get().Display( target );
+
+	SFGUI_PROFILE_END_FRAME();
 }
 
 void SFGUI::Display( sf::RenderWindow& target ) {
 	Renderer::Get().Display( target );
+
+	SFGUI_PROFILE_END_FRAME();
 }
 
 void SFGUI::Display( sf::RenderTexture& target ) {
 	Renderer::Get().Display( target );
+
+	SFGUI_PROFILE_END_FRAME();
 }
 
 Renderer& SFGUI::GetRenderer() {
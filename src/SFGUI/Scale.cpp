@@ -53,6 +53,10 @@ std::unique_ptr<RenderQueue> Scale::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateScaleDrawable( std::dynamic_pointer_cast<const Scale>( shared_from_this() ) );
 }
 
+bool Scale::CanInvalidateConcurrently() const {
+	return true;
+}
+
 sf::Vector2f Scale::CalculateRequisition() {
 	auto slider_length = Context::Get().GetEngine().GetProperty<float>( "SliderLength", shared_from_this() );
 	auto slider_width = std::max( 3.f, ( GetOrientation() == Orientation::HORIZONTAL ) ? GetAllocation().size.y : GetAllocation().size.x );
@@ -64,6 +68,10 @@ sf::Vector2f Scale::CalculateRequisition() {
 	return sf::Vector2f( slider_width, slider_length * 2.f );
 }
 
+bool Scale::CanMeasureConcurrently() const {
+	return true;
+}
+
 void Scale::HandleMouseButtonEvent( sf::Mouse::Button button, bool press, int x, int y ) {
 	if( button != sf::Mouse::Button::Left ) {
 		return;
@@ -83,6 +83,10 @@ std::unique_ptr<RenderQueue> Scrollbar::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateScrollbarDrawable( std::dynamic_pointer_cast<const Scrollbar>( shared_from_this() ) );
 }
 
+bool Scrollbar::CanInvalidateConcurrently() const {
+	return true;
+}
+
 sf::Vector2f Scrollbar::CalculateRequisition() {
 	float mimimum_slider_length( Context::Get().GetEngine().GetProperty<float>( "SliderMinimumLength", shared_from_this() ) );
 
@@ -92,6 +96,10 @@ sf::Vector2f Scrollbar::CalculateRequisition() {
 	return sf::Vector2f( mimimum_slider_length, mimimum_slider_length );
 }
 
+bool Scrollbar::CanMeasureConcurrently() const {
+	return true;
+}
+
 void Scrollbar::HandleMouseButtonEvent( sf::Mouse::Button button, bool press, int x, int y ) {
 	if( button != sf::Mouse::Button::Left ) {
 		return;
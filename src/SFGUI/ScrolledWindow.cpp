@@ -133,6 +133,10 @@ std::unique_ptr<RenderQueue> ScrolledWindow::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateScrolledWindowDrawable( std::dynamic_pointer_cast<const ScrolledWindow>( shared_from_this() ) );
 }
 
+bool ScrolledWindow::CanInvalidateConcurrently() const {
+	return true;
+}
+
 sf::Vector2f ScrolledWindow::CalculateRequisition() {
 	float scrollbar_width( Context::Get().GetEngine().GetProperty<float>( "ScrollbarWidth", shared_from_this() ) );
 	float scrollbar_spacing( Context::Get().GetEngine().GetProperty<float>( "ScrollbarSpacing", shared_from_this() ) );
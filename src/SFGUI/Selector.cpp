@@ -8,7 +8,8 @@ namespace sfg {
 
 Selector::Selector() :
 	m_hierarchy_type( HierarchyType::INVALID ),
-	m_hash( 0 )
+	m_hash( 0 ),
+	m_score( 0 )
 {
 }
 
@@ -17,7 +18,8 @@ Selector::Selector( const Selector& other ) :
 	m_widget( other.m_widget ),
 	m_id( other.m_id ),
 	m_class( other.m_class ),
-	m_hash( 0 )
+	m_hash( 0 ),
+	m_score( other.m_score )
 {
 	if( other.m_state ) {
 		m_state.reset( new Widget::State( *other.m_state ) );
@@ -34,6 +36,7 @@ Selector& Selector::operator=( const Selector& other ) {
 	m_id = other.m_id;
 	m_class = other.m_class;
 	m_hash = other.m_hash;
+	m_score = other.m_score;
 
 	if( other.m_state ) {
 		m_state.reset( new Widget::State( *other.m_state ) );
@@ -85,10 +88,46 @@ Selector::Ptr Selector::Create( const std::string& widget, const std::string& id
 	}
 
 	selector->m_hash = std::hash<std::string>()( selector->BuildString() );
+	selector->m_score = selector->CalculateScore();
 
 	return selector;
 }
 
+/// @cond
+
+Selector::Ptr Selector::Create( const std::string& widget, const std::string& id, const std::string& class_, const Widget::State* state, HierarchyType hierarchy, Ptr parent, std::size_t hash, int score ) {
+	Ptr selector( new Selector );
+
+	selector->m_widget = widget;
+	selector->m_id = id;
+	selector->m_class = class_;
+
+	if( state ) {
+		selector->m_state.reset( new Widget::State( *state ) );
+	}
+
+	selector->m_hierarchy_type = hierarchy;
+
+	if( hierarchy != HierarchyType::ROOT ) {
+		selector->m_parent = parent;
+	}
+
+	selector->m_hash = hash;
+	selector->m_score = score;
+
+	return selector;
+}
+
+std::size_t Selector::GetHash() const {
+	return m_hash;
+}
+
+Selector::HierarchyType Selector::GetHierarchyType() const {
+	return m_hierarchy_type;
+}
+
+/// @endcond
+
 const std::string& Selector::GetWidgetName() const {
 	return m_widget;
 }
@@ -228,6 +267,10 @@ bool Selector::Matches( Widget::PtrConst widget ) const {
 }
 
 int Selector::GetScore() const {
+	return m_score;
+}
+
+int Selector::CalculateScore() const {
 	int score = 0;
 
 	score += ( ( GetWidgetName().empty() || ( GetWidgetName() == "*" ) ) ? 0 : 1 );
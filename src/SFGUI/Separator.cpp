@@ -24,10 +24,18 @@ std::unique_ptr<RenderQueue> Separator::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateSeparatorDrawable( std::dynamic_pointer_cast<const Separator>( shared_from_this() ) );
 }
 
+bool Separator::CanInvalidateConcurrently() const {
+	return true;
+}
+
 sf::Vector2f Separator::CalculateRequisition() {
 	return sf::Vector2f( 2.f, 2.f );
 }
 
+bool Separator::CanMeasureConcurrently() const {
+	return true;
+}
+
 const std::string& Separator::GetName() const {
 	static const std::string name( "Separator" );
 	return name;
@@ -48,6 +48,10 @@ std::unique_ptr<RenderQueue> SpinButton::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateSpinButtonDrawable( std::dynamic_pointer_cast<const SpinButton>( shared_from_this() ) );
 }
 
+bool SpinButton::CanInvalidateConcurrently() const {
+	return true;
+}
+
 sf::Vector2f SpinButton::CalculateRequisition() {
 	const std::string& font_name( Context::Get().GetEngine().GetProperty<std::string>( "FontName", shared_from_this() ) );
 	unsigned int font_size( Context::Get().GetEngine().GetProperty<unsigned int>( "FontSize", shared_from_this() ) );
@@ -59,6 +63,10 @@ sf::Vector2f SpinButton::CalculateRequisition() {
 	return sf::Vector2f( 2 * (border_width + text_padding), line_height + 2 * ( border_width + text_padding ) );
 }
 
+bool SpinButton::CanMeasureConcurrently() const {
+	return true;
+}
+
 const std::string& SpinButton::GetName() const {
 	static const std::string name( "SpinButton" );
 	return name;
@@ -40,11 +40,19 @@ std::unique_ptr<RenderQueue> Spinner::InvalidateImpl() const {
 	return Context::Get().GetEngine().CreateSpinnerDrawable( std::dynamic_pointer_cast<const Spinner>( shared_from_this() ) );
 }
 
+bool Spinner::CanInvalidateConcurrently() const {
+	return true;
+}
+
 sf::Vector2f Spinner::CalculateRequisition() {
 	// Make it obvious where the spinner is if the user forgot to set requisition.
 	return sf::Vector2f( 4.f, 4.f );
 }
 
+bool Spinner::CanMeasureConcurrently() const {
+	return true;
+}
+
 const std::string& Spinner::GetName() const {
 	static const std::string name( "Spinner" );
 	return name;
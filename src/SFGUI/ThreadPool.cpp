@@ -0,0 +1,159 @@
+#include <SFGUI/ThreadPool.hpp>
+
+namespace sfg {
+namespace priv {
+
+ThreadPool::ThreadPool( unsigned int thread_count ) :
+	m_task( nullptr ),
+	m_pending_tasks( 0 ),
+	m_generation( 0 ),
+	m_stop( false )
+{
+	// Queue 0 belongs to the thread calling Run().
+	for( unsigned int index = 0; index <= thread_count; ++index ) {
+		m_queues.emplace_back( new Queue );
+	}
+
+	for( unsigned int index = 1; index <= thread_count; ++index ) {
+		m_threads.emplace_back( &ThreadPool::WorkerLoop, this, static_cast<std::size_t>( index ) );
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+		m_stop = true;
+	}
+
+	m_work_condition.notify_all();
+
+	for( auto& thread : m_threads ) {
+		thread.join();
+	}
+}
+
+unsigned int ThreadPool::GetThreadCount() const {
+	return static_cast<unsigned int>( m_threads.size() );
+}
+
+void ThreadPool::Run( std::size_t count, const std::function<void( std::size_t )>& task ) {
+	if( !count ) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock( m_mutex );
+
+		m_task = &task;
+		m_exception = nullptr;
+		m_pending_tasks = count;
+
+		// Hand every queue a contiguous range of tasks, neighbouring
+		// widgets tend to have a similar amount of work.
+		auto queue_count = m_queues.size();
+
+		for( std::size_t queue_index = 0; queue_index < queue_count; ++queue_index ) {
+			auto begin = count * queue_index / queue_count;
+			auto end = count * ( queue_index + 1 ) / queue_count;
+
+			std::lock_guard<std::mutex> queue_lock( m_queues[queue_index]->mutex );
+
+			for( auto index = begin; index < end; ++index ) {
+				m_queues[queue_index]->tasks.push_back( index );
+			}
+		}
+
+		++m_generation;
+	}
+
+	m_work_condition.notify_all();
+
+	ProcessTasks( 0 );
+
+	std::unique_lock<std::mutex> lock( m_mutex );
+
+	m_done_condition.wait( lock, [this] { return !m_pending_tasks; } );
+
+	m_task = nullptr;
+
+	if( m_exception ) {
+		auto exception = m_exception;
+		m_exception = nullptr;
+
+		std::rethrow_exception( exception );
+	}
+}
+
+void ThreadPool::WorkerLoop( std::size_t queue_index ) {
+	std::size_t generation = 0;
+
+	while( true ) {
+		{
+			std::unique_lock<std::mutex> lock( m_mutex );
+
+			m_work_condition.wait( lock, [this, generation] { return m_stop || ( m_generation != generation ); } );
+
+			if( m_stop ) {
+				return;
+			}
+
+			generation = m_generation;
+		}
+
+		ProcessTasks( queue_index );
+	}
+}
+
+void ThreadPool::ProcessTasks( std::size_t queue_index ) {
+	std::size_t task = 0;
+
+	while( PopTask( queue_index, task ) ) {
+		try {
+			( *m_task )( task );
+		}
+		catch( ... ) {
+			std::lock_guard<std::mutex> lock( m_mutex );
+
+			if( !m_exception ) {
+				m_exception = std::current_exception();
+			}
+		}
+
+		std::lock_guard<std::mutex> lock( m_mutex );
+
+		if( !--m_pending_tasks ) {
+			m_done_condition.notify_all();
+		}
+	}
+}
+
+bool ThreadPool::PopTask( std::size_t queue_index, std::size_t& task ) {
+	// Take from the front of our own queue first.
+	{
+		auto& queue = *m_queues[queue_index];
+		std::lock_guard<std::mutex> lock( queue.mutex );
+
+		if( !queue.tasks.empty() ) {
+			task = queue.tasks.front();
+			queue.tasks.pop_front();
+			return true;
+		}
+	}
+
+	// Steal from the back of the other queues.
+	for( std::size_t offset = 1; offset < m_queues.size(); ++offset ) {
+		auto& queue = *m_queues[( queue_index + offset ) % m_queues.size()];
+		std::lock_guard<std::mutex> lock( queue.mutex );
+
+		if( !queue.tasks.empty() ) {
+			task = queue.tasks.back();
+			queue.tasks.pop_back();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+}
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <SFGUI/Config.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <cstddef>
+
+namespace sfg {
+namespace priv {
+
+/** Work-stealing thread pool.
+ * Every participating thread owns a queue of task indices. Threads take
+ * tasks from the front of their own queue and steal from the back of
+ * other queues once their own queue is empty.
+ */
+class ThreadPool {
+	public:
+		/** Ctor.
+		 * @param thread_count Number of worker threads to spawn.
+		 */
+		explicit ThreadPool( unsigned int thread_count );
+
+		/** Dtor.
+		 */
+		~ThreadPool();
+
+		ThreadPool( const ThreadPool& ) = delete;
+		ThreadPool& operator=( const ThreadPool& ) = delete;
+
+		/** Get the number of worker threads.
+		 * @return Number of worker threads.
+		 */
+		unsigned int GetThreadCount() const;
+
+		/** Run task for all indices in [0, count) and wait until all are done.
+		 * The calling thread takes part in processing the tasks. The first
+		 * exception thrown by a task is rethrown after all tasks finished.
+		 * @param count Number of tasks.
+		 * @param task Task to run, called with the index of the task.
+		 */
+		void Run( std::size_t count, const std::function<void( std::size_t )>& task );
+
+	private:
+		struct Queue {
+			std::mutex mutex;
+			std::deque<std::size_t> tasks;
+		};
+
+		void WorkerLoop( std::size_t queue_index );
+		void ProcessTasks( std::size_t queue_index );
+		bool PopTask( std::size_t queue_index, std::size_t& task );
+
+		std::vector<std::thread> m_threads;
+		std::vector<std::unique_ptr<Queue>> m_queues;
+
+		std::mutex m_mutex;
+		std::condition_variable m_work_condition;
+		std::condition_variable m_done_condition;
+
+		const std::function<void( std::size_t )>* m_task;
+		std::exception_ptr m_exception;
+
+		std::size_t m_pending_tasks;
+		std::size_t m_generation;
+		bool m_stop;
+};
+
+}
+}
@@ -0,0 +1,295 @@
+#include <SFGUI/TreeView.hpp>
+#include <SFGUI/TreeViewRow.hpp>
+
+namespace sfg {
+
+const TreeView::NodeID TreeView::ROOT = 0;
+
+TreeView::TreeView() :
+	m_list_view( ListView::Create(
+		[this] {
+			auto row = TreeViewRow::Create();
+			auto row_ptr = row.get();
+
+			// Rows are recycled, look up the bound node when clicked.
+			row->GetSignal( Widget::OnLeftClick ).Connect( [this, row_ptr] {
+				Toggle( row_ptr->GetNode() );
+			} );
+
+			return row;
+		},
+		[this]( Widget::Ptr row, ListView::IndexType index ) {
+			BindRow( row, index );
+		}
+	) ),
+	m_visible_nodes_changed( false )
+{
+	m_nodes.push_back( Node{ ROOT, sf::String(), std::vector<NodeID>(), std::vector<std::size_t>(), 0, 0, 1, true, true } );
+}
+
+TreeView::Ptr TreeView::Create() {
+	Ptr ptr( new TreeView );
+
+	std::static_pointer_cast<Container>( ptr )->Add( ptr->m_list_view );
+
+	return ptr;
+}
+
+const std::string& TreeView::GetName() const {
+	static const std::string name( "TreeView" );
+	return name;
+}
+
+void TreeView::SetPopulateCallback( PopulateCallback callback ) {
+	m_populate_callback = callback;
+}
+
+TreeView::NodeID TreeView::AppendNode( NodeID parent, const sf::String& text, bool expandable ) {
+	auto id = m_nodes.size();
+	auto depth = ( parent == ROOT ) ? 0u : m_nodes[parent].depth + 1;
+
+	m_nodes.push_back( Node{ parent, text, std::vector<NodeID>(), std::vector<std::size_t>(), depth, m_nodes[parent].children.size(), 1, expandable, false } );
+	m_nodes[parent].expandable = true;
+
+	// Append the row of the new node to the Fenwick tree of its parent.
+	auto& siblings = m_nodes[parent];
+	auto position = siblings.children.size() + 1;
+
+	siblings.children.push_back( id );
+	siblings.child_rows.push_back( 1 + CountChildRows( parent, position - 1 ) - CountChildRows( parent, position - ( position & ( ~position + 1 ) ) ) );
+
+	// Children of collapsed nodes, e.g. while being populated, aren't visible at all.
+	if( m_nodes[parent].expanded ) {
+		UpdateVisibleRows( parent, 1 );
+
+		if( ( parent == ROOT ) || IsNodeShown( parent ) ) {
+			m_visible_nodes_changed = true;
+		}
+	}
+
+	return id;
+}
+
+void TreeView::Clear() {
+	m_nodes.resize( 1 );
+	m_nodes[ROOT].children.clear();
+	m_nodes[ROOT].child_rows.clear();
+	m_nodes[ROOT].visible_rows = 1;
+	m_visible_nodes_changed = true;
+}
+
+std::size_t TreeView::GetNodeCount() const {
+	return m_nodes.size() - 1;
+}
+
+void TreeView::SetNodeText( NodeID node, const sf::String& text ) {
+	m_nodes[node].text = text;
+
+	if( IsNodeShown( node ) ) {
+		m_visible_nodes_changed = true;
+	}
+}
+
+const sf::String& TreeView::GetNodeText( NodeID node ) const {
+	return m_nodes[node].text;
+}
+
+TreeView::NodeID TreeView::GetParent( NodeID node ) const {
+	return m_nodes[node].parent;
+}
+
+const std::vector<TreeView::NodeID>& TreeView::GetChildren( NodeID node ) const {
+	return m_nodes[node].children;
+}
+
+void TreeView::Expand( NodeID node ) {
+	if( ( node == ROOT ) || !m_nodes[node].expandable || m_nodes[node].expanded ) {
+		return;
+	}
+
+	// Populate lazily on first expansion.
+	if( m_nodes[node].children.empty() && m_populate_callback ) {
+		m_populate_callback( node );
+	}
+
+	m_nodes[node].expanded = true;
+
+	UpdateVisibleRows( node, CountChildRows( node, m_nodes[node].children.size() ) );
+
+	if( IsNodeShown( node ) ) {
+		m_visible_nodes_changed = true;
+	}
+}
+
+void TreeView::Collapse( NodeID node ) {
+	if( ( node == ROOT ) || !m_nodes[node].expanded ) {
+		return;
+	}
+
+	// Unsigned arithmetic wraps, adding the negated count removes the rows.
+	UpdateVisibleRows( node, std::size_t( 0 ) - CountChildRows( node, m_nodes[node].children.size() ) );
+
+	m_nodes[node].expanded = false;
+
+	if( IsNodeShown( node ) ) {
+		m_visible_nodes_changed = true;
+	}
+}
+
+void TreeView::Toggle( NodeID node ) {
+	if( IsExpanded( node ) ) {
+		Collapse( node );
+	}
+	else {
+		Expand( node );
+	}
+}
+
+bool TreeView::IsExpanded( NodeID node ) const {
+	return m_nodes[node].expanded;
+}
+
+std::pair<std::size_t, std::size_t> TreeView::GetVisibleRange() const {
+	return m_list_view->GetVisibleRange();
+}
+
+std::size_t TreeView::GetRowCount() const {
+	return m_list_view->GetRowCount();
+}
+
+sf::Vector2f TreeView::CalculateRequisition() {
+	return m_list_view->GetRequisition();
+}
+
+void TreeView::HandleUpdate( float seconds ) {
+	// Apply all changes to the visible nodes since the last
+	// update at once, only the visible rows are rebound.
+	if( m_visible_nodes_changed ) {
+		m_visible_nodes_changed = false;
+
+		// The invisible root doesn't have a row.
+		m_list_view->SetItemCount( m_nodes[ROOT].visible_rows - 1 );
+		m_list_view->RefreshItems();
+	}
+
+	Container::HandleUpdate( seconds );
+}
+
+bool TreeView::HandleAdd( Widget::Ptr child ) {
+	// The only child is the list view holding the rows.
+	if( child != m_list_view ) {
+
+#if defined( SFGUI_DEBUG )
+		std::cerr << "SFGUI warning: Widgets can't be added to sfg::TreeView, use AppendNode.\n";
+#endif
+
+		return false;
+	}
+
+	return Container::HandleAdd( child );
+}
+
+void TreeView::HandleSizeChange() {
+	m_list_view->SetAllocation( sf::FloatRect( { 0.f, 0.f }, GetAllocation().size ) );
+}
+
+bool TreeView::IsNodeShown( NodeID node ) const {
+	if( node == ROOT ) {
+		return false;
+	}
+
+	for( auto parent = m_nodes[node].parent; parent != ROOT; parent = m_nodes[parent].parent ) {
+		if( !m_nodes[parent].expanded ) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+std::size_t TreeView::CountChildRows( NodeID node, std::size_t end ) const {
+	const auto& child_rows = m_nodes[node].child_rows;
+	auto rows = std::size_t( 0 );
+
+	// Sum the visible rows of the first end children.
+	for( auto position = end; position > 0; position -= position & ( ~position + 1 ) ) {
+		rows += child_rows[position - 1];
+	}
+
+	return rows;
+}
+
+void TreeView::AddChildRows( NodeID node, std::size_t child, std::size_t rows ) {
+	auto& child_rows = m_nodes[node].child_rows;
+
+	for( auto position = child + 1; position <= child_rows.size(); position += position & ( ~position + 1 ) ) {
+		child_rows[position - 1] += rows;
+	}
+}
+
+void TreeView::UpdateVisibleRows( NodeID node, std::size_t rows ) {
+	// Walk up as long as the rows of the subtree are visible to the parent.
+	while( true ) {
+		m_nodes[node].visible_rows += rows;
+
+		if( node == ROOT ) {
+			break;
+		}
+
+		auto parent = m_nodes[node].parent;
+
+		AddChildRows( parent, m_nodes[node].index, rows );
+
+		if( !m_nodes[parent].expanded ) {
+			break;
+		}
+
+		node = parent;
+	}
+}
+
+TreeView::NodeID TreeView::FindVisibleNode( std::size_t index ) const {
+	auto node = ROOT;
+
+	// Descend into the child whose subtree contains the row.
+	while( true ) {
+		const auto& child_rows = m_nodes[node].child_rows;
+
+		auto step = std::size_t( 1 );
+
+		while( ( step << 1 ) <= child_rows.size() ) {
+			step <<= 1;
+		}
+
+		auto position = std::size_t( 0 );
+
+		for( ; step; step >>= 1 ) {
+			if( ( position + step <= child_rows.size() ) && ( child_rows[position + step - 1] <= index ) ) {
+				position += step;
+				index -= child_rows[position - 1];
+			}
+		}
+
+		node = m_nodes[node].children[position];
+
+		if( !index ) {
+			return node;
+		}
+
+		// Skip the row of the node itself.
+		--index;
+	}
+}
+
+void TreeView::BindRow( Widget::Ptr row, std::size_t index ) const {
+	if( index + 1 >= m_nodes[ROOT].visible_rows ) {
+		return;
+	}
+
+	auto id = FindVisibleNode( index );
+	const auto& node = m_nodes[id];
+
+	std::static_pointer_cast<TreeViewRow>( row )->SetNode( id, node.text, node.depth, node.expandable, node.expanded );
+}
+
+}
@@ -0,0 +1,102 @@
+#include <SFGUI/TreeViewRow.hpp>
+#include <SFGUI/Context.hpp>
+#include <SFGUI/Engine.hpp>
+#include <SFGUI/RenderQueue.hpp>
+
+namespace sfg {
+
+TreeViewRow::TreeViewRow() :
+	m_node( 0 ),
+	m_depth( 0 ),
+	m_expandable( false ),
+	m_expanded( false )
+{
+}
+
+TreeViewRow::Ptr TreeViewRow::Create() {
+	return Ptr( new TreeViewRow );
+}
+
+const std::string& TreeViewRow::GetName() const {
+	static const std::string name( "TreeViewRow" );
+	return name;
+}
+
+void TreeViewRow::SetNode( std::size_t node, const sf::String& text, unsigned int depth, bool expandable, bool expanded ) {
+	auto resize = ( text != m_text ) || ( depth != m_depth );
+
+	m_node = node;
+	m_text = text;
+	m_depth = depth;
+	m_expandable = expandable;
+	m_expanded = expanded;
+
+	if( resize ) {
+		RequestResize();
+	}
+
+	Invalidate();
+}
+
+std::size_t TreeViewRow::GetNode() const {
+	return m_node;
+}
+
+const sf::String& TreeViewRow::GetText() const {
+	return m_text;
+}
+
+unsigned int TreeViewRow::GetDepth() const {
+	return m_depth;
+}
+
+bool TreeViewRow::IsExpandable() const {
+	return m_expandable;
+}
+
+bool TreeViewRow::IsExpanded() const {
+	return m_expanded;
+}
+
+std::unique_ptr<RenderQueue> TreeViewRow::InvalidateImpl() const {
+	return Context::Get().GetEngine().CreateTreeViewRowDrawable( std::dynamic_pointer_cast<const TreeViewRow>( shared_from_this() ) );
+}
+
+bool TreeViewRow::CanInvalidateConcurrently() const {
+	return true;
+}
+
+sf::Vector2f TreeViewRow::CalculateRequisition() {
+	const std::string& font_name( Context::Get().GetEngine().GetProperty<std::string>( "FontName", shared_from_this() ) );
+	unsigned int font_size( Context::Get().GetEngine().GetProperty<unsigned int>( "FontSize", shared_from_this() ) );
+	float padding( Context::Get().GetEngine().GetProperty<float>( "ItemPadding", shared_from_this() ) );
+	float indent( Context::Get().GetEngine().GetProperty<float>( "Indent", shared_from_this() ) );
+	const sf::Font& font( *Context::Get().GetEngine().GetResourceManager().GetFont( font_name ) );
+
+	auto line_height = Context::Get().GetEngine().GetFontLineHeight( font, font_size );
+	auto metrics = Context::Get().GetEngine().GetTextStringMetrics( m_text, font, font_size );
+
+	// Indentation, expander and text, the expander is as wide as a line is high.
+	return sf::Vector2f(
+		static_cast<float>( m_depth ) * indent + line_height + metrics.x + 3.f * padding,
+		line_height + 2.f * padding
+	);
+}
+
+bool TreeViewRow::CanMeasureConcurrently() const {
+	return true;
+}
+
+void TreeViewRow::HandleMouseEnter( int /*x*/, int /*y*/ ) {
+	if( GetState() == State::NORMAL ) {
+		SetState( State::PRELIGHT );
+	}
+}
+
+void TreeViewRow::HandleMouseLeave( int /*x*/, int /*y*/ ) {
+	if( GetState() == State::PRELIGHT ) {
+		SetState( State::NORMAL );
+	}
+}
+
+}
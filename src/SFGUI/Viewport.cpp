@@ -1,6 +1,7 @@
 #include <SFGUI/Viewport.hpp>
 #include <SFGUI/Adjustment.hpp>
 #include <SFGUI/RendererViewport.hpp>
+#include <SFGUI/RendererTransform.hpp>
 #include <SFGUI/Renderer.hpp>
 #include <SFGUI/RenderQueue.hpp>
 
@@ -14,6 +15,7 @@ Viewport::Viewport() :
 	m_vertical_adjustment_signal_serial( 0 )
 {
 	m_children_viewport = Renderer::Get().CreateViewport();
+	m_children_viewport->SetTransform( GetTransform() );
 }
 
 Viewport::Ptr Viewport::Create() {
@@ -56,7 +58,8 @@ void Viewport::HandleSizeChange() {
 }
 
 void Viewport::HandleAbsolutePositionChange() {
-	auto position = Widget::GetAbsolutePosition();
+	// The destination origin is relative to our transform.
+	auto position = Widget::GetAbsolutePosition() - GetTransform()->GetOffset();
 
 	m_children_viewport->SetDestinationOrigin(
 		sf::Vector2f(
@@ -237,6 +240,12 @@ void Viewport::HandleViewportUpdate() {
 	}
 }
 
+void Viewport::HandleTransformUpdate() {
+	m_children_viewport->SetTransform( GetTransform() );
+
+	Container::HandleTransformUpdate();
+}
+
 void Viewport::UpdateView() {
 	m_children_viewport->SetSourceOrigin(
 		sf::Vector2f(
@@ -2,14 +2,22 @@
 #include <SFGUI/Container.hpp>
 #include <SFGUI/Renderer.hpp>
 #include <SFGUI/RendererViewport.hpp>
+#include <SFGUI/RendererTransform.hpp>
 #include <SFGUI/RenderQueue.hpp>
 #include <SFGUI/Context.hpp>
+#include <SFGUI/Engine.hpp>
+#include <SFGUI/ResourceManager.hpp>
 #include <SFGUI/Primitive.hpp>
+#include <SFGUI/ThreadPool.hpp>
+#include <SFGUI/ProfilerScope.hpp>
 
 #include <SFML/Window/Event.hpp>
 #include <algorithm>
+#include <exception>
 #include <cmath>
 #include <limits>
+#include <unordered_set>
+#include <set>
 
 namespace {
 
@@ -60,6 +68,9 @@ Widget::Widget() :
 {
 	m_viewport = Renderer::Get().GetDefaultViewport();
 
+	// Root widgets own their transform.
+	m_transform = Renderer::Get().CreateTransform();
+
 	// Register this as a root widget initially.
 	root_widgets.push_back( this );
 }
@@ -123,6 +134,8 @@ bool Widget::HasFocus( PtrConst widget ) {
 }
 
 void Widget::SetAllocation( const sf::FloatRect& rect ) {
+	SFGUI_PROFILE_SCOPE( LAYOUT );
+
 	sf::FloatRect oldallocation( m_allocation );
 
 	// Make sure allocation is pixel-aligned.
@@ -143,7 +156,14 @@ void Widget::SetAllocation( const sf::FloatRect& rect ) {
 
 	if( ( oldallocation.position.y != m_allocation.position.y ) || ( oldallocation.position.x != m_allocation.position.x ) ) {
 	  HandlePositionChange();
-	  HandleAbsolutePositionChange();
+
+	  if( m_parent.lock() ) {
+	    HandleAbsolutePositionChange();
+	  }
+	  else {
+	    // Moving a root widget moves its entire hierarchy along with it.
+	    m_transform->SetOffset( m_allocation.position );
+	  }
 	}
 
 	if( ( oldallocation.size.x != m_allocation.size.x ) || ( oldallocation.size.y != m_allocation.size.y ) ) {
@@ -156,25 +176,12 @@ void Widget::SetAllocation( const sf::FloatRect& rect ) {
 }
 
 void Widget::RequestResize() {
-	m_requisition = CalculateRequisition();
+	SFGUI_PROFILE_SCOPE( LAYOUT );
 
-	if( m_custom_requisition ) {
-		if( m_custom_requisition->x > 0.f ) {
-			m_requisition.x = std::max( m_custom_requisition->x, m_requisition.x );
-		}
-
-		if( m_custom_requisition->y > 0.f ) {
-			m_requisition.y = std::max( m_custom_requisition->y, m_requisition.y );
-		}
-	}
-
-	HandleRequisitionChange();
+	ApplyRequisition( CalculateRequisition() );
 
 	auto parent = m_parent.lock();
 
-	// Notify observers.
-	GetSignals().Emit( OnSizeRequest );
-
 	if( parent ) {
 		parent->RequestResize();
 	}
@@ -188,33 +195,137 @@ void Widget::RequestResize() {
 	}
 }
 
+void Widget::ApplyRequisition( const sf::Vector2f& requisition ) {
+	m_requisition = requisition;
+
+	if( m_custom_requisition ) {
+		if( m_custom_requisition->x > 0.f ) {
+			m_requisition.x = std::max( m_custom_requisition->x, m_requisition.x );
+		}
+
+		if( m_custom_requisition->y > 0.f ) {
+			m_requisition.y = std::max( m_custom_requisition->y, m_requisition.y );
+		}
+	}
+
+	HandleRequisitionChange();
+
+	// Notify observers.
+	GetSignals().Emit( OnSizeRequest );
+}
 
 const sf::FloatRect& Widget::GetAllocation() const {
 	return m_allocation;
 }
 
 void Widget::Update( float seconds ) {
-	if( m_invalidated ) {
+	// Root widgets build the drawables of their hierarchy
+	// on the worker threads first, if there are any.
+	if( m_parent.expired() && Context::Get().GetThreadPool() ) {
+		SFGUI_PROFILE_SCOPE( DRAWABLES );
+
+		BuildDrawablesConcurrently();
+	}
+
+	// Widgets that are scrolled out of their viewport keep their
+	// invalidation pending and only build their drawable once they
+	// scroll back into view.
+	if( m_invalidated && IsInViewport() ) {
+		SFGUI_PROFILE_SCOPE( DRAWABLES );
+		SFGUI_PROFILE_COUNT( INVALIDATED_WIDGETS, 1 );
+
 		m_invalidated = false;
 		m_parent_notified = false;
 
-		m_drawable = InvalidateImpl();
+		SetDrawable( InvalidateImpl() );
+	}
 
-		if( m_drawable ) {
-			m_drawable->SetPosition( GetAbsolutePosition() );
-			m_drawable->SetLevel( m_hierarchy_level );
-			m_drawable->SetZOrder( m_z_order );
-			m_drawable->Show( IsGloballyVisible() );
+	SFGUI_PROFILE_SCOPE( HANDLE_UPDATE );
 
-			// We don't want to propagate container viewports for Canvases,
-			// they have their own special viewport for drawing.
-			if( m_drawable->GetPrimitives().empty() || !m_drawable->GetPrimitives()[0]->GetCustomDrawCallback() ) {
-				m_drawable->SetViewport( m_viewport );
-			}
+	HandleUpdate( seconds );
+}
+
+void Widget::BuildDrawablesConcurrently() {
+	// Not worth waking up the worker threads for only a few widgets.
+	const static auto min_concurrent_widgets = 16u;
+
+	std::vector<Widget*> widgets;
+	CollectConcurrentInvalidations( widgets );
+
+	if( widgets.size() < min_concurrent_widgets ) {
+		return;
+	}
+
+	SFGUI_PROFILE_COUNT( INVALIDATED_WIDGETS, widgets.size() );
+
+	// The atlas is only updated on this thread, load the fonts
+	// the widgets draw their text with before dispatching.
+	const auto& engine = Context::Get().GetEngine();
+	std::set<std::pair<const sf::Font*, unsigned int>> fonts;
+
+	for( auto widget : widgets ) {
+		widget->m_invalidated = false;
+		widget->m_parent_notified = false;
+
+		auto font = engine.GetResourceManager().GetFont( engine.GetProperty<std::string>( "FontName", widget->shared_from_this() ) );
+		auto font_size = engine.GetProperty<unsigned int>( "FontSize", widget->shared_from_this() );
+
+		if( font && fonts.emplace( font.get(), font_size ).second ) {
+			Renderer::Get().PreloadFont( *font, font_size );
 		}
 	}
 
-	HandleUpdate( seconds );
+	std::vector<std::unique_ptr<RenderQueue>> drawables( widgets.size() );
+	std::exception_ptr exception;
+
+	// Primitives built on the worker threads are only
+	// handed to the renderer once all of them are done.
+	Renderer::Get().DeferPrimitives();
+
+	try {
+		Context::Get().GetThreadPool()->Run( widgets.size(), [&widgets, &drawables]( std::size_t index ) {
+			drawables[index] = widgets[index]->InvalidateImpl();
+		} );
+	}
+	catch( ... ) {
+		exception = std::current_exception();
+	}
+
+	Renderer::Get().CommitPrimitives();
+
+	for( std::size_t index = 0; index < widgets.size(); ++index ) {
+		widgets[index]->SetDrawable( std::move( drawables[index] ) );
+	}
+
+	if( exception ) {
+		std::rethrow_exception( exception );
+	}
+}
+
+void Widget::CollectConcurrentInvalidations( std::vector<Widget*>& widgets ) {
+	if( m_invalidated && CanInvalidateConcurrently() && IsInViewport() ) {
+		widgets.push_back( this );
+	}
+}
+
+void Widget::SetDrawable( std::unique_ptr<RenderQueue> drawable ) {
+	m_drawable = std::move( drawable );
+
+	if( !m_drawable ) {
+		return;
+	}
+
+	m_drawable->SetPosition( GetDrawablePosition() );
+	m_drawable->SetTransform( m_transform );
+	m_drawable->SetLevel( m_hierarchy_level );
+	m_drawable->SetZOrder( m_z_order );
+	m_drawable->Show( IsGloballyVisible() );
+
+	// We don't want to propagate container viewports for Canvases,
+	// they have their own special viewport for drawing.
+	if( m_drawable->GetPrimitives().empty() || !m_drawable->GetPrimitives()[0]->GetCustomDrawCallback() ) {
+		m_drawable->SetViewport( m_viewport );
+	}
 }
 
 void Widget::Invalidate() const {
@@ -237,6 +348,14 @@ std::unique_ptr<RenderQueue> Widget::InvalidateImpl() const {
 	return nullptr;
 }
 
+bool Widget::CanInvalidateConcurrently() const {
+	return false;
+}
+
+bool Widget::CanMeasureConcurrently() const {
+	return false;
+}
+
 void Widget::SetParent( Widget::Ptr parent ) {
 	auto cont = std::dynamic_pointer_cast<Container>( parent );
 	auto oldparent = m_parent.lock();
@@ -260,6 +379,8 @@ void Widget::SetParent( Widget::Ptr parent ) {
 		}
 
 		SetHierarchyLevel( parent->GetHierarchyLevel() + 1 );
+
+		SetTransform( parent->GetTransform() );
 	}
 	else {
 		// If this widget does not have a parent, it becomes a root widget.
@@ -268,6 +389,11 @@ void Widget::SetParent( Widget::Ptr parent ) {
 		}
 
 		SetHierarchyLevel( 0 );
+
+		auto transform = Renderer::Get().CreateTransform();
+		transform->SetOffset( m_allocation.position );
+
+		SetTransform( transform );
 	}
 
 	HandleAbsolutePositionChange();
@@ -282,11 +408,20 @@ void Widget::SetPosition( const sf::Vector2f& position ) {
 
 	if( ( allocation.position.y != m_allocation.position.y ) || ( allocation.position.x != m_allocation.position.x ) ) {
 	  HandlePositionChange();
-	  HandleAbsolutePositionChange();
+
+	  if( m_parent.lock() ) {
+	    HandleAbsolutePositionChange();
+	  }
+	  else {
+	    // Moving a root widget moves its entire hierarchy along with it.
+	    m_transform->SetOffset( m_allocation.position );
+	  }
 	}
 }
 
 void Widget::HandleEvent( const sf::Event& event ) {
+	SFGUI_PROFILE_SCOPE( HANDLE_EVENT );
+
 	if( !IsGloballyVisible() ) {
 		return;
 	}
@@ -585,10 +720,38 @@ sf::Vector2f Widget::GetAbsolutePosition() const {
 
 void Widget::UpdateDrawablePosition() const {
 	if( m_drawable ) {
-		m_drawable->SetPosition( GetAbsolutePosition() );
+		m_drawable->SetPosition( GetDrawablePosition() );
 	}
 }
 
+bool Widget::IsInViewport() const {
+	if( m_viewport == Renderer::Get().GetDefaultViewport() ) {
+		return true;
+	}
+
+	// Inside a Viewport, absolute positions are relative to its source origin.
+	sf::FloatRect visible_rect( m_viewport->GetSourceOrigin(), m_viewport->GetSize() );
+	sf::FloatRect rect( GetAbsolutePosition(), GetAllocation().size );
+
+	// Inclusive test, widgets touching the edge are considered visible.
+	return ( rect.position.x <= visible_rect.position.x + visible_rect.size.x ) &&
+	       ( rect.position.x + rect.size.x >= visible_rect.position.x ) &&
+	       ( rect.position.y <= visible_rect.position.y + visible_rect.size.y ) &&
+	       ( rect.position.y + rect.size.y >= visible_rect.position.y );
+}
+
+sf::Vector2f Widget::GetDrawablePosition() const {
+	auto position = GetAbsolutePosition();
+
+	// Widgets inside a Viewport are positioned relative to the viewport
+	// which in turn is positioned relative to the transform.
+	if( m_viewport == Renderer::Get().GetDefaultViewport() ) {
+		position -= m_transform->GetOffset();
+	}
+
+	return position;
+}
+
 void Widget::SetId( const std::string& id ) {
 	if( id.empty() ) {
 		return;
@@ -795,12 +958,137 @@ void Widget::Refresh() {
 	Invalidate();
 }
 
+bool Widget::RefreshConcurrently() {
+	// Measuring a widget is cheap, only large hierarchies are worth it.
+	const static auto min_concurrent_widgets = 64u;
+
+	SFGUI_PROFILE_SCOPE( LAYOUT );
+
+	if( !Context::Get().IsConcurrentLayoutEnabled() ) {
+		return false;
+	}
+
+	// Children come before their parents.
+	std::vector<Widget*> widgets;
+	CollectRefreshOrder( widgets );
+
+	std::vector<Widget*> leaves;
+
+	for( auto widget : widgets ) {
+		auto container = dynamic_cast<Container*>( widget );
+
+		if( widget->CanMeasureConcurrently() && ( !container || container->GetChildren().empty() ) ) {
+			leaves.push_back( widget );
+		}
+	}
+
+	if( leaves.size() < min_concurrent_widgets ) {
+		return false;
+	}
+
+	std::vector<sf::Vector2f> requisitions( leaves.size() );
+
+	auto measure = [&leaves, &requisitions]( std::size_t index ) {
+		requisitions[index] = leaves[index]->CalculateRequisition();
+	};
+
+	if( Context::Get().GetThreadPool() ) {
+		Context::Get().GetThreadPool()->Run( leaves.size(), measure );
+	}
+	else {
+		for( std::size_t index = 0; index < leaves.size(); ++index ) {
+			measure( index );
+		}
+	}
+
+	for( std::size_t index = 0; index < leaves.size(); ++index ) {
+		leaves[index]->ApplyRequisition( requisitions[index] );
+	}
+
+	// Parents only combine the requisitions of their children. Measure
+	// them once all their children are done instead of after every child.
+	auto leaf = leaves.begin();
+
+	for( auto widget : widgets ) {
+		if( ( leaf != leaves.end() ) && ( *leaf == widget ) ) {
+			++leaf;
+		}
+		else if( widget != this ) {
+			widget->ApplyRequisition( widget->CalculateRequisition() );
+		}
+
+		widget->Invalidate();
+	}
+
+	// Allocates the whole hierarchy.
+	RequestResize();
+
+	return true;
+}
+
+void Widget::CollectRefreshOrder( std::vector<Widget*>& widgets ) {
+	auto container = dynamic_cast<Container*>( this );
+
+	if( container ) {
+		for( const auto& child : container->GetChildren() ) {
+			child->CollectRefreshOrder( widgets );
+		}
+	}
+
+	widgets.push_back( this );
+}
+
 void Widget::RefreshAll() {
 	for( const auto& root_widget : root_widgets ) {
 		root_widget->Refresh();
 	}
 }
 
+void Widget::RefreshStyle() {
+	SFGUI_PROFILE_SCOPE( LAYOUT );
+
+	const auto& engine = Context::Get().GetEngine();
+
+	// Children come before their parents. Parents whose children changed
+	// their size are measured again once all their children are done.
+	std::vector<Widget*> widgets;
+	CollectRefreshOrder( widgets );
+
+	std::unordered_set<const Widget*> resized_parents;
+	auto resize = false;
+
+	for( auto widget : widgets ) {
+		auto style_change = engine.GetStyleChange( widget->shared_from_this() );
+
+		if( style_change != Engine::StyleChange::NONE ) {
+			widget->Invalidate();
+		}
+
+		if( ( style_change != Engine::StyleChange::SIZE ) && !resized_parents.count( widget ) ) {
+			continue;
+		}
+
+		if( widget == this ) {
+			resize = true;
+			break;
+		}
+
+		widget->ApplyRequisition( widget->CalculateRequisition() );
+		resized_parents.insert( widget->m_parent.lock().get() );
+	}
+
+	// Allocates the changed part of the hierarchy.
+	if( resize ) {
+		RequestResize();
+	}
+}
+
+void Widget::RefreshStyleAll() {
+	for( const auto& root_widget : root_widgets ) {
+		root_widget->RefreshStyle();
+	}
+}
+
 void Widget::HandleRequisitionChange() {
 }
 
@@ -851,6 +1139,26 @@ void Widget::HandleViewportUpdate() {
 	}
 }
 
+void Widget::SetTransform( RendererTransform::Ptr transform ) {
+	if( transform == m_transform ) {
+		return;
+	}
+
+	m_transform = transform;
+
+	HandleTransformUpdate();
+}
+
+RendererTransform::Ptr Widget::GetTransform() const {
+	return m_transform;
+}
+
+void Widget::HandleTransformUpdate() {
+	if( m_drawable ) {
+		m_drawable->SetTransform( m_transform );
+	}
+}
+
 void Widget::SetActiveWidget() {
 	SetActiveWidget( shared_from_this() );
 }